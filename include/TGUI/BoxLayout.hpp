@@ -281,6 +281,16 @@ namespace tgui
         void removeAllWidgets() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the layout and its child widgets, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -64,14 +64,6 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void setWindowHandle(const sf::WindowHandle& windowHandle);
 
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      protected:
-
-        static sf::String m_contents;
-        static sf::WindowHandle m_windowHandle;
-        static bool m_isWindowHandleSet;
-
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -30,11 +30,18 @@
 #include <list>
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/RadioButtonGroup.hpp>
+#include <TGUI/InternedString.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace priv
+    {
+        class UpdatePool;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Container widget
     ///
@@ -95,7 +102,7 @@ namespace tgui
         /// @return Vector of all widget pointers
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::vector<Widget::Ptr>& getWidgets()
+        const std::vector<Widget::Ptr>& getWidgets() const
         {
             return m_widgets;
         }
@@ -107,7 +114,7 @@ namespace tgui
         /// @return Vector of all widget names
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::vector<sf::String>& getWidgetNames()
+        const std::vector<sf::String>& getWidgetNames() const
         {
             return m_objName;
         }
@@ -196,7 +203,7 @@ namespace tgui
         /// @return Name of the widget or an empty string when the widget didn't exist or wasn't given a name
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::string getWidgetName(const Widget::Ptr& widget) const;
+        const std::string& getWidgetName(const Widget::Ptr& widget) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -255,6 +262,15 @@ namespace tgui
         void uncheckRadioButtons();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the group of the radio buttons inside this container
+        ///
+        /// @return Group used by the child radio buttons for which no other group was set
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RadioButtonGroup::Ptr getRadioButtonGroup();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the opacity of the container and all its child widgets.
         ///
@@ -395,13 +411,41 @@ namespace tgui
         virtual void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Does the same as update, but the child widgets are updated on multiple threads.
+        // Every child is updated as a whole on a single thread and the signals that are send while updating are delayed until
+        // all children are updated. Children that are running an animation are updated on the calling thread, as animations
+        // can move and resize other widgets through their layouts. The same goes for children that use a shared font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateParallel(sf::Time elapsedTime, priv::UpdatePool& pool);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether the widget or one of its children is running an animation or uses shared resources while updating
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool mustUpdateOnCallingThread(const Widget& widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // When this function is called then all the widgets receive the event (if there are widgets).
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
+        // The event is only decoded here, the child containers receive the already translated values directly.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(sf::Event& event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes events to the child widgets. The coordinates are relative to the container.
+        // These functions return true when the event was consumed by a child.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool dispatchMouseMoved(float x, float y);
+        bool dispatchLeftMousePressed(float x, float y);
+        bool dispatchLeftMouseReleased(float x, float y, bool notifyMouseNoLongerDown);
+        bool dispatchKeyPressed(const sf::Event::KeyEvent& event);
+        bool dispatchTextEntered(sf::Uint32 key);
+        bool dispatchMouseWheelMoved(int delta, float x, float y);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Focuses the next widget in the container. If the last widget was focused then all widgets will be unfocused and
         // this function will return false.
@@ -417,6 +461,12 @@ namespace tgui
         bool tabKeyPressed();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches a widget by name. The name is only interned once, the comparisons while searching only compare pointers.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getByInternedName(const InternedString& widgetName, bool recursive) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Checks above which widget the mouse is standing.
         // If there is no widget below the mouse then this function will return a null pointer.
@@ -430,19 +480,32 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function will record the render commands of all the widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitWidgetContainerCommands(RenderCommandList& commands, const sf::Transform& transform) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         std::vector<Widget::Ptr> m_widgets;
         std::vector<sf::String>  m_objName;
 
+        // The same names as in m_objName, interned so that searching a widget by name only has to compare pointers
+        std::vector<InternedString> m_internedObjName;
+
         Widget::Ptr m_widgetBelowMouse;
 
+        // The child on which the mouse went down. Draggable widgets and containers keep receiving mouse move events while
+        // the mouse is down, even when the mouse is no longer on top of them.
+        Widget::Ptr m_capturedWidget;
+
         // The id of the focused widget
         std::size_t m_focusedWidget = 0;
 
-        // Did we enter handleEvent directly or because we got a MouseReleased event?
-        bool m_handingMouseReleased = false;
+        // Group of the child radio buttons, only created when a radio button gets checked
+        RadioButtonGroup::Ptr m_radioButtonGroup;
 
 
         friend class Widget;
@@ -488,6 +551,16 @@ namespace tgui
         virtual bool mouseOnWidget(float x, float y) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw all widgets in the gui
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation to apply to all widgets
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
@@ -506,11 +579,20 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the queue of this gui, which is delivered from Gui::updateTime.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<priv::DelayedSignalQueue> getDelayedSignalQueue() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
         sf::RenderTarget* m_window = nullptr;
 
+        // The delayed signal handlers of the widgets in this gui
+        std::shared_ptr<priv::DelayedSignalQueue> m_delayedSignalQueue = std::make_shared<priv::DelayedSignalQueue>();
+
 
         friend class Gui;
 
@@ -0,0 +1,213 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_CONTEXT_HPP
+#define TGUI_CONTEXT_HPP
+
+
+#include <TGUI/TextureData.hpp>
+#include <TGUI/Loading/ObjectConverter.hpp>
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+    class BaseThemeLoader;
+
+    namespace priv
+    {
+        class DelayedSignalQueue;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Owns the resources and caches that are shared by all guis
+    ///
+    /// Loaded textures, cached theme files, widget constructors, deserialized values, the clipboard, the resource path and
+    /// the signal ids are stored here instead of in separate global variables. Every cache is protected by its own mutex,
+    /// so guis for different windows can share the loaded resources while being updated and drawn on different threads.
+    ///
+    /// Only the shared state is synchronized. Widgets, themes and fonts themselves must still only be used from one thread
+    /// at a time, so every thread should have its own gui, widgets and fonts.
+    ///
+    /// The theme loading and texture classes access the context automatically, you only need this class to change the
+    /// resource path or to clear the caches.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Context
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the context that is shared by all guis
+        ///
+        /// @return The global context
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Context& getGlobal();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Context(const Context&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Context& operator=(const Context&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Set a new resource path.
+        ///
+        /// @param path  New resource path
+        ///
+        /// This is the same as calling tgui::setResourcePath.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setResourcePath(const std::string& path);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Return the resource path.
+        ///
+        /// While a theme is initializing a widget, the theme directory is added to the path for the calling thread only.
+        ///
+        /// @return The current resource path
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::string getResourcePath() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of different images that are currently loaded
+        ///
+        /// @return Number of images kept by the texture manager
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLoadedImageCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets the cached theme files and deserialized values
+        ///
+        /// Loaded textures are not affected, they are released when the last texture using them is destroyed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearCaches();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        Context();
+
+        // Changes the resource path of the calling thread, or restores the global path when nullptr is passed
+        static const std::string* setThreadResourcePath(const std::string* path);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        mutable std::mutex m_resourcePathMutex;
+        std::string m_resourcePath;
+
+        // Used by TextureManager
+        mutable std::mutex m_textureMutex;
+        std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        std::map<std::string, std::pair<std::shared_ptr<sf::Image>, unsigned int>> m_preloadedImages;
+
+        // Used by DefaultThemeLoader
+        std::mutex m_themeCacheMutex;
+        std::map<std::string, std::map<std::string, std::map<std::string, std::string>>> m_themePropertiesCache;
+        std::map<std::string, std::map<std::string, std::string>> m_themeWidgetTypeCache;
+
+        // Used by BaseTheme
+        std::mutex m_themeMutex;
+        std::map<std::string, std::function<std::shared_ptr<Widget>()>> m_widgetConstructors;
+        std::shared_ptr<BaseThemeLoader> m_themeLoader;
+
+        // Used by Deserializer
+        std::mutex m_deserializerMutex;
+        bool m_deserializeCacheEnabled = false;
+        std::map<ObjectConverter::Type, std::map<std::string, ObjectConverter>> m_deserializeCache;
+        std::string m_deserializeCacheResourcePath;
+        std::size_t m_deserializeCacheHits = 0;
+        std::size_t m_deserializeCacheMisses = 0;
+        std::size_t m_deserializeCacheGeneration = 0; // Changes whenever cached values may no longer be valid
+
+        // Used by Serializer, WidgetLoader and WidgetSaver to guard their maps of functions
+        std::mutex m_serializerMutex;
+        std::mutex m_widgetLoaderMutex;
+        std::mutex m_widgetSaverMutex;
+
+        // Used by Clipboard
+        std::mutex m_clipboardMutex;
+        sf::String m_clipboardContents;
+        sf::WindowHandle m_clipboardWindowHandle = sf::WindowHandle();
+        bool m_clipboardWindowHandleSet = false;
+
+        // Used by InternedString, every string is stored once together with the amount of interned strings using it
+        std::mutex m_internedStringMutex;
+        std::unordered_map<std::string, std::atomic<std::size_t>> m_internedStrings;
+
+        // Used by Signal
+        std::atomic<unsigned int> m_lastSignalId;
+        std::shared_ptr<priv::DelayedSignalQueue> m_delayedSignalQueue;
+
+        friend class TextureManager;
+        friend class Texture;
+        friend class DefaultThemeLoader;
+        friend class BaseTheme;
+        friend class Theme;
+        friend class Deserializer;
+        friend class Serializer;
+        friend class WidgetLoader;
+        friend class WidgetSaver;
+        friend class Clipboard;
+        friend class InternedString;
+        friend class Signal;
+        friend struct DefaultThemeLoaderTest;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_CONTEXT_HPP
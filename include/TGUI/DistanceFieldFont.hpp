@@ -0,0 +1,460 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DISTANCE_FIELD_FONT_HPP
+#define TGUI_DISTANCE_FIELD_FONT_HPP
+
+
+#include <TGUI/Global.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+namespace priv
+{
+    class DistanceFieldFont;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Texture in which the distance field glyphs of all fonts are stored.
+    // The texture is split in shelves of equal height. When there is no room left for a new glyph, the shelf that was used
+    // least recently is emptied and the glyphs on it are removed from the fonts that own them.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API GlyphAtlas
+    {
+    public:
+
+        // Width and height of the texture containing all the glyphs
+        static const unsigned int AtlasSize = 1024;
+
+        // Height of every shelf, which is enough for a glyph at the reference size of the distance field fonts
+        static const unsigned int ShelfHeight = 84;
+
+        // Shelf number of glyphs that have no pixels
+        static const unsigned int NoShelf = static_cast<unsigned int>(-1);
+
+        // Amount of shelves in the texture
+        static const unsigned int ShelfCount = AtlasSize / ShelfHeight;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the atlas that is shared by all distance field fonts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static GlyphAtlas& getGlobal();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Starts a new use of the atlas. Shelves used after this call can't be emptied until the next call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUse();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the shelf as used, so that it won't be emptied soon
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void touch(unsigned int shelf);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds room for a glyph of the given size. Returns false when there is no room, even after emptying the shelves
+        // that weren't used since beginUse was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool allocate(DistanceFieldFont& owner, sf::Uint64 key, unsigned int width, unsigned int height, sf::Vector2u& position, unsigned int& shelf);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets about all glyphs of a font, without freeing the space on the shelves
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeOwner(const DistanceFieldFont& owner);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether any of the shelves (one bit per shelf) was emptied after the atlas had the given generation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool shelvesClearedSince(unsigned int shelves, unsigned long long generation) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the texture that contains all the distance field glyphs. The texture is only created when it is first needed
+        // and the shelves that changed since the last call are copied into it, so that no OpenGL context is needed until then.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Texture& getTexture();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the distance values of all glyphs (one byte per pixel), used when rendering without OpenGL
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::Uint8>& getDistances() const
+        {
+            return m_distances;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the distance values of a glyph (one byte per pixel), the texture is only updated when it is requested
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(const std::vector<sf::Uint8>& distances, unsigned int width, unsigned int height, sf::Vector2u position);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a number that changes every time glyphs are removed from the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned long long getGeneration() const
+        {
+            return m_generation;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Every function of the atlas and the distance field fonts has to be called while this mutex is locked
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::recursive_mutex& getMutex()
+        {
+            return m_mutex;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        GlyphAtlas();
+
+        // Removes all glyphs on a shelf from their fonts
+        void clearShelf(unsigned int shelf);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Shelf
+        {
+            unsigned int nextGlyphPos = 0;
+            unsigned long long lastUse = 0;
+            unsigned long long lastClear = 0;
+            std::vector<std::pair<DistanceFieldFont*, sf::Uint64>> glyphs;
+        };
+
+        std::recursive_mutex m_mutex;
+        sf::Texture m_texture;
+        bool m_textureCreated = false;
+        unsigned int m_outdatedShelves = 0; // Shelves of which the distances changed since they were copied to the texture
+        std::vector<sf::Uint8> m_distances;
+        std::vector<Shelf> m_shelves;
+        unsigned long long m_useCounter = 1;
+        unsigned long long m_generation = 0;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Glyphs of a font that are rasterized only once and stored as signed distance fields.
+    // Text of any character size can be rendered from the same glyphs with a small shader.
+    // The glyphs of all fonts are stored in the same texture, where the least recently used ones are replaced when it is full.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DistanceFieldFont
+    {
+    public:
+
+        // The character size at which the glyphs are rasterized
+        static const unsigned int ReferenceSize = 48;
+
+        // Distance in pixels around the glyph that is stored in the distance field
+        static const unsigned int Spread = 6;
+
+        // Width and height of the texture containing all the glyphs
+        static const unsigned int AtlasSize = GlyphAtlas::AtlasSize;
+
+        // Maximum amount of texts of which the geometry is remembered
+        static const std::size_t MaxCachedGeometries = 256;
+
+        // Metrics at the reference size. The bounds and texture rect include the spread around the glyph.
+        struct Glyph
+        {
+            float         advance = 0;
+            sf::FloatRect bounds;
+            sf::IntRect   textureRect;
+            unsigned int  shelf = GlyphAtlas::NoShelf;
+        };
+
+        // Metrics at the reference size, as reported by the font. They remain available when the glyph is removed from the atlas.
+        struct GlyphMetrics
+        {
+            float         advance = 0;
+            sf::FloatRect bounds;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor. The font has to stay alive as long as this object exists.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DistanceFieldFont(const sf::Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Destructor, which removes the glyphs from the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~DistanceFieldFont();
+
+        DistanceFieldFont(const DistanceFieldFont&) = delete;
+        DistanceFieldFont& operator=(const DistanceFieldFont&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the distance field glyphs that belong to the font.
+        // The object is shared between all callers and destroyed automatically together with the font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<DistanceFieldFont> get(const std::shared_ptr<sf::Font>& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Lets the glyphs of the font be rasterized from the font file with FreeType, instead of by the sf::Font which needs an
+        // OpenGL context to store them in its texture. This is what allows text to be rendered with the software render backend
+        // on machines without OpenGL. It has to be called before the font is used. Returns false when the file can't be opened
+        // or when TGUI was built without FreeType, in which case the sf::Font keeps rasterizing the glyphs.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool setFontFile(const std::shared_ptr<sf::Font>& font, const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Same as setFontFile, but for a font that was loaded from memory. The data is copied.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool setFontData(const std::shared_ptr<sf::Font>& font, const void* data, std::size_t sizeInBytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that all characters of the string are available in the texture.
+        // Returns false when the string contains more different characters than can be stored in the texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadGlyphs(const sf::String& string, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a glyph that was loaded with loadGlyphs, or nullptr when the glyph isn't loaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Glyph* getGlyph(sf::Uint32 codePoint, bool bold) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the metrics of a glyph at the reference size. Only the reference size is ever rasterized by the font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const GlyphMetrics& getGlyphMetrics(sf::Uint32 codePoint, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the kerning between two characters, scaled from the reference size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getKerning(sf::Uint32 first, sf::Uint32 second, unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the distance between two lines, scaled from the reference size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getLineSpacing(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the triangles to draw the text with the texture of this object, relative to the text. The text has to use the
+        // same font. The triangles are only created again when the string, character size, style or color of the text changed
+        // or when glyphs were removed from the atlas. The returned vertices remain valid until the next call to this function.
+        // Returns nullptr when the text can't be rendered this way, in which case the text has to be drawn normally.
+        // When shelves isn't nullptr, the shelves that contain the glyphs of the text are stored in it (one bit per shelf).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::Vertex>* getGeometry(const sf::Text& text, unsigned int* shelves = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the texture that contains all the distance field glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Texture& getTexture() const
+        {
+            return GlyphAtlas::getGlobal().getTexture();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of glyphs that are currently stored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getGlyphCount() const
+        {
+            return m_glyphs.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Font file opened with FreeType, which is only used when glyphs are rasterized without the sf::Font
+        struct FreeTypeFace;
+
+        // Starts rasterizing the glyphs with FreeType instead of with the sf::Font
+        bool setFace(std::unique_ptr<FreeTypeFace> face);
+
+        // Rasterizes a glyph at the reference size with FreeType, with the same settings as the sf::Font would use.
+        // The pixels that are part of the glyph are set to true in the mask, which has the size of the glyph bounds.
+        void rasterizeGlyph(sf::Uint32 codePoint, bool bold, GlyphMetrics& metrics, std::vector<bool>& insideGlyph);
+
+        // Creates the distance field of a glyph and stores it in the atlas. Returns false when the atlas is full.
+        // The mask tells which of the pixels of the rasterized glyph, of which the top left lies at the top left of the
+        // bounds, are part of the glyph.
+        bool addGlyph(sf::Uint32 codePoint, bool bold, const GlyphMetrics& metrics, int glyphWidth, int glyphHeight, const std::vector<bool>& insideGlyph);
+
+        // Fills the vertices of a text of which all glyphs are loaded and returns the shelves that contain them (one bit per shelf)
+        unsigned int createGeometry(const sf::Text& text, std::vector<sf::Vertex>& vertices);
+
+        // Forgets about the geometry of the texts that weren't drawn for the longest time
+        void removeOldGeometry();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const sf::Font& m_font;
+        std::unique_ptr<FreeTypeFace> m_face;
+
+        // The key contains both the code point and the bold flag
+        std::map<sf::Uint64, Glyph> m_glyphs;
+        std::map<sf::Uint64, GlyphMetrics> m_glyphMetrics;
+
+        // Geometry of the texts that were drawn recently, with the hash of the text as key
+        struct CachedGeometry
+        {
+            sf::String             string;
+            unsigned int           characterSize = 0;
+            sf::Uint32             style = 0;
+            sf::Color              color;
+            unsigned long long     atlasGeneration = 0;
+            unsigned int           shelves = 0;
+            unsigned long long     lastUse = 0;
+            std::vector<sf::Vertex> vertices;
+        };
+        std::unordered_map<std::size_t, CachedGeometry> m_geometryCache;
+        unsigned long long m_geometryUseCounter = 0;
+
+        friend class GlyphAtlas;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Measures text in the same way as it will be drawn. When distance field text is enabled, the glyph metrics at the
+    // reference size are scaled, so that measuring text doesn't make the font rasterize its glyphs at every character size.
+    // The glyph atlas remains locked as long as the object exists.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextMetrics
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Constructor. The font may not be nullptr.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextMetrics(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the horizontal distance from the character to the next one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAdvance(sf::Uint32 codePoint);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width of the visible part of the character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getWidth(sf::Uint32 codePoint);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the bounding rectangle of the character, relative to the baseline
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::FloatRect getBounds(sf::Uint32 codePoint);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the kerning offset between two characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getKerning(sf::Uint32 first, sf::Uint32 second) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the distance between two lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getLineSpacing() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const sf::Font& m_font;
+        unsigned int m_characterSize;
+        bool m_bold;
+        std::shared_ptr<DistanceFieldFont> m_distanceFieldFont;
+        float m_scale = 1;
+        std::unique_lock<std::recursive_mutex> m_lock;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Replacement for sf::Text::findCharacterPos that uses the same metrics as TextMetrics
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API sf::Vector2f findCharacterPos(const sf::Text& text, const std::shared_ptr<sf::Font>& font, std::size_t index);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Replacement for sf::Text::getLocalBounds that uses the same metrics as TextMetrics
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API sf::FloatRect getTextBounds(const sf::Text& text, const std::shared_ptr<sf::Font>& font);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Returns the shader that draws triangles with texture coordinates in the glyph atlas.
+    // Returns nullptr when shaders aren't supported, in which case text has to be drawn normally.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API sf::Shader* getDistanceFieldShader();
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    // Draws the text, using distance field glyphs when they are enabled and shaders are available.
+    // The font must be the font that is used by the text.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void drawText(sf::RenderTarget& target, sf::RenderStates states, const sf::Text& text, const std::shared_ptr<sf::Font>& font);
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DISTANCE_FIELD_FONT_HPP
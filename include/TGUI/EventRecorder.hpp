@@ -0,0 +1,192 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_EVENT_RECORDER_HPP
+#define TGUI_EVENT_RECORDER_HPP
+
+
+#include <TGUI/Global.hpp>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Records the input of a gui so that it can be replayed later
+    ///
+    /// When the recorder is attached to a gui with Gui::setEventRecorder, every event passed to Gui::handleEvent and every
+    /// elapsed time passed to Gui::updateTime is stored. The recording can be saved to a compact binary file and fed into
+    /// another gui with EventReplayer.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API EventRecorder
+    {
+    public:
+
+        typedef std::shared_ptr<EventRecorder> Ptr; ///< Shared recorder pointer
+        typedef std::shared_ptr<const EventRecorder> ConstPtr; ///< Shared constant recorder pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief A single recorded event or time update
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Entry
+        {
+            bool         isEvent;     ///< True when event is filled in, false when elapsedTime is filled in
+            sf::Event    event;       ///< Event that was passed to Gui::handleEvent
+            sf::Time     elapsedTime; ///< Time that was passed to Gui::updateTime
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new recorder
+        ///
+        /// @return The new recorder
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static EventRecorder::Ptr create();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds an event to the recording
+        ///
+        /// @param event  Event that was passed to the gui
+        ///
+        /// This function is called by the gui to which the recorder is attached.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recordEvent(const sf::Event& event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a time update to the recording
+        ///
+        /// @param elapsedTime  Time that was passed to the gui
+        ///
+        /// This function is called by the gui to which the recorder is attached. Every time update ends a frame.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recordTime(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Pauses or resumes the recording
+        ///
+        /// @param paused  Should events and time updates be ignored?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPaused(bool paused);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the recording is paused
+        ///
+        /// @return Are events and time updates being ignored?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isPaused() const
+        {
+            return m_paused;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns everything that was recorded, in the order in which it happened
+        ///
+        /// @return Recorded events and time updates
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Entry>& getEntries() const
+        {
+            return m_entries;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes everything that was recorded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the recording to a file
+        ///
+        /// @param filename  Filename of the recording
+        ///
+        /// @throw Exception when the file could not be written
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveToFile(const std::string& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the recording with one that was saved to a file
+        ///
+        /// @param filename  Filename of the recording
+        ///
+        /// @throw Exception when the file could not be read or is not a valid recording
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFromFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the recording to a stream
+        ///
+        /// @param stream  Stream to which the recording will be written
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveToStream(std::ostream& stream) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the recording with one that is read from a stream
+        ///
+        /// @param stream  Stream containing the recording
+        ///
+        /// @throw Exception when the stream does not contain a valid recording
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFromStream(std::istream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::vector<Entry> m_entries;
+        bool m_paused = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_EVENT_RECORDER_HPP
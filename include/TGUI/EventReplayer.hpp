@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_EVENT_REPLAYER_HPP
+#define TGUI_EVENT_REPLAYER_HPP
+
+
+#include <TGUI/EventRecorder.hpp>
+#include <TGUI/Container.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Gui;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Feeds a recording made with EventRecorder into a gui and measures how long every frame takes
+    ///
+    /// The gui does not need a window, it can be bound to an sf::RenderTexture so that replaying works headless.
+    /// Time is never taken from a clock while replaying, so replaying the same recording on the same widgets always leads
+    /// to the same widget tree, which can be verified with the checksum of every frame.
+    ///
+    /// @code
+    /// sf::RenderTexture target;
+    /// target.create(800, 600);
+    /// tgui::Gui gui{target};
+    /// gui.loadWidgetsFromFile("form.txt");
+    ///
+    /// auto recording = tgui::EventRecorder::create();
+    /// recording->loadFromFile("trace.rec");
+    /// for (auto& frame : tgui::EventReplayer::replay(*recording, gui))
+    ///     std::cout << frame.updateDuration.asMicroseconds() << " " << frame.checksum << std::endl;
+    /// @endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API EventReplayer
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measurements of a single replayed frame
+        ///
+        /// A frame consists of all events that were handled before a time update, followed by that time update.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Frame
+        {
+            std::size_t events = 0;   ///< Amount of events that were handled during the frame
+            sf::Time elapsedTime;     ///< Recorded time that was passed to the gui at the end of the frame
+            sf::Time eventDuration;   ///< Time spend handling the events
+            sf::Time updateDuration;  ///< Time spend in Gui::updateTime
+            sf::Time drawDuration;    ///< Time spend drawing the widgets
+            sf::Uint64 checksum = 0;  ///< Checksum of the widget tree after the frame
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replays a recording on a gui
+        ///
+        /// @param recording  Recorded events and time updates
+        /// @param gui        Gui that will receive the events, which must have a render target
+        /// @param draw       Should the widgets be drawn after every frame?
+        ///
+        /// Events that were recorded after the last time update form a last frame without time update.
+        ///
+        /// @return Measurements of every frame
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<Frame> replay(const EventRecorder& recording, Gui& gui, bool draw = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates a checksum of the widgets in a gui
+        ///
+        /// @param gui  Gui containing the widgets
+        ///
+        /// The checksum covers the type, name, position, size, visibility, enabled state and focus of every widget,
+        /// including the widgets inside child containers. The contents of widgets (e.g. the text of an edit box) are
+        /// included by hashing what the save function of the widget type would write to a widget file.
+        ///
+        /// @return Checksum of the widget tree
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::Uint64 getChecksum(const Gui& gui);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates a checksum of the widgets in a container
+        ///
+        /// @param container  Container with the widgets
+        ///
+        /// @return Checksum of the widget tree
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::Uint64 getChecksum(const Container& container);
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_EVENT_REPLAYER_HPP
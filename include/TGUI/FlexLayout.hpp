@@ -0,0 +1,429 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FLEX_LAYOUT_HPP
+#define TGUI_FLEX_LAYOUT_HPP
+
+
+#include <TGUI/Widgets/Panel.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Container that places its children in rows or columns, similar to a CSS flexbox.
+    ///
+    /// Every child has a basis size along the main axis, which is the size of the widget when it was added unless a basis
+    /// is set. Free space on a line is divided between the children based on their grow factor, while missing space is
+    /// taken from the children based on their shrink factor. When wrapping is enabled, children that don't fit on a line
+    /// are moved to the next line.
+    ///
+    /// The positions and sizes of all children are calculated together in one pass over the children, instead of
+    /// binding the layouts of the children to each other.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FlexLayout : public Panel
+    {
+    public:
+
+        typedef std::shared_ptr<FlexLayout> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const FlexLayout> ConstPtr; ///< Shared constant widget pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Direction of the main axis
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class Direction
+        {
+            Row,   ///< Children are placed from left to right
+            Column ///< Children are placed from top to bottom
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief How remaining space on the main axis is used when the children don't grow to fill the line
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class Justify
+        {
+            Start,        ///< Children are placed at the start of the line
+            Center,       ///< Children are placed in the middle of the line
+            End,          ///< Children are placed at the end of the line
+            SpaceBetween, ///< The space is divided between the children, the first and last child touch the sides
+            SpaceAround   ///< The space is divided around the children
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Alignment of the children on the cross axis within their line
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class Alignment
+        {
+            Start,  ///< Children are placed at the top (rows) or left side (columns) of their line
+            Center, ///< Children are centered in their line
+            End,    ///< Children are placed at the bottom (rows) or right side (columns) of their line
+            Stretch ///< Children are resized to the height (rows) or width (columns) of their line
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FlexLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new flex layout
+        ///
+        /// @param direction  Direction in which the children are placed
+        ///
+        /// @return The new flex layout
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FlexLayout::Ptr create(Direction direction = Direction::Row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another layout
+        ///
+        /// @param layout  The other layout
+        ///
+        /// @return The new layout
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FlexLayout::Ptr copy(FlexLayout::ConstPtr layout);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the layout.
+        ///
+        /// @param size  The new size of the layout
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setSize(const Layout2d& size) override;
+        using Transformable::setSize;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a widget at the end of the layout.
+        ///
+        /// @param widget      Pointer to the widget you would like to add
+        /// @param widgetName  An identifier to access to the widget later
+        ///
+        /// The current size of the widget is used as its preferred size.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void add(const Widget::Ptr& widget, const sf::String& widgetName = "") override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Insert a widget to the layout.
+        ///
+        /// @param index       Index of the widget in the layout
+        /// @param widget      Pointer to the widget you would like to add
+        /// @param widgetName  An identifier to access to the widget later
+        ///
+        /// If the index is too high, the widget will simply be added at the end of the list.
+        ///
+        /// @return False when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a single widget that was added to the layout.
+        ///
+        /// @param widget  Pointer to the widget to remove
+        ///
+        /// @return True when widget is removed, false when widget was not found
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool remove(const Widget::Ptr& widget) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets that were added to the layout.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void removeAllWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the direction in which the children are placed
+        ///
+        /// @param direction  Direction of the main axis
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDirection(Direction direction);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the direction in which the children are placed
+        ///
+        /// @return Direction of the main axis
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Direction getDirection() const
+        {
+            return m_direction;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether children that don't fit on a line are moved to a new line
+        ///
+        /// @param wrap  Start a new line when the children don't fit?
+        ///
+        /// Wrapping is disabled by default, in which case the children will shrink to fit on a single line.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWrap(bool wrap);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether children that don't fit on a line are moved to a new line
+        ///
+        /// @return Is wrapping enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getWrap() const
+        {
+            return m_wrap;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the space between the children and between the lines
+        ///
+        /// @param gap  Distance between two children
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGap(float gap);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the space between the children and between the lines
+        ///
+        /// @return Distance between two children
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getGap() const
+        {
+            return m_gap;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how the remaining space on a line is divided
+        ///
+        /// @param justify  Placement of the children on the main axis
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setJustify(Justify justify);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how the remaining space on a line is divided
+        ///
+        /// @return Placement of the children on the main axis
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Justify getJustify() const
+        {
+            return m_justify;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how the children are aligned within their line
+        ///
+        /// @param alignment  Placement of the children on the cross axis
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAlignment(Alignment alignment);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how the children are aligned within their line
+        ///
+        /// @return Placement of the children on the cross axis
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Alignment getAlignment() const
+        {
+            return m_alignment;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much a child grows compared to the others when there is free space on its line
+        ///
+        /// @param widget  Pointer to the widget
+        /// @param grow    Grow factor, 0 (default) means that the widget doesn't grow
+        ///
+        /// @return False when the widget was not found
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setGrow(const Widget::Ptr& widget, float grow);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much a child grows compared to the others when there is free space on its line
+        ///
+        /// @param widget  Pointer to the widget
+        ///
+        /// @return Grow factor or 0 when the widget was not found
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getGrow(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much a child shrinks compared to the others when its line is too small
+        ///
+        /// @param widget  Pointer to the widget
+        /// @param shrink  Shrink factor, 0 means that the widget never shrinks. The default is 1.
+        ///
+        /// @return False when the widget was not found
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setShrink(const Widget::Ptr& widget, float shrink);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much a child shrinks compared to the others when its line is too small
+        ///
+        /// @param widget  Pointer to the widget
+        ///
+        /// @return Shrink factor or 0 when the widget was not found
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getShrink(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of a child along the main axis before growing or shrinking
+        ///
+        /// @param widget  Pointer to the widget
+        /// @param basis   Size before growing or shrinking, or a negative value to use the size the widget had when it was added
+        ///
+        /// @return False when the widget was not found
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setBasis(const Widget::Ptr& widget, float basis);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of a child along the main axis before growing or shrinking
+        ///
+        /// @param widget  Pointer to the widget
+        ///
+        /// @return Size before growing or shrinking, or 0 when the widget was not found
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getBasis(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the layout and its child widgets, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the positions and sizes of all children and applies them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetPositions();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widget on the render target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Widget::Ptr clone() const override
+        {
+            return std::make_shared<FlexLayout>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Properties of a child, stored in the same order as m_widgets
+        struct Item
+        {
+            float grow = 0;
+            float shrink = 1;
+            float basis = -1;
+            sf::Vector2f preferredSize;
+        };
+
+        // Geometry of a child that is calculated while updating the layout
+        struct ItemGeometry
+        {
+            float mainSize;
+            float crossSize;
+        };
+
+        std::vector<Item> m_items;
+
+        Direction m_direction = Direction::Row;
+        Justify   m_justify = Justify::Start;
+        Alignment m_alignment = Alignment::Stretch;
+        bool      m_wrap = false;
+        float     m_gap = 0;
+
+        // Buffers that are reused every time the layout is updated to avoid allocations
+        std::vector<ItemGeometry> m_geometry;
+        std::vector<std::size_t> m_lineStarts;
+        std::vector<float> m_lineCrossSizes;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FLEX_LAYOUT_HPP
@@ -27,6 +27,7 @@
 #define TGUI_FONT_HPP
 
 #include <TGUI/Global.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -97,6 +98,79 @@ namespace tgui
         std::shared_ptr<sf::Font> getFont() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes glyphs ahead of time, so that showing text in a new script or size doesn't stall a frame
+        ///
+        /// @param firstCodePoint  First character of the range of characters to load
+        /// @param lastCodePoint   Last character of the range of characters to load (inclusive)
+        /// @param characterSizes  Text sizes for which the glyphs should be loaded
+        /// @param bold            Load the bold glyphs instead of the regular ones?
+        ///
+        /// When distance field text is enabled, the glyphs are only loaded once no matter how many sizes are given.
+        ///
+        /// @see preloadIncrementally
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preload(sf::Uint32 firstCodePoint, sf::Uint32 lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes glyphs ahead of time, so that showing text in a new script or size doesn't stall a frame
+        ///
+        /// @param characters      Characters to load
+        /// @param characterSizes  Text sizes for which the glyphs should be loaded
+        /// @param bold            Load the bold glyphs instead of the regular ones?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preload(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool bold = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes glyphs ahead of time, spread over the next frames
+        ///
+        /// @param firstCodePoint  First character of the range of characters to load
+        /// @param lastCodePoint   Last character of the range of characters to load (inclusive)
+        /// @param characterSizes  Text sizes for which the glyphs should be loaded
+        /// @param bold            Load the bold glyphs instead of the regular ones?
+        ///
+        /// Instead of loading all glyphs immediately like the preload function, only a few glyphs are loaded at the start of
+        /// every call to Gui::draw, so that loading a large range of characters doesn't block the application.
+        /// The glyphs are loaded by the gui that is drawn on the same thread as the one calling this function.
+        ///
+        /// When distance field text is enabled while calling this function, the glyphs are only loaded once for all sizes.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadIncrementally(sf::Uint32 firstCodePoint, sf::Uint32 lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes glyphs ahead of time, spread over the next frames
+        ///
+        /// @param characters      Characters to load
+        /// @param characterSizes  Text sizes for which the glyphs should be loaded
+        /// @param bold            Load the bold glyphs instead of the regular ones?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadIncrementally(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool bold = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are still glyphs waiting to be loaded after calling preloadIncrementally
+        ///
+        /// @return Are glyphs still being loaded?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isPreloadingIncrementally();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Loads glyphs that were requested with preloadIncrementally until the time budget runs out.
+        /// This function is called by Gui::draw.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void continueIncrementalPreload(sf::Time maxDuration);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -49,6 +49,9 @@ namespace tgui
     /// @internal When disabling the tab key usage, pressing tab will no longer focus another widget.
     extern TGUI_API bool TGUI_TabKeyUsageEnabled;
 
+    /// @internal When enabled, text is rendered from signed distance fields instead of glyphs rasterized for every text size.
+    extern TGUI_API bool TGUI_DistanceFieldTextEnabled;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const float pi = 3.14159265358979f;
@@ -79,6 +82,26 @@ namespace tgui
     TGUI_API void disableTabKeyUsage();
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Renders text in labels, edit boxes, text boxes, chat boxes and list boxes from signed distance fields.
+    ///
+    /// Every glyph is only rasterized once and text of any size is drawn from it with a shader, so the memory used by the
+    /// glyphs no longer grows when many different text sizes are used. Text is still rendered normally when shaders are
+    /// not available or when it is underlined or striked through.
+    ///
+    /// Distance field text is disabled by default.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void enableDistanceFieldText();
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Renders text normally again after enableDistanceFieldText was called.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API void disableDistanceFieldText();
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Set a new resource path.
     ///
@@ -98,7 +121,7 @@ namespace tgui
     /// @return The current resource path
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    TGUI_API const std::string& getResourcePath();
+    TGUI_API std::string getResourcePath();
 
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,8 @@
 #include <queue>
 
 #include <TGUI/Container.hpp>
+#include <TGUI/EventRecorder.hpp>
+#include <TGUI/UpdatePool.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -444,6 +446,60 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts recording all events and time updates that are passed to the gui
+        ///
+        /// @param recorder  Recorder that will store the events, or nullptr to stop recording
+        ///
+        /// The recording can later be replayed on another gui with EventReplayer.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setEventRecorder(const EventRecorder::Ptr& recorder);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the recorder that stores the events passed to the gui
+        ///
+        /// @return Recorder that was set with setEventRecorder, or nullptr when not recording
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        EventRecorder::Ptr getEventRecorder() const
+        {
+            return m_eventRecorder;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widgets are updated on multiple threads
+        ///
+        /// @param enabled      Should the widgets be updated in parallel?
+        /// @param threadCount  Amount of threads that update the widgets, including the thread calling the draw function.
+        ///                     When 0, the amount of hardware threads is used.
+        ///
+        /// Every widget that was added directly to the gui is updated together with its children on one of the threads.
+        /// The signals that are send during the update are delayed and send on the thread calling the draw function once all
+        /// widgets are updated, in the same order as without parallel updating. Widgets that are playing an animation or that
+        /// contain a text box which is still loading its text are always updated on the thread calling the draw function.
+        ///
+        /// This is disabled by default. Only enable it when widgets that are directly added to the gui don't depend on each
+        /// other while being updated.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setParallelUpdate(bool enabled, unsigned int threadCount = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widgets are updated on multiple threads
+        ///
+        /// @return Is parallel updating enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isParallelUpdateEnabled() const
+        {
+            return m_updatePool != nullptr;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Update the internal clock to make animation possible. This function is called automatically by the draw function.
@@ -452,6 +508,15 @@ namespace tgui
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widgets without updating the time first
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -474,6 +539,13 @@ namespace tgui
 
         sf::View m_view;
 
+        EventRecorder::Ptr m_eventRecorder;
+
+        // Threads that update the widgets, or nullptr when updating on a single thread
+        std::unique_ptr<priv::UpdatePool> m_updatePool;
+
+        friend class EventReplayer;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,220 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_INTERNED_STRING_HPP
+#define TGUI_INTERNED_STRING_HPP
+
+#include <TGUI/Global.hpp>
+#include <atomic>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Immutable UTF-8 string of which only one copy exists in memory
+    ///
+    /// All interned strings with the same contents point to the same shared copy, so comparing them only compares a pointer.
+    /// This is used for widget names and item ids, which are compared much more often than they are changed.
+    /// The shared copy is released when the last interned string that uses it is destroyed.
+    /// Copying and destroying an interned string only changes an atomic reference count, the global lock is only taken when
+    /// a string is interned or when its last copy is released.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API InternedString
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates an empty string
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that interns a UTF-8 string
+        ///
+        /// @param string  UTF-8 encoded string
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString(const std::string& string);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that interns a UTF-8 string
+        ///
+        /// @param string  UTF-8 encoded string
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString(const char* string);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that interns an sf::String, which is stored as UTF-8
+        ///
+        /// @param string  String to intern
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString(const sf::String& string);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString(const InternedString& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString(InternedString&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~InternedString();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString& operator=(const InternedString& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString& operator=(InternedString&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the interned string with the given contents, without interning it when it doesn't exist yet
+        ///
+        /// @param string  UTF-8 encoded string
+        ///
+        /// @return Interned string, or an empty string when no interned string with these contents currently exists
+        ///
+        /// This is used to search for a name or id, which can't be found anyway when nothing uses the string.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static InternedString find(const std::string& string);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the interned string with the given contents, without interning it when it doesn't exist yet
+        ///
+        /// @param string  UTF-8 encoded string
+        ///
+        /// @return Interned string, or an empty string when no interned string with these contents currently exists
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static InternedString find(const char* string);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the interned string with the given contents, without interning it when it doesn't exist yet
+        ///
+        /// @param string  String to search
+        ///
+        /// @return Interned string, or an empty string when no interned string with these contents currently exists
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static InternedString find(const sf::String& string);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the UTF-8 contents of the string
+        ///
+        /// @return Reference to the shared copy of the string, which remains valid as long as this object exists
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getString() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts the string to UTF-32
+        ///
+        /// @return Contents of the string as an sf::String
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String toSfString() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the string is empty
+        ///
+        /// @return True when the string has no characters
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const
+        {
+            return m_entry == nullptr;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compares two interned strings, which only compares their addresses
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        friend bool operator==(const InternedString& left, const InternedString& right)
+        {
+            return left.m_entry == right.m_entry;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compares two interned strings, which only compares their addresses
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        friend bool operator!=(const InternedString& left, const InternedString& right)
+        {
+            return left.m_entry != right.m_entry;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Node of the map in the context, which holds the string and the amount of interned strings that refer to it
+        using Entry = std::pair<const std::string, std::atomic<std::size_t>>;
+
+        Entry* m_entry = nullptr;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INTERNED_STRING_HPP
@@ -32,6 +32,7 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <string>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -40,6 +41,7 @@ namespace tgui
     class Gui;
     class Widget;
     class Layout;
+    class Signal;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Shared information between layouts
@@ -82,6 +84,11 @@ namespace tgui
         /// @brief Recalculate the value
         void recalculate();
 
+        /// @brief Reset the value of the layout with the getValue function every time the widget sends the signal
+        ///
+        /// The handler is disconnected again when this object is destroyed.
+        void addWidgetDependency(Widget* widget, const std::string& signalName, float (*getValue)(Widget*));
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
@@ -96,8 +103,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
         float value = 0; ///< Cached value of the layout
-        std::set<Layout*> attachedLayouts; ///< Layout objects that use this shared object
-        std::set<LayoutImpl*> parents; ///< Other layouts that make use of this layout in their expression
+        std::vector<Layout*> attachedLayouts; ///< Layout objects that use this shared object
+        std::vector<LayoutImpl*> parents; ///< Other layouts that make use of this layout in their expression
 
         Operation operation = Operation::Value; ///< Does the layout contain a value or an operation between other layouts?
         std::vector<std::shared_ptr<LayoutImpl>> operands; ///< Operands used in the operation that this object performs
@@ -108,6 +115,15 @@ namespace tgui
 
     private:
         std::set<std::string> boundCallbacks;
+
+        // Handler connected to a signal of another widget. The handler only keeps a weak pointer to this object, so that
+        // replaced layouts don't stay alive and the handler can be disconnected when the layout is destroyed.
+        struct Dependency
+        {
+            std::weak_ptr<Signal> signal;
+            unsigned int id;
+        };
+        std::vector<Dependency> dependencies;
     };
 
 
@@ -116,6 +132,9 @@ namespace tgui
     ///
     /// You don't have to create an instance of this class, numbers are implicitly cast to this class.
     ///
+    /// A layout that only contains a number stores it directly, the shared LayoutImpl is only created for layouts that depend
+    /// on strings, widgets or other layouts. Operators between two constant layouts immediately calculate the result.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Layout
     {
@@ -135,10 +154,9 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value, T>::type>
-        Layout(T constant)
+        Layout(T constant) :
+            m_constant{static_cast<float>(constant)}
         {
-            m_impl->value = static_cast<float>(constant);
-            m_impl->attachedLayouts.insert(this);
         }
 
 
@@ -220,10 +238,63 @@ namespace tgui
         ///
         /// @return Shared layout data
         ///
+        /// When the layout was a constant, it is turned into a layout with a shared implementation by this function.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::shared_ptr<LayoutImpl> getImpl() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Checks whether the layout is a number that doesn't depend on anything
+        ///
+        /// @return True when the layout stores its value directly without a shared implementation
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isConstant() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Checks whether the layout was created from a string
+        ///
+        /// @return True when the value of the layout is calculated by parsing a string
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isStringExpression() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Connects the layout to the widget that it positions or sizes, which string expressions are relative to
+        ///
+        /// @param widget  Widget that uses the layout
+        ///
+        /// Nothing happens for constant layouts. Otherwise the value is recalculated when the layout wasn't connected to the
+        /// widget yet.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void attachToWidget(Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Disconnects the layout from a widget that is being destroyed
+        ///
+        /// @param widget  Widget that no longer uses the layout
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detachFromWidget(const Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Recalculates the value of the layout, which only does something when the layout isn't a constant
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculate() const;
+
+
         /// @brief Unary plus operator for the Layout class
         Layout operator+();
 
@@ -248,7 +319,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        std::shared_ptr<LayoutImpl> m_impl = std::make_shared<LayoutImpl>();
+        mutable std::shared_ptr<LayoutImpl> m_impl; // Only created when the layout isn't a constant
+        float m_constant = 0; // Value of the layout when there is no shared implementation
         std::function<void()> m_callbackFunction;
     };
 
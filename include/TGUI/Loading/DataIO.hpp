@@ -29,6 +29,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Config.hpp>
+#include <functional>
 #include <sstream>
 #include <memory>
 #include <vector>
@@ -57,6 +58,9 @@ namespace tgui
             std::vector<std::shared_ptr<Node>> children;
             std::map<std::string, std::shared_ptr<ValueNode>> propertyValuePairs;
             std::string name;
+
+            // When set, the node is only a placeholder and this function creates the real node at the moment it is emitted
+            std::function<std::shared_ptr<Node>()> deferred;
         };
 
 
@@ -75,6 +79,69 @@ namespace tgui
         };
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes widget file sections directly to an output stream
+        ///
+        /// Only the indentation depth and whether the open sections already contain something is remembered,
+        /// so the memory usage doesn't depend on the size of the output.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Emitter
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Constructor
+            ///
+            /// @param stream  Stream to which the widget file will be written
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit Emitter(std::ostream& stream);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Opens a new section inside the current one
+            ///
+            /// @param name  Name of the section, can be empty
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void beginSection(const std::string& name);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Closes the section that was last opened
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void endSection();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Writes a property inside the current section
+            ///
+            /// @param property  Name of the property
+            /// @param value     Serialized value of the property
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void writeProperty(const std::string& property, const std::string& value);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Writes a node and all of its children as a section inside the current one
+            ///
+            /// @param node  Node to write
+            ///
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void writeNode(const Node& node);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+            void writeIndentation(std::size_t depth);
+
+            std::ostream& m_stream;
+            std::vector<bool> m_sectionHasContents{false}; // One entry per open section, the first one is the root
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Parse a widget file
         ///
@@ -89,17 +156,28 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emit the widget file
         ///
-        /// @param rootNode Root node of the tree of nodes that is to be converted to a string stream
+        /// @param rootNode Root node of the tree of nodes that is to be written to the stream
         /// @param stream   Stream to which the widget file will be added
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void emit(std::shared_ptr<Node> rootNode, std::stringstream& stream);
+        static void emit(std::shared_ptr<Node> rootNode, std::ostream& stream);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    private:
+        /// @brief Replaces all deferred placeholder nodes in the tree by the nodes that they create
+        ///
+        /// @param node  Node that may be or contain deferred placeholders
+        ///
+        /// @return The node itself, or the node that it created when it was a placeholder
+        ///
+        /// The emitter creates the nodes one at a time while writing them, this function is only needed to inspect the tree.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<Node> resolveDeferredNodes(std::shared_ptr<Node> node);
+
 
-        static std::vector<std::string> convertNodesToLines(std::shared_ptr<Node> node);
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
 
         static std::string parseSection(std::stringstream& stream, std::shared_ptr<Node> node, const std::string& sectionName);
 
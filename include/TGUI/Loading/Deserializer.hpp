@@ -42,13 +42,81 @@ namespace tgui
     public:
         using DeserializeFunc = std::function<ObjectConverter(const std::string&)>;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Statistics about the deserialization cache
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct CacheStatistics
+        {
+            std::size_t hits = 0;    ///< Amount of times a cached value could be returned
+            std::size_t misses = 0;  ///< Amount of times the value had to be deserialized
+            std::size_t entries = 0; ///< Amount of values currently stored in the cache
+        };
+
         static ObjectConverter deserialize(ObjectConverter::Type type, const std::string& serializedString);
 
         static void setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer);
-        static const DeserializeFunc& getFunction(ObjectConverter::Type type);
+        static DeserializeFunc getFunction(ObjectConverter::Type type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Remember the deserialized values so that parsing the same string again for the same type is avoided
+        ///
+        /// Loading themes and widget files deserializes the same colors, borders and textures over and over again.
+        /// With the cache enabled, these values are only parsed once and the cached textures share their image.
+        ///
+        /// Cached textures are forgotten when the resource path changes, as their filename is relative to it.
+        /// The cache for a type is also cleared when a custom deserialize function is set for that type.
+        /// Fonts are not cached, every deserialized font is a new font that can be used on a different thread.
+        ///
+        /// The cache is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void enableCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stop caching deserialized values and remove all values from the cache
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void disableCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether deserialized values are being cached
+        ///
+        /// @return Is the cache enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isCacheEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all values from the cache
+        ///
+        /// This also releases the images that were only kept alive by cached textures.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of cache hits and misses since the statistics were last reset
+        ///
+        /// @return Statistics about the cache
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static CacheStatistics getCacheStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the amount of cache hits and misses back to 0
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetCacheStatistics();
 
     private:
-        static std::map<ObjectConverter::Type, DeserializeFunc> m_deserializers;
+        static std::map<ObjectConverter::Type, DeserializeFunc> m_deserializers; // Guarded by the mutex in the global Context
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
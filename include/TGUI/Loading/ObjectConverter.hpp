@@ -38,6 +38,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Implicit converter for settable properties
     ///
+    /// Only the object of the stored type is constructed, so storing a color or number doesn't allocate any memory.
+    ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API ObjectConverter
     {
@@ -115,6 +117,53 @@ namespace tgui
         ObjectConverter(const Texture& texture);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// @param other  Object to copy
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter(const ObjectConverter& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        ///
+        /// @param other  Object to move
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter(ObjectConverter&& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ObjectConverter();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        ///
+        /// @param right  Object to copy
+        ///
+        /// @return Reference to itself
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator=(const ObjectConverter& right);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        ///
+        /// @param right  Object to move
+        ///
+        /// @return Reference to itself
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator=(ObjectConverter&& right);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieve the saved font
         ///
@@ -190,16 +239,30 @@ namespace tgui
         Type getType() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Constructs the object that is stored in the other converter, this object must be empty
+        void copyFrom(const ObjectConverter& other);
+        void moveFrom(ObjectConverter&& other);
+
+        // Destroys the stored object and leaves the converter empty
+        void reset();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         Type m_type = Type::None;
 
-        std::shared_ptr<sf::Font> m_font;
-        sf::Color  m_color;
-        sf::String m_string;
-        float      m_number = 0;
-        Borders    m_borders;
-        Texture    m_texture;
+        // Only the member that matches m_type is constructed
+        union
+        {
+            std::shared_ptr<sf::Font> m_font;
+            sf::Color  m_color;
+            sf::String m_string;
+            float      m_number;
+            Borders    m_borders;
+            Texture    m_texture;
+        };
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
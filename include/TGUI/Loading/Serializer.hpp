@@ -45,10 +45,10 @@ namespace tgui
         static std::string serialize(ObjectConverter&& object);
 
         static void setFunction(ObjectConverter::Type type, const SerializeFunc& serializer);
-        static const SerializeFunc& getFunction(ObjectConverter::Type type);
+        static SerializeFunc getFunction(ObjectConverter::Type type);
 
     private:
-        static std::map<ObjectConverter::Type, SerializeFunc> m_serializers;
+        static std::map<ObjectConverter::Type, SerializeFunc> m_serializers; // Guarded by the mutex in the global Context
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
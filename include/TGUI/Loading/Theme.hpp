@@ -108,6 +108,26 @@ namespace tgui
         static void setThemeLoader(const std::shared_ptr<BaseThemeLoader>& themeLoader);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the construct function of a specific widget type
+        ///
+        /// @param type  Type of the widget
+        ///
+        /// @return Function that creates the widget, or an empty function when no constructor was set for the type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::function<Widget::Ptr()> getConstructFunction(const std::string& type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the function that will load the widget theme data
+        ///
+        /// @return Pointer to the loader
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<BaseThemeLoader> getThemeLoader();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -116,11 +136,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void widgetReload(Widget* widget, const std::string& primary = "", const std::string& secondary = "", bool force = false);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the loading parameters in a widget that was cloned instead of being reloaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetSetLoadingParameters(Widget* widget, const std::string& primary, const std::string& secondary);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    protected:
-        static std::map<std::string, std::function<Widget::Ptr()>> m_constructors; ///< Widget creator functions
-        static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loading functions, they read the theme file
     };
 
 
@@ -160,6 +181,11 @@ namespace tgui
         ///
         /// @param className  Name of the class inside the theme file (equals widget type when no class is given)
         ///
+        /// The first widget of each class is constructed and initialized from the theme properties, later widgets of the same
+        /// class are cloned from a copy of that first widget. Reloading the theme or changing one of its properties discards
+        /// these copies. Widgets that load other widgets from the theme (e.g. the buttons of a child window) are always
+        /// constructed from scratch.
+        ///
         /// @exception Exception when the requested class name could not be loaded from the file
         /// @exception Exception when there was no loader for this type of widget
         ///
@@ -304,6 +330,8 @@ namespace tgui
         std::map<Widget*, std::string> m_widgets; // Map widget to class name
         std::map<std::string, std::string> m_widgetTypes; // Map class name to type
         std::map<std::string, std::map<std::string, std::string>> m_widgetProperties; // Map class name to property-value pairs
+        std::map<std::string, Widget::Ptr> m_prototypes; // Map class name to fully loaded widget, nullptr when it can't be cloned
+        std::size_t m_loadCount = 0;
 
         friend class ThemeTest;
     };
@@ -78,6 +78,7 @@ namespace tgui
     /// This loader will be able to extract the data from these files.
     ///
     /// On first access, the entire file will be cached, the next times the cached map is simply returned.
+    /// The cache is stored in the global Context, so it is shared by all themes.
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API DefaultThemeLoader : public BaseThemeLoader
@@ -122,13 +123,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void readFile(const std::string& filename, std::stringstream& contents) const;
 
-
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    private:
-        static std::map<std::string, std::map<std::string, PropertyValuePairs>> m_propertiesCache;
-        static std::map<std::string, std::map<std::string, std::string>> m_widgetTypeCache;
-
-        friend struct DefaultThemeLoaderTest;
     };
 
 
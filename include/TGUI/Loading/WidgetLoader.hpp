@@ -31,6 +31,8 @@
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Container.hpp>
 
+#include <atomic>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -73,15 +75,38 @@ namespace tgui
         ///
         /// @param type  Type of the widget
         ///
-        /// @return Function called to load the widget
+        /// @return Function called to load the widget, or an empty function when the type has no load function
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static LoadFunction getLoadFunction(const std::string& type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of threads that are used to decode the images referenced by the widget file
+        ///
+        /// @param threadCount  Amount of threads, including the thread calling the load function.
+        ///                     When 0, the amount of hardware threads is used.
+        ///
+        /// When the thread count differs from 1, all images are first decoded in parallel after which the widgets are created
+        /// on the calling thread exactly as when loading on a single thread. By default only a single thread is used.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setThreadCount(unsigned int threadCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of threads that are used to decode the images referenced by the widget file
+        ///
+        /// @return Amount of threads, or 0 when the amount of hardware threads is used
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static const LoadFunction& getLoadFunction(const std::string& type);
+        static unsigned int getThreadCount();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        static std::map<std::string, LoadFunction> m_loadFunctions;
+        static std::map<std::string, LoadFunction> m_loadFunctions; // Guarded by the mutex in the global Context
+        static std::atomic<unsigned int> m_threadCount;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,16 @@ namespace tgui
     class TGUI_API WidgetSaver
     {
     public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function that creates the node of a widget
+        ///
+        /// The save functions of containers don't create the nodes of their child widgets right away. Every child widget gets
+        /// a placeholder node of which the deferred member creates the real node when the file is emitted, so that the nodes of
+        /// all widgets never have to exist at the same time. Call DataIO::resolveDeferredNodes on the returned node when the
+        /// nodes of the child widgets have to be inspected.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         using SaveFunction = std::function<std::shared_ptr<DataIO::Node>(WidgetConverter)>;
 
 
@@ -51,11 +61,13 @@ namespace tgui
         /// @param widget  The container to save
         /// @param stream  Stream to which the widget file will be written to
         ///
+        /// The widgets are written to the stream while they are being visited, the file is never stored in memory as a whole.
+        ///
         /// @note You should use the saveWidgetsToFile or saveWidgetsToSteam functions in Gui and Container
         ///       instead of calling this function directly.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void save(Container::Ptr widget, std::stringstream& stream);
+        static void save(Container::Ptr widget, std::ostream& stream);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,15 +85,15 @@ namespace tgui
         ///
         /// @param type  Type of the widget
         ///
-        /// @return Function called to save the widget
+        /// @return Function called to save the widget, or an empty function when the type has no save function
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static const SaveFunction& getSaveFunction(const std::string& type);
+        static SaveFunction getSaveFunction(const std::string& type);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        static std::map<std::string, SaveFunction> m_saveFunctions;
+        static std::map<std::string, SaveFunction> m_saveFunctions; // Guarded by the mutex in the global Context
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
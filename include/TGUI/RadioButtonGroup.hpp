@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RADIO_BUTTON_GROUP_HPP
+#define TGUI_RADIO_BUTTON_GROUP_HPP
+
+
+#include <TGUI/Global.hpp>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class RadioButton;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Group of radio buttons of which only one can be checked at a time
+    ///
+    /// Radio buttons that are not explicitly placed in a group belong to the group of their parent container.
+    /// The group remembers which radio button is checked, so checking a radio button only has to uncheck the previously
+    /// checked one instead of all radio buttons in the container.
+    ///
+    /// @code
+    /// auto group = tgui::RadioButtonGroup::create();
+    /// radioButton1->setGroup(group);
+    /// radioButton2->setGroup(group);
+    /// @endcode
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RadioButtonGroup
+    {
+      public:
+
+        typedef std::shared_ptr<RadioButtonGroup> Ptr; ///< Shared group pointer
+        typedef std::shared_ptr<const RadioButtonGroup> ConstPtr; ///< Shared constant group pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new radio button group
+        ///
+        /// @return The new group
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static RadioButtonGroup::Ptr create();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the radio button in this group that is currently checked
+        ///
+        /// @return The checked radio button or nullptr when none of the radio buttons in the group are checked
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<RadioButton> getCheckedRadioButton() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Unchecks the radio button in this group that is currently checked (if any)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void uncheckRadioButtons();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when a radio button in the group gets checked. The previously checked radio button will be unchecked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void radioButtonChecked(const std::shared_ptr<RadioButton>& radioButton);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when a radio button gets unchecked, leaves the group or is destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void radioButtonUnchecked(RadioButton* radioButton);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        // The radio button that is checked. The radio button tells the group when it is unchecked or destroyed, but the
+        // pointer may already have expired while the radio button is being destroyed.
+        std::weak_ptr<RadioButton> m_checkedRadioButton;
+
+        friend class RadioButton;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RADIO_BUTTON_GROUP_HPP
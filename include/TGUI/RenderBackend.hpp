@@ -0,0 +1,356 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RENDER_BACKEND_HPP
+#define TGUI_RENDER_BACKEND_HPP
+
+#include <TGUI/Global.hpp>
+#include <TGUI/TextureData.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Texture;
+    class Clipping;
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief List of drawing commands that widgets record and that a render backend executes afterwards
+    ///
+    /// The vertices are stored in the coordinates of the view, the transformation is already applied when recording.
+    /// The list has to be executed before the widgets, textures or fonts that were recorded in it change.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RenderCommandList
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Single drawing command
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Command
+        {
+            enum class Type
+            {
+                Quad,                ///< Colored triangles
+                TexturedQuad,        ///< Triangles with texture coordinates in pixels
+                GlyphRun,            ///< Text
+                GlyphAtlasTriangles, ///< Texts of which the glyphs are triangles with texture coordinates in the glyph atlas
+                PushClip,            ///< Limits all following commands to a rectangle, inside the previous clipping rectangle
+                PopClip,             ///< Restores the clipping rectangle from before the last PushClip
+                Widget               ///< Widget that doesn't record its own commands and can only be drawn by its draw function
+            };
+
+            Type type;
+
+            // Range of triangle vertices that belong to a Quad or TexturedQuad command
+            std::size_t firstVertex = 0;
+            std::size_t vertexCount = 0;
+
+            // Texture of a TexturedQuad command
+            std::shared_ptr<const TextureData> texture;
+
+            // Index of the text of a GlyphRun command, or of the first text that is part of a GlyphAtlasTriangles command
+            std::size_t glyphRun = 0;
+
+            // Amount of texts in a GlyphAtlasTriangles command
+            std::size_t glyphRunCount = 0;
+
+            // Shelves of the glyph atlas that are used by a GlyphAtlasTriangles command (one bit per shelf) and the generation
+            // of the atlas when the command was last checked. When any of these shelves were emptied afterwards, the texts
+            // have to be drawn separately again.
+            unsigned int atlasShelves = 0;
+            unsigned long long atlasGeneration = 0;
+
+            // Clipping rectangle of a PushClip command, before the transformation is applied to it
+            sf::FloatRect clipRect;
+            sf::Transform clipTransform;
+
+            // Widget of a Widget command and the transformation that has to be passed to its draw function
+            const tgui::Widget* widget = nullptr;
+            sf::Transform widgetTransform;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Text that is drawn by a GlyphRun command
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GlyphRun
+        {
+            sf::Text text;
+            std::shared_ptr<sf::Font> font;
+            sf::Transform transform;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a rectangle filled with a single color
+        ///
+        /// @param transform  Transformation to apply to the rectangle
+        /// @param rect       Position and size of the rectangle
+        /// @param color      Fill color
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addQuad(const sf::Transform& transform, const sf::FloatRect& rect, const sf::Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a texture, which is drawn the same way as when drawing the Texture object on a render target
+        ///
+        /// @param transform  Transformation to apply on top of the transformation of the texture itself
+        /// @param texture    Texture to draw
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTexture(sf::Transform transform, const Texture& texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a text
+        ///
+        /// @param transform  Transformation to apply on top of the transformation of the text itself
+        /// @param text       Text to draw
+        /// @param font       Font used by the text
+        ///
+        /// When distance field text is enabled, the glyphs of consecutive texts are merged into a single command, even when
+        /// the texts belong to different widgets, so that they can be drawn together.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addText(const sf::Transform& transform, const sf::Text& text, const std::shared_ptr<sf::Font>& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a shape, which is drawn the same way as when drawing the shape on a render target
+        ///
+        /// @param transform  Transformation to apply on top of the transformation of the shape itself
+        /// @param shape      Shape to draw
+        ///
+        /// Both the fill and the outline of the shape are added, the texture of the shape is ignored.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addShape(const sf::Transform& transform, const sf::Shape& shape);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a widget that will be drawn by calling its draw function
+        ///
+        /// @param transform  Transformation that will be passed to the draw function
+        /// @param widget     Widget to draw
+        ///
+        /// This is what widgets record when they don't implement emitRenderCommands themselves. Only backends that draw on an
+        /// SFML render target can execute such a command.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidget(const sf::Transform& transform, const tgui::Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Limits the commands that follow to a rectangle, until popClip is called
+        ///
+        /// @param transform  Transformation to apply to the rectangle
+        /// @param rect       Position and size of the clipping rectangle
+        ///
+        /// Only the bounding box of the transformed rectangle is used, rotated clipping isn't supported.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pushClip(const sf::Transform& transform, const sf::FloatRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Restores the clipping from before the last call to pushClip
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void popClip();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all commands, the memory for the vertices is kept to be reused
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Gives access to an empty list that draw functions can use to record their commands, which is reused to avoid allocations.
+        // Each object gets its own list while it exists, so that widgets can still be drawn while another list is being executed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API ScratchList
+        {
+        public:
+            ScratchList();
+            ~ScratchList();
+
+            ScratchList(const ScratchList&) = delete;
+            ScratchList& operator=(const ScratchList&) = delete;
+
+            RenderCommandList& get() const
+            {
+                return m_commands;
+            }
+
+        private:
+            RenderCommandList& m_commands;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the recorded commands
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Command>& getCommands() const
+        {
+            return m_commands;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the triangle vertices that are used by the Quad, TexturedQuad and GlyphAtlasTriangles commands
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::Vertex>& getVertices() const
+        {
+            return m_vertices;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texts that are used by the GlyphRun and GlyphAtlasTriangles commands
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<GlyphRun>& getGlyphRuns() const
+        {
+            return m_glyphRuns;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Adds vertices to the last command when it has the same type and texture, otherwise a new command is started
+        void addTriangles(Command::Type type, const std::shared_ptr<const TextureData>& texture, std::size_t vertexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<Command> m_commands;
+        std::vector<sf::Vertex> m_vertices;
+        std::vector<GlyphRun> m_glyphRuns;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Base class for objects that execute the recorded drawing commands
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RenderBackend
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Virtual destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~RenderBackend() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the commands in the list
+        ///
+        /// @param commands  List of commands to execute
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void render(const RenderCommandList& commands) = 0;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render backend that draws on an SFML render target
+    ///
+    /// Consecutive commands that use the same texture are drawn with a single draw call, which includes the text of all widgets
+    /// that were recorded after each other when distance field text is enabled.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API SfmlRenderBackend : public RenderBackend
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param target  Render target on which the commands will be executed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit SfmlRenderBackend(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor, which restores the clipping if the commands didn't pop all clipping rectangles
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~SfmlRenderBackend();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the commands in the list on the render target
+        ///
+        /// @param commands  List of commands to execute
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void render(const RenderCommandList& commands) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls that were made on the render target since this object was created
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDrawCallCount() const
+        {
+            return m_drawCallCount;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::RenderTarget& m_target;
+        std::vector<std::unique_ptr<Clipping>> m_clipping;
+        std::size_t m_drawCallCount = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDER_BACKEND_HPP
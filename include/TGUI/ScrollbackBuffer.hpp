@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_SCROLLBACK_BUFFER_HPP
+#define TGUI_SCROLLBACK_BUFFER_HPP
+
+
+#include <TGUI/Global.hpp>
+
+#include <cstdio>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Compact append-only storage for the lines of a chat box.
+        // The text is stored as UTF-8, either in memory or in a temporary file. For every line only a small record is kept
+        // in memory, which contains the offset of the text, the line properties and the height that the line needs.
+        // The heights are also summed per block of lines, so that finding the line at a certain height doesn't need to
+        // look at every line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API ScrollbackBuffer
+        {
+        public:
+
+            // When useFile is true then the text is written to a temporary file that is deleted when no longer needed
+            explicit ScrollbackBuffer(bool useFile = false);
+
+            ScrollbackBuffer(const ScrollbackBuffer& copy);
+
+            ScrollbackBuffer& operator=(const ScrollbackBuffer& right);
+
+            ~ScrollbackBuffer();
+
+            // Returns whether the text is stored in a file instead of in memory
+            bool isUsingFile() const;
+
+            // Adds a line at the end of the buffer
+            void append(const sf::String& text, const sf::Color& color, unsigned int textSize, const std::shared_ptr<sf::Font>& font, float height);
+
+            // Removes lines. The text remains in the buffer until enough removed text exists to make compacting it worthwhile.
+            void remove(std::size_t index, std::size_t count = 1);
+
+            // Removes all lines
+            void clear();
+
+            std::size_t getLineCount() const;
+
+            sf::String getText(std::size_t index) const;
+            sf::Color getColor(std::size_t index) const;
+            unsigned int getTextSize(std::size_t index) const;
+            std::shared_ptr<sf::Font> getFont(std::size_t index) const;
+
+            float getHeight(std::size_t index) const;
+            void setHeight(std::size_t index, float height);
+
+            // Gives the lines that were added without a font the new font
+            void replaceMissingFont(const std::shared_ptr<sf::Font>& font);
+
+            // Returns the sum of the heights of all lines
+            float getTotalHeight() const;
+
+            // Returns the sum of the heights of all lines in front of the given line
+            float getTopPosition(std::size_t index) const;
+
+            // Returns the index of the line that is displayed at the given height, or the line count when it lies below the last line
+            std::size_t findLine(float position) const;
+
+        private:
+
+            struct LineRecord
+            {
+                std::uint64_t offset;
+                std::uint32_t length;
+                sf::Uint32    color;
+                std::uint16_t textSize;
+                std::uint16_t fontIndex;
+                float         height;
+            };
+
+            void writeText(const std::basic_string<sf::Uint8>& text);
+
+            std::basic_string<sf::Uint8> readText(const LineRecord& record) const;
+
+            // Returns the index of the first line in the given block
+            std::size_t getFirstLineOfBlock(std::size_t block) const;
+
+            // Sums the heights again, starting from the given block
+            void recalculateBlockHeights(std::size_t firstBlock);
+
+            void compact();
+
+        private:
+
+            std::deque<LineRecord> m_records;
+            std::deque<double> m_blockHeights; // Sums are kept as double, so that removing lines doesn't make them drift
+
+            // Amount of removed lines at the front of the first block, so that removing the oldest lines doesn't move the others
+            std::size_t m_firstLineInBlock = 0;
+
+            std::vector<std::shared_ptr<sf::Font>> m_fonts;
+
+            std::vector<sf::Uint8> m_text;
+            std::FILE* m_file = nullptr;
+            std::uint64_t m_textSize = 0;
+            std::uint64_t m_usedTextSize = 0;
+
+            double m_totalHeight = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SCROLLBACK_BUFFER_HPP
@@ -32,9 +32,11 @@
 
 #include <map>
 #include <deque>
+#include <mutex>
 #include <memory>
 #include <cassert>
 #include <functional>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -48,11 +50,79 @@ namespace tgui
     template <typename... Types>
     struct TypeSet;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Decides when a signal handler gets called after the widget has send the signal
+    ///
+    /// The delayed handlers are called from Gui::updateTime of the gui that contains the widget, with the values of the last time
+    /// the signal was send.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class SignalDelivery
+    {
+        Immediate, ///< The handler is called every time the signal is send (default)
+        Coalesce,  ///< The handler is called at most once per frame, with the last values that were send during that frame
+        Debounce,  ///< The handler is called once the signal hasn't been send again for the given duration
+        Throttle   ///< The handler is called at most once per duration, the last values are delivered at the end of the period
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     namespace priv
     {
-        extern TGUI_API std::deque<const void*> data;
+        // Returns the parameters of the signal that is being send on the calling thread
+        TGUI_API std::deque<const void*>& getSignalData();
+
+        // Returns the queue in which signals are stored instead of being send, or nullptr when signals are send immediately.
+        // The queue is only set on threads that update widgets in parallel, the signals are send later from the main thread.
+        TGUI_API std::vector<std::function<void()>>*& getDeferredSignals();
+
+        class DelayedSignalQueue;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // A signal handler that isn't called immediately. It remembers the last call until it has to be made.
+        struct TGUI_API DelayedSignalHandler : public std::enable_shared_from_this<DelayedSignalHandler>
+        {
+            DelayedSignalHandler(const std::function<void()>& func, SignalDelivery signalDelivery, sf::Time signalDuration);
+
+            // Called when the signal is send. The call contains a copy of the parameters of the signal.
+            // The handler is added to the given queue, which will make the call when it is delivered.
+            void queue(std::function<void()>&& call, const std::shared_ptr<DelayedSignalQueue>& target);
+
+            // Advances the time and makes the pending call when it is time to do so.
+            // Returns false when the handler no longer has to be updated.
+            bool update(sf::Time elapsedTime);
+
+            std::function<void()> function;
+            SignalDelivery delivery;
+            sf::Time duration;
+
+            std::function<void()> pendingCall;
+            sf::Time elapsed;
+            bool throttling = false;
+            std::weak_ptr<DelayedSignalQueue> registeredQueue;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The delayed handlers that still have to be updated. Every gui has its own queue which it delivers in updateTime,
+        // widgets that aren't part of a gui use the global queue that is delivered by Signal::deliverDelayedSignals.
+        class TGUI_API DelayedSignalQueue
+        {
+        public:
+
+            // Makes sure the handler is updated when the queue is delivered
+            void add(const std::shared_ptr<DelayedSignalHandler>& handler);
+
+            // Updates all handlers in the queue and makes the calls that have to be made by now
+            void deliver(sf::Time elapsedTime);
+
+        private:
+
+            // Only the global queue can be used from multiple threads
+            std::mutex m_mutex;
+            std::vector<std::weak_ptr<DelayedSignalHandler>> m_handlers;
+        };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -136,9 +206,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         template <typename Type>
-        const Type& dereference(const void* obj)
+        const Type& dereference(std::size_t argPos)
         {
-            return *static_cast<const Type*>(obj);
+            return *static_cast<const Type*>(getSignalData()[argPos]);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -166,7 +236,7 @@ namespace tgui
         {
             static std::function<void()> connect(Func func, std::size_t argPos, Args... args)
             {
-                return std::bind(func, args..., std::bind(dereference<Type>, std::cref(data[argPos])));
+                return std::bind(func, args..., std::bind(dereference<Type>, argPos));
             }
         };
 
@@ -176,8 +246,8 @@ namespace tgui
             static std::function<void()> connect(Func func, std::size_t argPos, Args... args)
             {
                 return std::bind(func, args...,
-                                 std::bind(dereference<TypeA>, std::cref(data[argPos])),
-                                 std::bind(dereference<TypeB>, std::cref(data[argPos+1])));
+                                 std::bind(dereference<TypeA>, argPos),
+                                 std::bind(dereference<TypeB>, argPos+1));
             }
         };
 
@@ -242,19 +312,26 @@ namespace tgui
         Signal(std::vector<std::vector<std::string>>&& types);
 
         template <typename Func, typename... Args>
-        void connect(unsigned int id, Func func, Args... args)
+        unsigned int connect(Func func, Args... args)
         {
             using type = typename priv::isFunctionConvertible<Func, decltype(priv::bindRemover<Args>::remove(args))...>::type;
             static_assert(!std::is_same<type, TypeSet<void>>::value, "Parameters passed to the connect function are wrong!");
 
             auto argPos = checkCompatibleParameterType<type>();
-            m_functions[id] = priv::connector<type, Func, Args...>::connect(func, argPos, args...);
+            auto function = priv::connector<type, Func, Args...>::connect(func, argPos, args...);
+
+            // The id is only taken when the connection succeeded
+            const unsigned int id = generateId();
+            m_functions[id] = std::move(function);
+            return id;
         }
 
         template <typename Func, typename... Args>
-        void connectEx(unsigned int id, Func func, Args... args)
+        unsigned int connectEx(Func func, Args... args)
         {
+            const unsigned int id = generateId();
             m_functionsEx[id] = std::bind(func, args..., std::placeholders::_1);
+            return id;
         }
 
         bool disconnect(unsigned int id);
@@ -263,17 +340,81 @@ namespace tgui
 
         bool isEmpty() const;
 
+        // Returns the amount of connected handlers, including the ones connected with connectEx
+        std::size_t getHandlerCount() const;
+
+        // Changes when the handler with the given id is called. Returns false when there is no such handler.
+        bool setDelivery(unsigned int id, SignalDelivery delivery, sf::Time duration);
+
+        // Gives the copied signal its own delayed handlers, so that they no longer share pending calls with the original
+        void separateDelayedHandlers();
+
+        // Calls the delayed handlers of widgets that aren't part of a gui and that have to be called by now.
+        // The handlers of widgets inside a gui are called from Gui::updateTime instead.
+        static void deliverDelayedSignals(sf::Time elapsedTime);
+
+        // Returns the queue of the delayed handlers of widgets that aren't part of a gui
+        static std::shared_ptr<priv::DelayedSignalQueue> getGlobalDelayedSignalQueue();
+
+        // Returns whether some handlers are only called when the delayed signals are delivered
+        bool hasDelayedHandlers() const
+        {
+            return !m_delayedFunctions.empty();
+        }
+
+        // Calls the handlers. The delayed handlers are added to the queue, which may only be a nullptr when there are none.
+        template <typename... Args>
+        void emit(const std::shared_ptr<priv::DelayedSignalQueue>& queue, const Args&... args)
+        {
+            // Copy the delayed handlers in case an immediate handler destroys the widget to which this Signal instance belongs
+            auto delayedFunctions = m_delayedFunctions;
+
+            if (!m_functions.empty())
+                (*this)(0, args...);
+
+            for (const auto& handler : delayedFunctions)
+            {
+                auto function = handler.second->function;
+                handler.second->queue([=]() {
+                    setSignalData(0, args...);
+                    function();
+                }, queue);
+            }
+        }
+
         void operator()(unsigned int count);
 
         template <typename T, typename... Args>
         void operator()(unsigned int count, const T& value, Args... args)
         {
-            priv::data[count] = static_cast<const void*>(&value);
+            auto& data = priv::getSignalData();
+            if (count >= data.size())
+                data.resize(count+1, nullptr);
+
+            data[count] = static_cast<const void*>(&value);
             (*this)(count+1, args...);
         }
 
     protected:
 
+        // Returns a new connection id, which is unique over all widgets and threads
+        static unsigned int generateId();
+
+        static void setSignalData(std::size_t)
+        {
+        }
+
+        template <typename T, typename... Args>
+        static void setSignalData(std::size_t pos, const T& value, const Args&... args)
+        {
+            auto& data = priv::getSignalData();
+            if (pos >= data.size())
+                data.resize(pos+1, nullptr);
+
+            data[pos] = static_cast<const void*>(&value);
+            setSignalData(pos+1, args...);
+        }
+
         template <typename Type>
         std::size_t checkCompatibleParameterType()
         {
@@ -299,6 +440,7 @@ namespace tgui
 
         std::map<unsigned int, std::function<void()>> m_functions;
         std::map<unsigned int, std::function<void(const Callback&)>> m_functionsEx;
+        std::map<unsigned int, std::shared_ptr<priv::DelayedSignalHandler>> m_delayedFunctions;
 
         std::vector<std::vector<std::string>> m_allowedTypes;
 
@@ -340,6 +482,13 @@ namespace tgui
         SignalWidgetBase& operator=(const SignalWidgetBase& right);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~SignalWidgetBase() = default;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Connects a signal handler function to one or more signals
         ///
@@ -357,13 +506,13 @@ namespace tgui
             if (signalNameList.empty())
                 throw Exception{"connect function called with empty string"};
 
+            unsigned int id = 0;
             for (auto& signalName : signalNameList)
             {
                 if (m_signals.find(toLower(signalName)) != m_signals.end())
                 {
                     try {
-                        m_signals[toLower(signalName)]->connect(m_lastId, func, args...);
-                        m_lastId++;
+                        id = m_signals[toLower(signalName)]->connect(func, args...);
                     }
                     catch (const Exception& e) {
                         throw Exception{e.what() + (" The parameters are not valid for the '" + signalName + "' signal.")};
@@ -380,8 +529,7 @@ namespace tgui
                         for (auto& signal : m_signals)
                         {
                             try {
-                                signal.second->connect(m_lastId, func, args...);
-                                m_lastId++;
+                                id = signal.second->connect(func, args...);
                             }
                             catch (const Exception& e) {
                                 throw Exception{e.what() + (" The parameters are not valid for the '" + signalName + "' signal.")};
@@ -391,7 +539,7 @@ namespace tgui
                 }
             }
 
-            return m_lastId - 1;
+            return id;
         }
 
 
@@ -414,13 +562,17 @@ namespace tgui
             if (signalNameList.empty())
                 throw Exception{"connect function called with empty string"};
 
+            // The callback object is only needed by these legacy handlers, so it is only created now
+            if (!m_callback)
+                createCallback();
+
+            unsigned int id = 0;
             for (auto& name : signalNameList)
             {
                 if (m_signals.find(toLower(name)) != m_signals.end())
                 {
                     try {
-                        m_signals[toLower(name)]->connectEx(m_lastId, func, args...);
-                        m_lastId++;
+                        id = m_signals[toLower(name)]->connectEx(func, args...);
                     }
                     catch (const Exception& e) {
                         throw Exception{e.what() + (" since it is not valid for the '" + name + "' signal.")};
@@ -437,8 +589,7 @@ namespace tgui
                         for (auto& signal : m_signals)
                         {
                             try {
-                                signal.second->connectEx(m_lastId, func, args...);
-                                m_lastId++;
+                                id = signal.second->connectEx(func, args...);
                             }
                             catch (const Exception& e) {
                                 throw Exception{e.what() + (" since it is not valid for the '" + name + "' signal.")};
@@ -448,7 +599,7 @@ namespace tgui
                 }
             }
 
-            return m_lastId - 1;
+            return id;
         }
 
 
@@ -478,6 +629,41 @@ namespace tgui
         void disconnectAll();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes when a signal handler is called
+        ///
+        /// @param id        The id that was returned by the connect function when this connection was made
+        /// @param delivery  When the handler should be called after the signal was send
+        /// @param duration  Time used by the Debounce and Throttle modes
+        ///
+        /// This can be used to avoid that expensive handlers are called on every intermediate value, e.g. while a slider is
+        /// being dragged. Delayed handlers are called from Gui::updateTime of the gui containing the widget, with the values that
+        /// were send last.
+        ///
+        /// @code
+        /// slider->setSignalDelivery(slider->connect("ValueChanged", updateChart), tgui::SignalDelivery::Throttle, sf::milliseconds(100));
+        /// @endcode
+        ///
+        /// @throw Exception when there is no handler with the given id.
+        ///        Handlers that were connected with connectEx are always called immediately.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSignalDelivery(unsigned int id, SignalDelivery delivery, sf::Time duration = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of handlers that are connected to a signal
+        ///
+        /// @param signalName  Name of the signal
+        ///
+        /// @return Number of connected handlers, including the ones that the library connected itself (e.g. for layouts)
+        ///
+        /// @throw Exception when the signal doesn't exist
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSignalHandlerCount(const std::string& signalName) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -507,22 +693,57 @@ namespace tgui
             assert(m_signals[toLower(name)] != nullptr);
             auto& signal = *m_signals[toLower(name)];
 
+            // During a parallel update the handlers are called later, with a copy of the signal and the parameters
+            auto deferredSignals = priv::getDeferredSignals();
+            if (deferredSignals)
+            {
+                if (signal.isEmpty() && signal.m_functionsEx.empty())
+                    return;
+
+                Signal signalCopy = signal;
+                Callback callback;
+                if (m_callback)
+                {
+                    callback = *m_callback;
+                    callback.trigger = name;
+                }
+
+                // The widget may no longer be in the same gui by the time the signal is send
+                std::shared_ptr<priv::DelayedSignalQueue> queue;
+                if (signal.hasDelayedHandlers())
+                    queue = getDelayedSignalQueue();
+
+                deferredSignals->push_back([=]() mutable {
+                    for (const auto& function : signalCopy.m_functionsEx)
+                        function.second(callback);
+
+                    if (!signalCopy.isEmpty())
+                        signalCopy.emit(queue, args...);
+                });
+                return;
+            }
+
+            std::shared_ptr<priv::DelayedSignalQueue> queue;
+            if (signal.hasDelayedHandlers())
+                queue = getDelayedSignalQueue();
+
             if (signal.m_functionsEx.empty())
             {
                 if (!signal.isEmpty())
-                    signal(0, args...);
+                    signal.emit(queue, args...);
             }
             else // Legacy functions are used
             {
                 // Copy signal to avoid problems with lifetime when signal handler destroys this object
                 Signal signalCopy = signal;
 
-                m_callback.trigger = name;
+                assert(m_callback != nullptr);
+                m_callback->trigger = std::move(name);
                 for (const auto& function : signalCopy.m_functionsEx)
-                    function.second(m_callback);
+                    function.second(*m_callback);
 
                 if (!signalCopy.isEmpty())
-                    signalCopy(0, args...);
+                    signalCopy.emit(queue, args...);
             }
         }
 
@@ -532,14 +753,29 @@ namespace tgui
 
         std::vector<std::string> extractSignalNames(std::string input);
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the callback object that is passed to the handlers connected with connectEx.
+        // Derived classes fill in the members that aren't set right before sending a signal.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void createCallback();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the queue that delivers the delayed signal handlers of this widget.
+        // This is the queue of the gui that contains the widget, or the global queue when the widget isn't part of a gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<priv::DelayedSignalQueue> getDelayedSignalQueue() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         std::map<std::string, std::shared_ptr<Signal>> m_signals;
 
-        static unsigned int m_lastId;
+        // Only exists when a handler was connected with connectEx
+        std::unique_ptr<Callback> m_callback;
 
-        Callback m_callback;
+        friend class LayoutImpl; // Keeps track of the signals to which it connected handlers
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,164 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_SOFTWARE_RENDER_BACKEND_HPP
+#define TGUI_SOFTWARE_RENDER_BACKEND_HPP
+
+#include <TGUI/RenderBackend.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render backend that rasterizes the commands on the CPU, without requiring an OpenGL context
+    ///
+    /// One unit in the commands is one pixel, with (0,0) at the top left corner of the image.
+    /// Pixels are covered when their center lies inside a triangle. Textures are sampled without filtering and colors are
+    /// blended in the same way as sf::BlendAlpha. The results are therefore exactly the same on every machine, which makes
+    /// this backend suitable for thumbnails, tests and benchmarks on machines without a graphics card.
+    /// Textures are read from the images that were loaded for them, so no texture is ever created on the graphics card.
+    /// Text is only rendered when distance field text is enabled. When TGUI is built with TGUI_USE_FREETYPE, the glyphs of the
+    /// default font and of fonts loaded from theme files are rasterized on the CPU as well. Other fonts still need OpenGL,
+    /// unless their file is passed to priv::DistanceFieldFont::setFontFile.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API SoftwareRenderBackend : public RenderBackend
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param width   Width of the image to render to
+        /// @param height  Height of the image to render to
+        ///
+        /// All pixels are initially transparent.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SoftwareRenderBackend(unsigned int width, unsigned int height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the whole image with a single color
+        ///
+        /// @param color  Color to give to all pixels
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear(const sf::Color& color = sf::Color::Transparent);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes the commands in the list on top of the current contents of the image
+        ///
+        /// @param commands  List of commands to execute
+        ///
+        /// @throw Exception when the list contains a widget that can only be drawn with its draw function
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void render(const RenderCommandList& commands) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the image
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2u getSize() const
+        {
+            return m_size;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color of a single pixel
+        ///
+        /// @param x  Horizontal position of the pixel
+        /// @param y  Vertical position of the pixel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Color getPixel(unsigned int x, unsigned int y) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixels of the image, stored row by row with four bytes (RGBA) per pixel
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::Uint8>& getPixels() const
+        {
+            return m_pixels;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copies the pixels into an image, e.g. to save it to a file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Image copyToImage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Pixel bounds that are drawn to, the right and bottom are not included
+        struct ClipRect
+        {
+            int left;
+            int top;
+            int right;
+            int bottom;
+        };
+
+        // Returns the color of a pixel inside a triangle, based on the interpolated vertex color and texture coordinates
+        using Shader = sf::Color (*)(const void* data, sf::Color color, sf::Vector2f texCoords);
+
+        // Rasterizes a text of which the glyphs weren't stored in the command list
+        void renderGlyphRun(const RenderCommandList::GlyphRun& glyphRun);
+
+        // Fills triangles with texture coordinates in the glyph atlas. The atlas mutex has to be locked.
+        void fillGlyphTriangles(const sf::Vertex* vertices, std::size_t vertexCount);
+
+        // Fills the pixels of which the center lies inside the triangle
+        void fillTriangle(sf::Vertex a, sf::Vertex b, sf::Vertex c, Shader shader, const void* shaderData);
+
+        // Blends a color on top of a pixel
+        void blend(unsigned int x, unsigned int y, sf::Color color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::Vector2u m_size;
+        std::vector<sf::Uint8> m_pixels;
+        std::vector<ClipRect> m_clipping;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SOFTWARE_RENDER_BACKEND_HPP
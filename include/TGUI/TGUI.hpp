@@ -31,9 +31,16 @@
 #include <TGUI/Animation.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/Context.hpp>
 #include <TGUI/HorizontalLayout.hpp>
+#include <TGUI/InternedString.hpp>
+#include <TGUI/FlexLayout.hpp>
 #include <TGUI/VerticalLayout.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/EventReplayer.hpp>
+#include <TGUI/RadioButtonGroup.hpp>
+#include <TGUI/RenderBackend.hpp>
+#include <TGUI/SoftwareRenderBackend.hpp>
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
@@ -226,7 +226,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         sf::Vector2f getImageSize() const
         {
-            return sf::Vector2f{m_data->texture.getSize()};
+            return sf::Vector2f{m_data->size};
         }
 
 
@@ -321,7 +321,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isSmooth() const
         {
-            return m_data->texture.isSmooth();
+            return m_data->isSmooth();
         }
 
 
@@ -436,11 +436,23 @@ namespace tgui
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the vertices of the internal vertex array
+        // Update the vertices of the texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateVertices();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates how positions on the scaled texture are mapped back to pixels in the image
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updatePixelMapping();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the positions and texture coordinates of the vertices for the current scaling type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void calculateGeometry();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draws the texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -449,9 +461,30 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    private:
+
+        // Maps a coordinate on one axis of the scaled texture back to a pixel of the image, for each of the (at most) three
+        // parts in which the axis is split. The pixel is 'offset + (position - start) / divisor * multiplier'.
+        struct PixelMapping
+        {
+            struct Part
+            {
+                float start;
+                float offset;
+                float divisor;
+                float multiplier;
+            };
+
+            unsigned int map(float position) const;
+
+            float middleStart;
+            float endStart;
+            Part parts[3];
+        };
+
     private:
         std::shared_ptr<TextureData> m_data = std::make_shared<TextureData>();
-        std::vector<sf::Vertex> m_vertices;
+        priv::TextureGeometry m_geometry;
 
         sf::Vector2f  m_size;
         sf::IntRect   m_middleRect;
@@ -460,6 +493,9 @@ namespace tgui
 
         ScalingType   m_scalingType = ScalingType::Normal;
 
+        PixelMapping  m_pixelMappingX{};
+        PixelMapping  m_pixelMappingY{};
+
         bool m_loaded = false;
         std::string m_id;
 
@@ -467,6 +503,8 @@ namespace tgui
         std::function<void(std::shared_ptr<TextureData>)> m_destructCallback;
         static TextureLoaderFunc m_textureLoader;
         static ImageLoaderFunc m_imageLoader;
+
+        friend class RenderCommandList;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,7 +35,9 @@
 #include <SFML/Graphics/Rect.hpp>
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,8 +49,36 @@ namespace tgui
     struct TGUI_API TextureData
     {
         std::shared_ptr<sf::Image> image;
-        sf::Texture   texture;
         sf::IntRect   rect;
+
+        // Size of the part of the image that is used, which is the whole image when rect is empty
+        sf::Vector2u  size;
+
+        // Alpha mask of the image inside rect. It is created when the texture is loaded, so that it is never written to once
+        // the data is shared between textures (which may be used on different threads).
+        std::vector<bool> transparentPixels;
+
+        // Sets the image and the part of it that is used. The part is limited to the image in the same way as sf::Texture does.
+        // Returns false when the part is empty.
+        bool setImage(std::shared_ptr<sf::Image> newImage, const sf::IntRect& partRect);
+
+        // Returns the texture that is used to draw with OpenGL. It is only created from the image the first time that it is
+        // needed, so that images can be loaded and rendered with the software render backend without an OpenGL context.
+        const sf::Texture& getTexture() const;
+
+        // Uses a copy of an existing texture instead of creating one from the image when it is needed
+        void setTexture(const sf::Texture& texture);
+
+        // Changes the smooth filter of the texture, which is also remembered when the texture doesn't exist yet
+        void setSmooth(bool smooth);
+        bool isSmooth() const;
+
+    private:
+
+        mutable std::mutex  m_textureMutex;
+        mutable sf::Texture m_texture;
+        mutable bool        m_textureCreated = false;
+        bool                m_smooth = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -62,6 +92,24 @@ namespace tgui
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        // Fills the transparentPixels of the data, based on the image and the size of the texture
+        TGUI_API void createTransparentPixelMask(TextureData& data);
+
+        // Positions and texture coordinates of the vertices of a Texture, the color is only added when drawing
+        struct TGUI_API TextureGeometry
+        {
+            static const std::size_t MaxVertices = 22;
+
+            sf::Vector2f positions[MaxVertices];
+            sf::Vector2f texCoords[MaxVertices];
+            std::size_t vertexCount = 0;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
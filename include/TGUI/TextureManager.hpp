@@ -31,8 +31,6 @@
 #include <TGUI/TextureData.hpp>
 #include <TGUI/Config.hpp>
 
-#include <list>
-#include <map>
 #include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,9 +80,29 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    protected:
+        /// @brief Provides an image that was already decoded, so that getTexture doesn't have to load it again
+        ///
+        /// @param filename  Filename of the image, exactly as it will be passed to getTexture
+        /// @param image     The decoded image
+        ///
+        /// The image is used until removePreloadedImage is called as many times as this function was called for the filename.
+        /// This allows decoding images on other threads while the textures are still created on the thread that needs them.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addPreloadedImage(const std::string& filename, std::shared_ptr<sf::Image> image);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops using an image that was passed to addPreloadedImage
+        ///
+        /// @param filename  Filename of the image
+        ///
+        /// Textures that were already created from the image are not affected.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removePreloadedImage(const std::string& filename);
 
-        static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,104 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_UPDATE_POOL_HPP
+#define TGUI_UPDATE_POOL_HPP
+
+
+#include <TGUI/Global.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Worker threads that are used by the gui to update independent widgets at the same time.
+        // The calling thread helps executing the tasks, so a pool with a thread count of 1 has no worker threads at all.
+        // Idle threads take the next task that hasn't been started yet, so that a few slow tasks don't keep the other
+        // threads waiting.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API UpdatePool
+        {
+        public:
+
+            // Starts the worker threads. When threadCount is 0, the amount of hardware threads is used.
+            explicit UpdatePool(unsigned int threadCount = 0);
+
+            // Stops the worker threads
+            ~UpdatePool();
+
+            UpdatePool(const UpdatePool&) = delete;
+            UpdatePool& operator=(const UpdatePool&) = delete;
+
+            // Returns the amount of threads that execute tasks, including the calling thread
+            unsigned int getThreadCount() const;
+
+            // Calls task(i) for every i between 0 and taskCount and waits until all of them are finished.
+            // The first exception thrown by a task is passed on after all tasks are done.
+            void run(std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+        private:
+
+            void workerLoop();
+
+            void executeTasks();
+
+        private:
+
+            std::vector<std::thread> m_threads;
+
+            std::mutex m_mutex;
+            std::condition_variable m_startCondition;
+            std::condition_variable m_finishedCondition;
+
+            const std::function<void(std::size_t)>* m_task = nullptr;
+            std::size_t m_taskCount = 0;
+            std::atomic<std::size_t> m_nextTask;
+
+            unsigned int m_generation = 0;
+            unsigned int m_busyWorkers = 0;
+            bool m_stopping = false;
+
+            std::exception_ptr m_exception;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_UPDATE_POOL_HPP
@@ -41,6 +41,7 @@ namespace tgui
 {
     class BaseTheme;
     class Container;
+    class RenderCommandList;
     class WidgetRenderer;
 
     enum class ShowAnimationType;
@@ -50,6 +51,49 @@ namespace tgui
     }
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Type of the widget, which can be compared a lot faster than the string returned by getWidgetType
+    ///
+    /// Custom widgets that don't set a type will have the Unknown type.
+    ///
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class WidgetType
+    {
+        Unknown,
+        Button,
+        Canvas,
+        ChatBox,
+        CheckBox,
+        ChildWindow,
+        ClickableWidget,
+        ComboBox,
+        EditBox,
+        FlexLayout,
+        Grid,
+        GuiContainer,
+        HorizontalLayout,
+        Knob,
+        Label,
+        ListBox,
+        MenuBar,
+        MessageBox,
+        Panel,
+        Picture,
+        ProgressBar,
+        RadioButton,
+        RichTextLabel,
+        Scrollbar,
+        Slider,
+        SpinButton,
+        Tab,
+        Table,
+        TableItem,
+        TableRow,
+        TextBox,
+        VerticalLayout
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief The parent class for every widget.
     ///
@@ -326,7 +370,21 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::string& getWidgetType() const
         {
-            return m_callback.widgetType;
+            return *m_widgetType;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the type of the widget as an enum value.
+        ///
+        /// @return Type of the widget, or WidgetType::Unknown for custom widgets
+        ///
+        /// Use this function instead of getWidgetType when you only need to check the type of the widget.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WidgetType getWidgetTypeId() const
+        {
+            return m_widgetTypeId;
         }
 
 
@@ -491,6 +549,17 @@ namespace tgui
         virtual void update(sf::Time elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the next call to update will use resources that are shared with other widgets, like the font.
+        /// Such widgets are never updated on a worker thread when the gui updates its widgets in parallel.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateUsingSharedResources() const
+        {
+            return false;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -568,6 +637,20 @@ namespace tgui
         virtual Widget::Ptr clone() const = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the widget, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent, the same as the one that would be passed to the draw function
+        ///
+        /// All built-in widgets except Canvas record their drawing commands. The default implementation records the widget
+        /// itself, so that a custom widget that only implements the draw function can still be drawn by the SFML backend.
+        /// A custom widget that overrides the draw function of a built-in widget has to override this function as well.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -597,6 +680,13 @@ namespace tgui
         virtual void reload(const std::string& primary = "", const std::string& secondary = "", bool force = false);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widget by recording its commands and executing them on the render target. Widgets that implement
+        // emitRenderCommands call this from their draw function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRenderCommands(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when the mouse enters the widget. If requested, a callback will be send.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -615,6 +705,26 @@ namespace tgui
         bool isDisabledBlockingMouseEvents() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the type of the widget. The type name is stored once per type instead of in every widget.
+        // Custom widgets can pass their own name, their type id will be WidgetType::Unknown.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetType(WidgetType type);
+        void setWidgetType(const std::string& type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the callback object for the legacy signal handlers and fills in the widget data
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void createCallback() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the queue of the gui that contains the widget, the delayed signal handlers are called from its updateTime
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<priv::DelayedSignalQueue> getDelayedSignalQueue() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -627,6 +737,12 @@ namespace tgui
         // Is the widget visible? When it is invisible it will not receive events and it won't be drawn.
         bool m_visible = true;
 
+        // The type of the widget, to avoid string comparisons with the type name
+        WidgetType m_widgetTypeId = WidgetType::Unknown;
+
+        // The name of the widget type, shared by all widgets of the same type
+        const std::string* m_widgetType;
+
         // This will point to our parent widget. If there is no parent then this will be nullptr.
         Container* m_parent = nullptr;
 
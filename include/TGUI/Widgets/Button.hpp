@@ -227,6 +227,16 @@ namespace tgui
         virtual void widgetFocused() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the button, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -254,6 +264,12 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the callback object for the legacy signal handlers and fills in the button text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void createCallback() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when the mouse enters the widget. If requested, a callback will be send.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -493,9 +509,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Draws the widget on the render target.
+        // Records the commands to draw the widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        void emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
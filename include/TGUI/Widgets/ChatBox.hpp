@@ -30,6 +30,7 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/ScrollbackBuffer.hpp>
 
 #include <deque>
 
@@ -50,6 +51,16 @@ namespace tgui
         typedef std::shared_ptr<const ChatBox> ConstPtr; ///< Shared constant widget pointer
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the chat box, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -303,6 +314,35 @@ namespace tgui
         std::size_t getLineLimit();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the lines are stored in a compact scrollback buffer
+        ///
+        /// @param enabled     Should only the displayed lines be kept as drawable text?
+        /// @param spillToDisk Should the text of the lines be written to a temporary file instead of being kept in memory?
+        ///
+        /// Normally every line keeps its drawable text, which takes a lot of memory when a chat box is used as a log without
+        /// line limit. With the scrollback buffer only a small record is kept for every line and the drawable text is only
+        /// created for the lines that are visible. When spillToDisk is true, only these records remain in memory.
+        ///
+        /// While the scrollback buffer is used, new lines are always added below the other lines.
+        /// Changing the size or font of the chat box requires all lines to be read again, which is slow when there are
+        /// millions of lines.
+        ///
+        /// @throw Exception when spillToDisk is true and the temporary file could not be created
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setScrollbackEnabled(bool enabled, bool spillToDisk = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the lines are stored in a compact scrollback buffer
+        ///
+        /// @return Is the scrollback buffer used?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isScrollbackEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the default font of the text.
         ///
@@ -505,6 +545,24 @@ namespace tgui
         void recalculateLineText(Line& line);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the height that the line needs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getLineHeight(const Line& line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the drawable text for a line from the scrollback buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Line materializeLine(const priv::ScrollbackBuffer& scrollback, std::size_t lineIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that m_lines contains exactly the lines from the scrollback buffer between first and end
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void materializeLines(std::size_t first, std::size_t end);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates all text attributes, recalculate the full text height and update the displayed text
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -579,6 +637,10 @@ namespace tgui
 
         std::deque<Line> m_lines;
 
+        // When the scrollback buffer is used, it contains all lines and m_lines only contains the displayed lines
+        std::unique_ptr<priv::ScrollbackBuffer> m_scrollback;
+        std::size_t m_firstMaterializedLine = 0;
+
         friend class ChatBoxRenderer;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -694,9 +756,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Draws the widget on the render target.
+        // Records the commands to draw the widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        void emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,9 +147,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Draws the widget on the render target.
+        // Records the commands to draw the widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+        void emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -504,6 +504,16 @@ namespace tgui
         virtual void mouseNoLongerDown() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the child window and its child widgets, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -754,9 +764,9 @@ namespace tgui
         std::shared_ptr<ButtonRenderer> getMaximizeButton() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Draws the widget on the render target.
+        // Records the commands to draw the widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        void emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -480,9 +480,32 @@ namespace tgui
         virtual void widgetUnfocused() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the edit box, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The kind of input validator that is being used. Only custom validators need a regex.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class ValidatorType
+        {
+            Any,
+            Int,
+            UInt,
+            Float,
+            Regex
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Reload the widget
         ///
@@ -517,6 +540,18 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Keeps the cached validator state up-to-date after characters were removed from the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void charactersErased(std::size_t pos, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks if the input validator allows inserting the character at the caret position.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCharacterAccepted(sf::Uint32 key) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the position of the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -559,8 +594,14 @@ namespace tgui
         sf::String    m_displayedText;
         sf::String    m_text;
 
+        // The input validator. The compiled regex is shared with all other edit boxes that use the same validator.
+        // The built-in validators don't need the regex, they check every inserted character against the cached state.
         std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        std::shared_ptr<const std::regex> m_regex;
+        ValidatorType m_validatorType = ValidatorType::Any;
+
+        // Index of the decimal point in the text (if there is one), needed by the Float validator
+        std::size_t   m_decimalPointPos = sf::String::InvalidPos;
 
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
@@ -835,9 +876,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Draws the widget on the render target.
+        // Records the commands to draw the widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        void emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
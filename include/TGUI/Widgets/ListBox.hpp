@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/InternedString.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -601,6 +602,16 @@ namespace tgui
         virtual void mouseNoLongerDown() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the list box, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -610,6 +621,12 @@ namespace tgui
         void updateItemColors();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item with the given id, or -1 when no item has this id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getItemIndexById(const sf::String& id) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Reload the widget
         ///
@@ -653,6 +670,9 @@ namespace tgui
         std::vector<Label>      m_items;
         std::vector<sf::String> m_itemIds;
 
+        // The same ids as in m_itemIds, interned so that searching an item by id only has to compare pointers
+        std::vector<InternedString> m_internedItemIds;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
@@ -849,9 +869,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Draws the widget on the render target.
+        // Records the commands to draw the widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        void emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +142,16 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the panel and its child widgets, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,6 +186,13 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Records the commands to draw the background and the borders. The transform already includes the panel position.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void emitBackgroundCommands(RenderCommandList& commands, const sf::Transform& transform) const;
+        void emitBorderCommands(RenderCommandList& commands, const sf::Transform& transform) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Widgets/Label.hpp>
+#include <TGUI/RadioButtonGroup.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +65,32 @@ namespace tgui
         RadioButton();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        ///
+        /// The copy is placed in the same group as the original radio button. When the original was checked, the copy
+        /// only takes over the checked state of the group once it is added to a container.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RadioButton(const RadioButton& copy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~RadioButton();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of assignment operator
+        ///
+        /// The radio button will no longer be part of a group after the assignment.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RadioButton& operator= (const RadioButton& right);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates a new radio button widget
         ///
@@ -147,7 +174,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Checks the radio button.
         ///
-        /// It will tell its parent to uncheck all the other radio buttons.
+        /// The radio button in the same group that was checked before will be unchecked.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void check();
@@ -172,6 +199,32 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Places the radio button in a group, only one radio button in a group can be checked at the same time
+        ///
+        /// @param group  The new group of the radio button, or nullptr to use the group of the parent container
+        ///
+        /// By default all radio buttons inside the same container belong to the same group.
+        ///
+        /// The radio button has to be owned by a shared pointer (e.g. created with RadioButton::create) when it gets checked
+        /// while it is part of a group, because the group only keeps a weak pointer to its checked radio button.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGroup(const RadioButtonGroup::Ptr& group);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the group that was set with the setGroup function
+        ///
+        /// @return The group of the radio button, or nullptr when it uses the group of its parent container
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RadioButtonGroup::Ptr getGroup() const
+        {
+            return m_group;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the text of the radio button.
         ///
@@ -254,6 +307,24 @@ namespace tgui
         virtual void widgetFocused() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called when the widget is added to a container.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setParent(Container* parent) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the radio button, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -272,6 +343,24 @@ namespace tgui
         virtual void reload(const std::string& primary = "", const std::string& secondary = "", bool force = false) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the group in which the radio button has to be registered when it gets checked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RadioButtonGroup::Ptr getActiveGroup() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the active group that this radio button is checked, which will uncheck the previously checked radio button.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void joinActiveGroup();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the group in which the radio button was registered that it is no longer checked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void leaveActiveGroup();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -281,6 +370,12 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the callback object for the legacy signal handlers and fills in the checked state
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void createCallback() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when the mouse enters the widget. If requested, a callback will be send.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,6 +409,12 @@ namespace tgui
         // This will store the size of the text ( 0 to auto size )
         unsigned int m_textSize = 0;
 
+        // The group set by the user, when nullptr the group of the parent is used
+        RadioButtonGroup::Ptr m_group;
+
+        // The group that knows that this radio button is checked
+        RadioButtonGroup::Ptr m_checkedGroup;
+
         friend class RadioButtonRenderer;
         friend class CheckBoxRenderer;
 
@@ -606,9 +707,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Draws the widget on the render target.
+        // Records the commands to draw the widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        virtual void emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
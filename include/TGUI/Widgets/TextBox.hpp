@@ -29,6 +29,8 @@
 
 #include <TGUI/Widget.hpp>
 
+#include <iosfwd>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -36,6 +38,11 @@ namespace tgui
     class Scrollbar;
     class TextBoxRenderer;
 
+    namespace priv
+    {
+        class TextStreamLoader;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Text box widget
     ///
@@ -44,6 +51,8 @@ namespace tgui
     ///         * Optional parameter sf::String: current text in the text box
     ///         * Uses Callback member 'text'
     ///
+    ///     - TextLoaded (the text passed to loadTextFromFile or loadTextFromStream has been completely added)
+    ///
     ///     - Inherited signals from Widget
     ///
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,6 +190,43 @@ namespace tgui
         void addText(const sf::String& text);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the text of the text box with the contents of a file, which is loaded over the next frames.
+        ///
+        /// @param filename         Filename of the UTF-8 encoded text file to load
+        /// @param useWorkerThread  Should the file be read and decoded on a separate thread?
+        ///
+        /// @throw Exception when the file could not be opened
+        ///
+        /// Each time the widget is updated, the next chunk of the file is added to the text box and wrapped. Only the new lines
+        /// are measured, so the scrollbar grows while the rest of the file is still being loaded.
+        /// Calling setText or starting to load another file stops the loading. The TextLoaded signal is sent when done.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadTextFromFile(const std::string& filename, bool useWorkerThread = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the text of the text box with the contents of a stream, which is loaded over the next frames.
+        ///
+        /// @param stream           Stream containing UTF-8 encoded text, which the text box takes ownership of
+        /// @param useWorkerThread  Should the stream be read and decoded on a separate thread?
+        ///
+        /// @see loadTextFromFile
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadTextFromStream(std::unique_ptr<std::istream> stream, bool useWorkerThread = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text box is still loading text from a file or stream.
+        ///
+        /// @return Is there still text being loaded?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLoadingText() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the text of the text box.
         ///
@@ -380,6 +426,16 @@ namespace tgui
         virtual void widgetUnfocused() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the commands to draw the text box, so that it can be rendered by any render backend
+        ///
+        /// @param commands   List to which the commands are added
+        /// @param transform  Transformation of the parent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -417,11 +473,55 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Adds text behind the existing text. Only the last line and the new lines have to be wrapped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendText(const sf::String& text, bool keepSelection);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the text from the given index until the end into lines and adds them behind the existing lines.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void splitLines(std::size_t index, float maxLineWidth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts the positions in the text that were returned by findTextCaretPosition back to positions in the lines.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void restoreSelection(const std::pair<std::size_t, std::size_t>& textCaretPosition, bool keepSelection);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width that is available for a line, which depends on whether the scrollbar is visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaximumLineWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbar after lines were added or removed. Returns false when the text has to be rearranged because
+        // the scrollbar appeared or disappeared.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateScrollbarMaximum();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Scrolls to the caret and updates the text objects after the text or the selection changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the selection with the start in front of the end, limited to the lines that are in the text objects.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getDisplayedSelection(sf::Vector2<std::size_t>& selectionStart, sf::Vector2<std::size_t>& selectionEnd) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function will split the lines around the visible ones into five pieces so that the text can be easily drawn.
+        // Only these lines are put in the text objects, so that large texts don't have to be copied on every change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDisplayedText();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -431,6 +531,15 @@ namespace tgui
         virtual void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Text that is still being loaded is laid out with the font during the update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateUsingSharedResources() const override
+        {
+            return isLoadingText();
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Reload the widget
         ///
@@ -468,7 +577,45 @@ namespace tgui
         unsigned int m_textSize = 18;
         unsigned int m_lineHeight = 24;
 
-        std::vector<sf::String> m_lines = std::vector<sf::String>{""}; // Did not compile in VS2013 with just braces
+        // A line only stores which characters of m_text it contains
+        struct Line
+        {
+            std::size_t start;
+            std::size_t length;
+        };
+
+        // Gives access to the characters of a line without copying them out of m_text
+        class LineView
+        {
+        public:
+            LineView(const sf::String& text, const Line& line) : m_text(text), m_line(line) {}
+
+            std::size_t getSize() const { return m_line.length; }
+            bool isEmpty() const { return m_line.length == 0; }
+            bool endsWithNewline() const { return (m_line.length > 0) && (m_text[m_line.start + m_line.length - 1] == '\n'); }
+            sf::Uint32 operator[](std::size_t index) const { return m_text[m_line.start + index]; }
+
+            sf::String substring(std::size_t position, std::size_t length = sf::String::InvalidPos) const
+            {
+                return m_text.substring(m_line.start + position, std::min(length, m_line.length - position));
+            }
+
+            operator sf::String() const { return substring(0); }
+
+        private:
+            const sf::String& m_text;
+            Line m_line;
+        };
+
+        LineView getLine(std::size_t lineNumber) const
+        {
+            return {m_text, m_lines[lineNumber]};
+        }
+
+        std::vector<Line> m_lines = std::vector<Line>{{0, 0}}; // Did not compile in VS2013 with just braces
+
+        // Reads the text that is being loaded with loadTextFromFile or loadTextFromStream
+        std::shared_ptr<priv::TextStreamLoader> m_textLoader;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
@@ -477,6 +624,11 @@ namespace tgui
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
 
+        // The lines that are stored in the text objects below
+        std::size_t m_firstDisplayedLine = 0;
+        std::size_t m_endDisplayedLine = 1;
+        bool m_displayedTextOutdated = true;
+
         // Information about the selection
         sf::Vector2<std::size_t> m_selStart;
         sf::Vector2<std::size_t> m_selEnd;
@@ -675,9 +827,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Draws the widget on the render target.
+        // Records the commands to draw the widget.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+        void emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,5 +1,6 @@
 #include <TGUI/BoxLayout.hpp>
 #include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -46,6 +47,12 @@ namespace tgui
             m_widgets.insert(m_widgets.begin() + index, widget);
             m_widgets.pop_back(); // The widget was added at the back with Container::add
 
+            m_objName.insert(m_objName.begin() + index, m_objName.back());
+            m_objName.pop_back();
+
+            m_internedObjName.insert(m_internedObjName.begin() + index, m_internedObjName.back());
+            m_internedObjName.pop_back();
+
             m_widgetsRatio.insert(m_widgetsRatio.begin() + index, 1.f);
             m_widgetsFixedSizes.insert(m_widgetsFixedSizes.begin() + index, 0.f);
             updateWidgetPositions();
@@ -221,21 +228,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BoxLayout::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void BoxLayout::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Set the position
-        states.transform.translate(getPosition());
+        transform.translate(getPosition());
 
         // Draw the background
         if (m_backgroundColor != sf::Color::Transparent)
         {
             sf::RectangleShape background(getSize());
             background.setFillColor(m_backgroundColor);
-            target.draw(background, states);
+            commands.addShape(transform, background);
         }
 
         // Draw the widgets
-        drawWidgetContainer(&target, states);
+        emitWidgetContainerCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
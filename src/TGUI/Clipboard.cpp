@@ -26,6 +26,7 @@
 
 #include <SFML/Config.hpp>
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/Context.hpp>
 
 #ifdef SFML_SYSTEM_WINDOWS
     #include <windows.h>
@@ -37,18 +38,15 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    sf::String Clipboard::m_contents;
-    sf::WindowHandle Clipboard::m_windowHandle = sf::WindowHandle();
-    bool Clipboard::m_isWindowHandleSet = false;
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     sf::String Clipboard::get()
     {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_clipboardMutex};
+
     #ifdef SFML_SYSTEM_WINDOWS
-        if (m_isWindowHandleSet)
+        if (context.m_clipboardWindowHandleSet)
         {
-            if (IsClipboardFormatAvailable(CF_TEXT) && OpenClipboard(m_windowHandle))
+            if (IsClipboardFormatAvailable(CF_TEXT) && OpenClipboard(context.m_clipboardWindowHandle))
             {
                 HGLOBAL hGlobal = GetClipboardData(CF_TEXT);
                 if (hGlobal != NULL)
@@ -56,7 +54,7 @@ namespace tgui
                     const char* lpszData = static_cast<const char*>(GlobalLock(hGlobal));
                     if (lpszData != NULL)
                     {
-                        m_contents = lpszData;
+                        context.m_clipboardContents = lpszData;
 
                         GlobalUnlock(hGlobal);
                     }
@@ -67,29 +65,32 @@ namespace tgui
         }
     #endif
 
-        return m_contents;
+        return context.m_clipboardContents;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Clipboard::set(const sf::String& contents)
     {
-        m_contents = contents;
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_clipboardMutex};
+
+        context.m_clipboardContents = contents;
 
     #ifdef SFML_SYSTEM_WINDOWS
-        if (m_isWindowHandleSet)
+        if (context.m_clipboardWindowHandleSet)
         {
-            if (OpenClipboard(m_windowHandle))
+            if (OpenClipboard(context.m_clipboardWindowHandle))
             {
                 EmptyClipboard();
 
-                HGLOBAL hGlobal = GlobalAlloc(GMEM_MOVEABLE, m_contents.getSize() + 1);
+                HGLOBAL hGlobal = GlobalAlloc(GMEM_MOVEABLE, contents.getSize() + 1);
                 if (hGlobal != NULL)
                 {
                     char* pchData = static_cast<char*>(GlobalLock(hGlobal));
                     if (pchData != NULL)
                     {
-                        memcpy(pchData, m_contents.toAnsiString().c_str(), m_contents.getSize() + 1);
+                        memcpy(pchData, contents.toAnsiString().c_str(), contents.getSize() + 1);
                         SetClipboardData(CF_TEXT, hGlobal);
 
                         GlobalUnlock(hGlobal);
@@ -108,8 +109,11 @@ namespace tgui
 
     void Clipboard::setWindowHandle(const sf::WindowHandle& windowHandle)
     {
-        m_windowHandle = windowHandle;
-        m_isWindowHandleSet = true;
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_clipboardMutex};
+
+        context.m_clipboardWindowHandle = windowHandle;
+        context.m_clipboardWindowHandleSet = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,9 +28,11 @@
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetSaver.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/UpdatePool.hpp>
 
 #include <stack>
 #include <cassert>
+#include <cstdio>
 #include <fstream>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -102,6 +104,7 @@ namespace tgui
         widgetPtr->setParent(this);
         m_widgets.push_back(widgetPtr);
         m_objName.push_back(widgetName);
+        m_internedObjName.push_back(widgetName);
 
         if (m_opacity < 1)
             widgetPtr->setOpacity(m_opacity);
@@ -111,21 +114,12 @@ namespace tgui
 
     Widget::Ptr Container::get(const sf::String& widgetName, bool recursive) const
     {
-        for (std::size_t i = 0; i < m_objName.size(); ++i)
-        {
-            if (m_objName[i] == widgetName)
-            {
-                return m_widgets[i];
-            }
-            else if (recursive && m_widgets[i]->m_containerWidget)
-            {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName, true);
-                if (widget != nullptr)
-                    return widget;
-            }
-        }
+        // When no interned string with this name exists, then no widget can have the name
+        const InternedString internedName = InternedString::find(widgetName);
+        if (internedName.isEmpty() && !widgetName.isEmpty())
+            return nullptr;
 
-        return nullptr;
+        return getByInternedName(internedName, recursive);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -144,6 +138,9 @@ namespace tgui
                     m_widgetBelowMouse = nullptr;
                 }
 
+                if (m_capturedWidget == widget)
+                    m_capturedWidget = nullptr;
+
                 // Unfocus the widget if it was focused
                 if (m_focusedWidget == i+1)
                     unfocusWidgets();
@@ -156,6 +153,7 @@ namespace tgui
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
                 m_objName.erase(m_objName.begin() + i);
+                m_internedObjName.erase(m_internedObjName.begin() + i);
                 return true;
             }
         }
@@ -173,8 +171,10 @@ namespace tgui
         // Clear the lists
         m_widgets.clear();
         m_objName.clear();
+        m_internedObjName.clear();
 
         m_widgetBelowMouse = nullptr;
+        m_capturedWidget = nullptr;
         m_focusedWidget = 0;
     }
 
@@ -187,6 +187,7 @@ namespace tgui
             if (m_widgets[i] == widget)
             {
                 m_objName[i] = name;
+                m_internedObjName[i] = name;
                 return true;
             }
         }
@@ -196,15 +197,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::string Container::getWidgetName(const Widget::Ptr& widget) const
+    const std::string& Container::getWidgetName(const Widget::Ptr& widget) const
     {
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             if (m_widgets[i] == widget)
-                return m_objName[i];
+                return m_internedObjName[i].getString();
         }
 
-        return "";
+        static const std::string emptyName;
+        return emptyName;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -381,13 +383,23 @@ namespace tgui
         // Loop through all radio buttons and uncheck them
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (m_widgets[i]->m_callback.widgetType == "RadioButton")
+            if (m_widgets[i]->getWidgetTypeId() == WidgetType::RadioButton)
                 std::static_pointer_cast<RadioButton>(m_widgets[i])->uncheck();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RadioButtonGroup::Ptr Container::getRadioButtonGroup()
+    {
+        if (!m_radioButtonGroup)
+            m_radioButtonGroup = RadioButtonGroup::create();
+
+        return m_radioButtonGroup;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::setOpacity(float opacity)
     {
         Widget::setOpacity(opacity);
@@ -413,14 +425,36 @@ namespace tgui
 
     void Container::saveWidgetsToFile(const std::string& filename)
     {
-        std::stringstream stream;
-        WidgetSaver::save(std::static_pointer_cast<Container>(shared_from_this()), stream);
+        // The widgets are written to a temporary file first, so that the existing file remains intact when saving fails halfway
+        const std::string temporaryFilename = filename + ".tmp";
+        {
+            std::ofstream out{temporaryFilename};
+            if (!out.is_open())
+                throw Exception{"Failed to open '" + temporaryFilename + "' for saving the widgets to it."};
 
-        std::ofstream out{filename};
-        if (!out.is_open())
-            throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
+            try
+            {
+                WidgetSaver::save(std::static_pointer_cast<Container>(shared_from_this()), out);
 
-        out << stream.rdbuf();
+                out.close();
+                if (out.fail())
+                    throw Exception{"Failed to write the widgets to '" + temporaryFilename + "'."};
+            }
+            catch (...)
+            {
+                out.close();
+                std::remove(temporaryFilename.c_str());
+                throw;
+            }
+        }
+
+        // Renaming fails on Windows when the file already exists, so the old file has to be removed first there
+        if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+        {
+            std::remove(filename.c_str());
+            if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+                throw Exception{"The widgets were saved to '" + temporaryFilename + "', but it could not be renamed to '" + filename + "'."};
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -441,30 +475,16 @@ namespace tgui
 
     void Container::leftMousePressed(float x, float y)
     {
-        sf::Event event;
-        event.type = sf::Event::MouseButtonPressed;
-        event.mouseButton.button = sf::Mouse::Left;
-        event.mouseButton.x = static_cast<int>(x - getPosition().x);
-        event.mouseButton.y = static_cast<int>(y - getPosition().y);
-
-        // Let the event manager handle the event
-        handleEvent(event);
+        dispatchLeftMousePressed(x - getPosition().x, y - getPosition().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::leftMouseReleased(float x , float y)
     {
-        sf::Event event;
-        event.type = sf::Event::MouseButtonReleased;
-        event.mouseButton.button = sf::Mouse::Left;
-        event.mouseButton.x = static_cast<int>(x - getPosition().x);
-        event.mouseButton.y = static_cast<int>(y - getPosition().y);
-
-        // Let the event manager handle the event, but don't let it call mouseNoLongerDown on all widgets
-        m_handingMouseReleased = true;
-        handleEvent(event);
-        m_handingMouseReleased = false;
+        // Don't let the children be told that the mouse is no longer down, it will happen afterwards when mouseNoLongerDown
+        // is called on this container
+        dispatchLeftMouseReleased(x - getPosition().x, y - getPosition().y, false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -473,49 +493,28 @@ namespace tgui
     {
         Widget::mouseMoved(x, y);
 
-        sf::Event event;
-        event.type = sf::Event::MouseMoved;
-        event.mouseMove.x = static_cast<int>(x - getPosition().x);
-        event.mouseMove.y = static_cast<int>(y - getPosition().y);
-        handleEvent(event);
+        dispatchMouseMoved(x - getPosition().x, y - getPosition().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::keyPressed(const sf::Event::KeyEvent& event)
     {
-        sf::Event newEvent;
-        newEvent.type = sf::Event::KeyPressed;
-        newEvent.key = event;
-
-        // Let the event manager handle the event
-        handleEvent(newEvent);
+        dispatchKeyPressed(event);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::textEntered(sf::Uint32 key)
     {
-        sf::Event event;
-        event.type = sf::Event::TextEntered;
-        event.text.unicode = key;
-
-        // Let the event manager handle the event
-        handleEvent(event);
+        dispatchTextEntered(key);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::mouseWheelMoved(int delta, int x, int y)
     {
-        sf::Event event;
-        event.type = sf::Event::MouseWheelMoved;
-        event.mouseWheel.delta = delta;
-        event.mouseWheel.x = static_cast<int>(x - getPosition().x);
-        event.mouseWheel.y = static_cast<int>(y - getPosition().y);
-
-        // Let the event manager handle the event
-        handleEvent(event);
+        dispatchMouseWheelMoved(delta, x - getPosition().x, y - getPosition().y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -539,6 +538,8 @@ namespace tgui
 
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
             m_widgets[i]->mouseNoLongerDown();
+
+        m_capturedWidget = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -586,6 +587,7 @@ namespace tgui
                 // Copy the widget
                 m_widgets.push_back(m_widgets[i]);
                 m_objName.push_back(m_objName[i]);
+                m_internedObjName.push_back(m_internedObjName[i]);
 
                 // Focus the correct widget
                 if ((m_focusedWidget == 0) || (m_focusedWidget == i+1))
@@ -596,6 +598,7 @@ namespace tgui
                 // Remove the old widget
                 m_widgets.erase(m_widgets.begin() + i);
                 m_objName.erase(m_objName.begin() + i);
+                m_internedObjName.erase(m_internedObjName.begin() + i);
 
                 break;
             }
@@ -614,9 +617,11 @@ namespace tgui
             {
                 // Copy the widget
                 Widget::Ptr obj = m_widgets[i];
-                std::string name = m_objName[i];
+                sf::String name = m_objName[i];
+                InternedString internedName = m_internedObjName[i];
                 m_widgets.insert(m_widgets.begin(), obj);
                 m_objName.insert(m_objName.begin(), name);
+                m_internedObjName.insert(m_internedObjName.begin(), internedName);
 
                 // Focus the correct widget
                 if (m_focusedWidget == i + 1)
@@ -627,6 +632,7 @@ namespace tgui
                 // Remove the old widget
                 m_widgets.erase(m_widgets.begin() + i + 1);
                 m_objName.erase(m_objName.begin() + i + 1);
+                m_internedObjName.erase(m_internedObjName.begin() + i + 1);
 
                 break;
             }
@@ -652,171 +658,259 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Container::handleEvent(sf::Event& event)
+    void Container::updateParallel(sf::Time elapsedTime, priv::UpdatePool& pool)
     {
-        // Check if a mouse button has moved
-        if ((event.type == sf::Event::MouseMoved) || ((event.type == sf::Event::TouchMoved) && (event.touch.finger == 0)))
+        Widget::update(elapsedTime);
+
+        // Copy the list of widgets, a signal handler could add or remove widgets before all signals are send
+        std::vector<Widget::Ptr> widgets;
+        std::vector<bool> parallel;
+        for (auto& widget : m_widgets)
         {
-            float mouseX = (event.type == sf::Event::MouseMoved) ? static_cast<float>(event.mouseMove.x) : static_cast<float>(event.touch.x);
-            float mouseY = (event.type == sf::Event::MouseMoved) ? static_cast<float>(event.mouseMove.y) : static_cast<float>(event.touch.y);
+            if (widget->isVisible())
+            {
+                widgets.push_back(widget);
+                parallel.push_back(!mustUpdateOnCallingThread(*widget));
+            }
+        }
 
-            // Loop through all widgets
-            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        std::vector<std::vector<std::function<void()>>> deferredSignals(widgets.size());
+        pool.run(widgets.size(), [&](std::size_t i)
             {
-                // Check if the mouse went down on the widget
-                if (m_widgets[i]->m_mouseDown)
+                if (!parallel[i])
+                    return;
+
+                priv::getDeferredSignals() = &deferredSignals[i];
+                try
                 {
-                    // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
-                    if ((m_widgets[i]->m_draggableWidget) || (m_widgets[i]->m_containerWidget))
-                    {
-                        m_widgets[i]->mouseMoved(mouseX, mouseY);
-                        return true;
-                    }
+                    widgets[i]->update(elapsedTime);
+                }
+                catch (...)
+                {
+                    priv::getDeferredSignals() = nullptr;
+                    throw;
                 }
-            }
 
-            // Check if the mouse is on top of a widget
-            Widget::Ptr widget = mouseOnWhichWidget(mouseX, mouseY);
-            if (widget != nullptr)
+                priv::getDeferredSignals() = nullptr;
+            });
+
+        // Send the signals and update the remaining widgets in the same order as when updating on a single thread
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+        {
+            if (parallel[i])
             {
-                // Send the event to the widget
-                widget->mouseMoved(mouseX, mouseY);
-                return true;
+                for (auto& signal : deferredSignals[i])
+                    signal();
             }
-
-            return false;
+            else
+                widgets[i]->update(elapsedTime);
         }
 
-        // Check if a mouse button was pressed
-        else if (((event.type == sf::Event::MouseButtonPressed) && (event.mouseButton.button == sf::Mouse::Left))
-              || ((event.type == sf::Event::TouchBegan) && (event.touch.finger == 0)))
-        {
-            float mouseX = (event.type == sf::Event::MouseButtonPressed) ? static_cast<float>(event.mouseButton.x) : static_cast<float>(event.touch.x);
-            float mouseY = (event.type == sf::Event::MouseButtonPressed) ? static_cast<float>(event.mouseButton.y) : static_cast<float>(event.touch.y);
+        m_animationTimeElapsed = {};
+    }
 
-            // Check if the mouse is on top of a widget
-            Widget::Ptr widget = mouseOnWhichWidget(mouseX, mouseY);
-            if (widget != nullptr)
-            {
-                // Focus the widget
-                focusWidget(widget.get());
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                // Check if the widget is a container
-                if (widget->m_containerWidget)
-                {
-                    // If another widget was focused then unfocus it now
-                    if ((m_focusedWidget) && (m_widgets[m_focusedWidget-1] != widget))
-                    {
-                        m_widgets[m_focusedWidget-1]->m_focused = false;
-                        m_widgets[m_focusedWidget-1]->widgetUnfocused();
-                        m_focusedWidget = 0;
-                    }
-                }
+    bool Container::mustUpdateOnCallingThread(const Widget& widget)
+    {
+        if (!widget.m_showAnimations.empty() || widget.isUpdateUsingSharedResources())
+            return true;
 
-                widget->leftMousePressed(mouseX, mouseY);
-                return true;
+        if (widget.m_containerWidget)
+        {
+            for (auto& child : static_cast<const Container&>(widget).m_widgets)
+            {
+                if (mustUpdateOnCallingThread(*child))
+                    return true;
             }
-            else // The mouse did not went down on a widget, so unfocus the focused widget
-                unfocusWidgets();
-
-            return false;
         }
 
-        // Check if a mouse button was released
-        else if (((event.type == sf::Event::MouseButtonReleased) && (event.mouseButton.button == sf::Mouse::Left))
-              || ((event.type == sf::Event::TouchEnded) && (event.touch.finger == 0)))
-        {
-            float mouseX = (event.type == sf::Event::MouseButtonReleased) ? static_cast<float>(event.mouseButton.x) : static_cast<float>(event.touch.x);
-            float mouseY = (event.type == sf::Event::MouseButtonReleased) ? static_cast<float>(event.mouseButton.y) : static_cast<float>(event.touch.y);
+        return false;
+    }
 
-            // Check if the mouse is on top of a widget
-            Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(mouseX, mouseY);
-            if (widgetBelowMouse != nullptr)
-                widgetBelowMouse->leftMouseReleased(mouseX, mouseY);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Tell all widgets that the mouse has gone up
-            // But don't do this when leftMouseReleased was called on this container because
-            // it will happen afterwards when mouseNoLongerDown is called on it
-            if (!m_handingMouseReleased)
+    bool Container::handleEvent(sf::Event& event)
+    {
+        switch (event.type)
+        {
+            case sf::Event::MouseMoved:
+                return dispatchMouseMoved(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
+
+            case sf::Event::MouseButtonPressed:
+                if (event.mouseButton.button != sf::Mouse::Left)
+                    return false;
+                return dispatchLeftMousePressed(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
+
+            case sf::Event::MouseButtonReleased:
+                if (event.mouseButton.button != sf::Mouse::Left)
+                    return false;
+                return dispatchLeftMouseReleased(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y), true);
+
+            case sf::Event::TouchMoved:
+            case sf::Event::TouchBegan:
+            case sf::Event::TouchEnded:
             {
-                for (auto& widget : m_widgets)
-                    widget->mouseNoLongerDown();
+                // Only the first finger acts as the mouse
+                if (event.touch.finger != 0)
+                    return false;
+
+                const float x = static_cast<float>(event.touch.x);
+                const float y = static_cast<float>(event.touch.y);
+                if (event.type == sf::Event::TouchMoved)
+                    return dispatchMouseMoved(x, y);
+                else if (event.type == sf::Event::TouchBegan)
+                    return dispatchLeftMousePressed(x, y);
+                else
+                    return dispatchLeftMouseReleased(x, y, true);
             }
 
-            if (widgetBelowMouse != nullptr)
-                return true;
+            case sf::Event::KeyPressed:
+            #ifdef SFML_SYSTEM_ANDROID
+                // Map delete to backspace on android
+                if (event.key.code == sf::Keyboard::Delete)
+                    event.key.code = sf::Keyboard::BackSpace;
+            #endif
+                return dispatchKeyPressed(event.key);
 
-            return false;
+            case sf::Event::KeyReleased:
+                // Change the focus to another widget when the tab key was pressed
+                if (event.key.code == sf::Keyboard::Tab)
+                    return tabKeyPressed();
+                else
+                    return false;
+
+            case sf::Event::TextEntered:
+                return dispatchTextEntered(event.text.unicode);
+
+            case sf::Event::MouseWheelMoved:
+                return dispatchMouseWheelMoved(event.mouseWheel.delta, static_cast<float>(event.mouseWheel.x), static_cast<float>(event.mouseWheel.y));
+
+            default: // Event is ignored
+                return false;
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Check if a key was pressed
-        else if (event.type == sf::Event::KeyPressed)
+    bool Container::dispatchMouseMoved(float x, float y)
+    {
+        // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
+        if (m_capturedWidget)
         {
-            // Only continue when the character was recognised
-            if (event.key.code != sf::Keyboard::Unknown)
+            if (m_capturedWidget->m_mouseDown && (m_capturedWidget->m_draggableWidget || m_capturedWidget->m_containerWidget))
             {
-                // Check if there is a focused widget
-                if (m_focusedWidget)
-                {
-                #ifdef SFML_SYSTEM_ANDROID
-                    // Map delete to backspace on android
-                    if (event.key.code == sf::Keyboard::Delete)
-                        event.key.code = sf::Keyboard::BackSpace;
-                #endif
-
-                    // Tell the widget that the key was pressed
-                    m_widgets[m_focusedWidget-1]->keyPressed(event.key);
-
-                    return true;
-                }
+                m_capturedWidget->mouseMoved(x, y);
+                return true;
             }
-
-            return false;
+            else if (!m_capturedWidget->m_mouseDown)
+                m_capturedWidget = nullptr;
         }
 
-        // Check if a key was released
-        else if (event.type == sf::Event::KeyReleased)
+        // Check if the mouse is on top of a widget
+        Widget::Ptr widget = mouseOnWhichWidget(x, y);
+        if (widget != nullptr)
         {
-            // Change the focus to another widget when the tab key was pressed
-            if (event.key.code == sf::Keyboard::Tab)
-                return tabKeyPressed();
-            else
-                return false;
+            // Send the event to the widget
+            widget->mouseMoved(x, y);
+            return true;
         }
 
-        // Also check if text was entered (not a special key)
-        else if (event.type == sf::Event::TextEntered)
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::dispatchLeftMousePressed(float x, float y)
+    {
+        // Check if the mouse is on top of a widget
+        Widget::Ptr widget = mouseOnWhichWidget(x, y);
+        if (widget != nullptr)
         {
-            // Check if the character that we pressed is allowed
-            if ((event.text.unicode >= 32) && (event.text.unicode != 127))
+            // Focus the widget
+            focusWidget(widget.get());
+
+            // Check if the widget is a container
+            if (widget->m_containerWidget)
             {
-                // Tell the widget that the key was pressed
-                if (m_focusedWidget)
+                // If another widget was focused then unfocus it now
+                if ((m_focusedWidget) && (m_widgets[m_focusedWidget-1] != widget))
                 {
-                    m_widgets[m_focusedWidget-1]->textEntered(event.text.unicode);
-                    return true;
+                    m_widgets[m_focusedWidget-1]->m_focused = false;
+                    m_widgets[m_focusedWidget-1]->widgetUnfocused();
+                    m_focusedWidget = 0;
                 }
             }
 
-            return false;
+            widget->leftMousePressed(x, y);
+            m_capturedWidget = widget;
+            return true;
         }
+        else // The mouse did not went down on a widget, so unfocus the focused widget
+            unfocusWidgets();
+
+        return false;
+    }
 
-        // Check for mouse wheel scrolling
-        else if (event.type == sf::Event::MouseWheelMoved)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::dispatchLeftMouseReleased(float x, float y, bool notifyMouseNoLongerDown)
+    {
+        // Check if the mouse is on top of a widget
+        Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(x, y);
+        if (widgetBelowMouse != nullptr)
+            widgetBelowMouse->leftMouseReleased(x, y);
+
+        // Tell all widgets that the mouse has gone up
+        if (notifyMouseNoLongerDown)
         {
-            // Find the widget under the mouse
-            Widget::Ptr widget = mouseOnWhichWidget(static_cast<float>(event.mouseWheel.x), static_cast<float>(event.mouseWheel.y));
-            if (widget != nullptr)
-            {
-                // Send the event to the widget
-                widget->mouseWheelMoved(event.mouseWheel.delta, event.mouseWheel.x,  event.mouseWheel.y);
-                return true;
-            }
+            for (auto& widget : m_widgets)
+                widget->mouseNoLongerDown();
 
-            return false;
+            m_capturedWidget = nullptr;
         }
-        else // Event is ignored
+
+        return widgetBelowMouse != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::dispatchKeyPressed(const sf::Event::KeyEvent& event)
+    {
+        // Only continue when the character was recognised and when there is a focused widget
+        if ((event.code == sf::Keyboard::Unknown) || !m_focusedWidget)
             return false;
+
+        m_widgets[m_focusedWidget-1]->keyPressed(event);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::dispatchTextEntered(sf::Uint32 key)
+    {
+        // Check if the character that we pressed is allowed and if there is a focused widget
+        if ((key < 32) || (key == 127) || !m_focusedWidget)
+            return false;
+
+        m_widgets[m_focusedWidget-1]->textEntered(key);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::dispatchMouseWheelMoved(int delta, float x, float y)
+    {
+        // Find the widget under the mouse
+        Widget::Ptr widget = mouseOnWhichWidget(x, y);
+        if (widget != nullptr)
+        {
+            // Send the event to the widget
+            widget->mouseWheelMoved(delta, static_cast<int>(x), static_cast<int>(y));
+            return true;
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -868,6 +962,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Container::getByInternedName(const InternedString& widgetName, bool recursive) const
+    {
+        for (std::size_t i = 0; i < m_internedObjName.size(); ++i)
+        {
+            if (m_internedObjName[i] == widgetName)
+            {
+                return m_widgets[i];
+            }
+            else if (recursive && m_widgets[i]->m_containerWidget)
+            {
+                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->getByInternedName(widgetName, true);
+                if (widget != nullptr)
+                    return widget;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::tabKeyPressed()
     {
         // Don't do anything when the tab key usage is disabled
@@ -990,12 +1105,23 @@ namespace tgui
         }
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::emitWidgetContainerCommands(RenderCommandList& commands, const sf::Transform& transform) const
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i]->m_visible)
+                m_widgets[i]->emitRenderCommands(commands, transform);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     GuiContainer::GuiContainer()
     {
-        m_callback.widgetType = "GuiContainer";
+        setWidgetType(WidgetType::GuiContainer);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1013,11 +1139,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        emitWidgetContainerCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<priv::DelayedSignalQueue> GuiContainer::getDelayedSignalQueue() const
+    {
+        return m_delayedSignalQueue;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
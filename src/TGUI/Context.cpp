@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Context.hpp>
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChatBox.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/ChildWindow.hpp>
+#include <TGUI/Widgets/ComboBox.hpp>
+#include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/MenuBar.hpp>
+#include <TGUI/Widgets/MessageBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/Widgets/SpinButton.hpp>
+#include <TGUI/Widgets/Tab.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Resource path that replaces the global one for the current thread while a theme initializes a widget
+    thread_local const std::string* threadResourcePath = nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Context::Context() :
+        m_widgetConstructors
+        {
+            {"button", std::make_shared<Button>},
+            {"chatbox", std::make_shared<ChatBox>},
+            {"checkbox", std::make_shared<CheckBox>},
+            {"childwindow", std::make_shared<ChildWindow>},
+            {"combobox", std::make_shared<ComboBox>},
+            {"editbox", std::make_shared<EditBox>},
+            {"knob", std::make_shared<Knob>},
+            {"label", std::make_shared<Label>},
+            {"listbox", std::make_shared<ListBox>},
+            {"menubar", std::make_shared<MenuBar>},
+            {"messagebox", std::make_shared<MessageBox>},
+            {"panel", std::make_shared<Panel>},
+            {"progressbar", std::make_shared<ProgressBar>},
+            {"radiobutton", std::make_shared<RadioButton>},
+            {"scrollbar", std::make_shared<Scrollbar>},
+            {"slider", std::make_shared<Slider>},
+            {"spinbutton", std::make_shared<SpinButton>},
+            {"tab", std::make_shared<Tab>},
+            {"textbox", std::make_shared<TextBox>}
+        },
+        m_themeLoader   (std::make_shared<DefaultThemeLoader>()),
+        m_lastSignalId  (0),
+        m_delayedSignalQueue(std::make_shared<priv::DelayedSignalQueue>())
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Context& Context::getGlobal()
+    {
+        // Constructed on first use, which is thread-safe and avoids depending on the initialization order of globals
+        static Context context;
+        return context;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::setResourcePath(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock{m_resourcePathMutex};
+
+        m_resourcePath = path;
+        if (!m_resourcePath.empty())
+        {
+            if (m_resourcePath[m_resourcePath.length()-1] != '/')
+                m_resourcePath.push_back('/');
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Context::getResourcePath() const
+    {
+        if (threadResourcePath)
+            return *threadResourcePath;
+
+        std::lock_guard<std::mutex> lock{m_resourcePathMutex};
+        return m_resourcePath;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Context::getLoadedImageCount() const
+    {
+        std::lock_guard<std::mutex> lock{m_textureMutex};
+        return m_imageMap.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Context::clearCaches()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_themeCacheMutex};
+            m_themePropertiesCache.clear();
+            m_themeWidgetTypeCache.clear();
+        }
+
+        std::lock_guard<std::mutex> lock{m_deserializerMutex};
+        m_deserializeCache.clear();
+        m_deserializeCacheGeneration++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string* Context::setThreadResourcePath(const std::string* path)
+    {
+        const std::string* oldPath = threadResourcePath;
+        threadResourcePath = path;
+        return oldPath;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
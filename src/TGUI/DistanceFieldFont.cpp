@@ -0,0 +1,1033 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/DistanceFieldFont.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <mutex>
+
+#ifdef TGUI_USE_FREETYPE
+    #include <ft2build.h>
+    #include FT_FREETYPE_H
+    #include FT_GLYPH_H
+    #include FT_OUTLINE_H
+    #include FT_BITMAP_H
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The distance field is stored in the alpha channel. Pixels with a value above 0.5 lie inside the glyph.
+    // The edge is smoothed over about one pixel on the screen. The smoothing follows from how fast the distance changes
+    // between neighbouring pixels, so texts with different sizes and transformations can be drawn together.
+    const char fragmentShader[] =
+        "uniform sampler2D texture;"
+        "void main()"
+        "{"
+        "    float distance = texture2D(texture, gl_TexCoord[0].xy).a;"
+        "    float smoothing = min(0.5, 0.5 * length(vec2(dFdx(distance), dFdy(distance))));"
+        "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);"
+        "    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);"
+        "}";
+
+    sf::Uint64 getGlyphKey(sf::Uint32 codePoint, bool bold)
+    {
+        return (static_cast<sf::Uint64>(bold) << 32) | codePoint;
+    }
+
+    // Combines everything that influences the geometry of a text, the font is the same for all texts in a cache
+    std::size_t hashText(const sf::String& string, unsigned int characterSize, sf::Uint32 style, const sf::Color& color)
+    {
+        std::size_t hash = std::hash<sf::Uint32>()(characterSize) ^ (std::hash<sf::Uint32>()(style) << 1) ^ (std::hash<sf::Uint32>()(color.toInteger()) << 2);
+        for (const auto codePoint : string)
+            hash = (hash * 31) ^ codePoint;
+
+        return hash;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+namespace priv
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GlyphAtlas::GlyphAtlas() :
+        m_distances(AtlasSize * AtlasSize, 0),
+        m_shelves(ShelfCount)
+    {
+        static_assert(ShelfCount <= 32, "The shelves used by a text are stored as bits in an unsigned int");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GlyphAtlas& GlyphAtlas::getGlobal()
+    {
+        static GlyphAtlas atlas;
+        return atlas;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphAtlas::beginUse()
+    {
+        ++m_useCounter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphAtlas::touch(unsigned int shelf)
+    {
+        if (shelf != NoShelf)
+            m_shelves[shelf].lastUse = m_useCounter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GlyphAtlas::allocate(DistanceFieldFont& owner, sf::Uint64 key, unsigned int width, unsigned int height, sf::Vector2u& position, unsigned int& shelf)
+    {
+        if ((width > AtlasSize) || (height > ShelfHeight))
+            return false;
+
+        // Use the first shelf that still has room for the glyph
+        shelf = NoShelf;
+        for (unsigned int i = 0; i < m_shelves.size(); ++i)
+        {
+            if (m_shelves[i].nextGlyphPos + width <= AtlasSize)
+            {
+                shelf = i;
+                break;
+            }
+        }
+
+        // When all shelves are full, empty the one that was used least recently. Shelves that contain glyphs which are
+        // needed for the current text can't be emptied.
+        if (shelf == NoShelf)
+        {
+            for (unsigned int i = 0; i < m_shelves.size(); ++i)
+            {
+                if ((m_shelves[i].lastUse < m_useCounter) && ((shelf == NoShelf) || (m_shelves[i].lastUse < m_shelves[shelf].lastUse)))
+                    shelf = i;
+            }
+
+            if (shelf == NoShelf)
+                return false;
+
+            clearShelf(shelf);
+        }
+
+        position = {m_shelves[shelf].nextGlyphPos, shelf * ShelfHeight};
+        m_shelves[shelf].nextGlyphPos += width;
+        m_shelves[shelf].lastUse = m_useCounter;
+        m_shelves[shelf].glyphs.push_back({&owner, key});
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Texture& GlyphAtlas::getTexture()
+    {
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+
+        if (!m_textureCreated)
+        {
+            m_texture.create(AtlasSize, AtlasSize);
+            m_texture.setSmooth(true);
+            m_textureCreated = true;
+            m_outdatedShelves = (1u << ShelfCount) - 1;
+        }
+
+        // The distances are stored in the alpha channel of white pixels
+        std::vector<sf::Uint8> pixels;
+        for (unsigned int shelf = 0; (shelf < ShelfCount) && m_outdatedShelves; ++shelf)
+        {
+            if (!(m_outdatedShelves & (1u << shelf)))
+                continue;
+
+            pixels.assign(AtlasSize * ShelfHeight * 4, 255);
+            for (unsigned int i = 0; i < AtlasSize * ShelfHeight; ++i)
+                pixels[i * 4 + 3] = m_distances[shelf * ShelfHeight * AtlasSize + i];
+
+            m_texture.update(pixels.data(), AtlasSize, ShelfHeight, 0, shelf * ShelfHeight);
+            m_outdatedShelves &= ~(1u << shelf);
+        }
+
+        return m_texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphAtlas::update(const std::vector<sf::Uint8>& distances, unsigned int width, unsigned int height, sf::Vector2u position)
+    {
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            for (unsigned int x = 0; x < width; ++x)
+                m_distances[(position.y + y) * AtlasSize + position.x + x] = distances[y * width + x];
+        }
+
+        m_outdatedShelves |= 1u << (position.y / ShelfHeight);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphAtlas::removeOwner(const DistanceFieldFont& owner)
+    {
+        for (auto& shelf : m_shelves)
+        {
+            shelf.glyphs.erase(std::remove_if(shelf.glyphs.begin(), shelf.glyphs.end(),
+                                              [&](const std::pair<DistanceFieldFont*, sf::Uint64>& glyph){ return glyph.first == &owner; }),
+                               shelf.glyphs.end());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GlyphAtlas::shelvesClearedSince(unsigned int shelves, unsigned long long generation) const
+    {
+        for (unsigned int i = 0; i < ShelfCount; ++i)
+        {
+            if ((shelves & (1u << i)) && (m_shelves[i].lastClear > generation))
+                return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphAtlas::clearShelf(unsigned int shelf)
+    {
+        for (auto& glyph : m_shelves[shelf].glyphs)
+            glyph.first->m_glyphs.erase(glyph.second);
+
+        m_shelves[shelf].glyphs.clear();
+        m_shelves[shelf].nextGlyphPos = 0;
+        m_shelves[shelf].lastClear = ++m_generation;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct DistanceFieldFont::FreeTypeFace
+    {
+#ifdef TGUI_USE_FREETYPE
+        FT_Library library = nullptr;
+        FT_Face face = nullptr;
+
+        // A face that is loaded from memory reads from this data as long as it exists
+        std::vector<char> data;
+
+        ~FreeTypeFace()
+        {
+            if (face)
+                FT_Done_Face(face);
+            if (library)
+                FT_Done_FreeType(library);
+        }
+#endif
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DistanceFieldFont::DistanceFieldFont(const sf::Font& font) :
+        m_font(font)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DistanceFieldFont::~DistanceFieldFont()
+    {
+        GlyphAtlas& atlas = GlyphAtlas::getGlobal();
+        std::lock_guard<std::recursive_mutex> lock{atlas.getMutex()};
+        atlas.removeOwner(*this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<DistanceFieldFont> DistanceFieldFont::get(const std::shared_ptr<sf::Font>& font)
+    {
+        // The atlas has to be created before the map, so that it still exists when the fonts in the map are destroyed
+        GlyphAtlas::getGlobal();
+
+        static std::map<const sf::Font*, std::pair<std::weak_ptr<sf::Font>, std::shared_ptr<DistanceFieldFont>>> distanceFieldFonts;
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock{mutex};
+
+        auto it = distanceFieldFonts.find(font.get());
+        if ((it != distanceFieldFonts.end()) && (it->second.first.lock() == font))
+            return it->second.second;
+
+        // Forget about the fonts that no longer exist
+        for (auto fontIt = distanceFieldFonts.begin(); fontIt != distanceFieldFonts.end();)
+        {
+            if (fontIt->second.first.expired())
+                fontIt = distanceFieldFonts.erase(fontIt);
+            else
+                ++fontIt;
+        }
+
+        auto distanceFieldFont = std::make_shared<DistanceFieldFont>(*font);
+        distanceFieldFonts[font.get()] = {font, distanceFieldFont};
+        return distanceFieldFont;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DistanceFieldFont::setFontFile(const std::shared_ptr<sf::Font>& font, const std::string& filename)
+    {
+#ifdef TGUI_USE_FREETYPE
+        std::unique_ptr<FreeTypeFace> face{new FreeTypeFace};
+        if ((FT_Init_FreeType(&face->library) != 0) || (FT_New_Face(face->library, filename.c_str(), 0, &face->face) != 0))
+            return false;
+
+        return get(font)->setFace(std::move(face));
+#else
+        (void)font;
+        (void)filename;
+        return false;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DistanceFieldFont::setFontData(const std::shared_ptr<sf::Font>& font, const void* data, std::size_t sizeInBytes)
+    {
+#ifdef TGUI_USE_FREETYPE
+        std::unique_ptr<FreeTypeFace> face{new FreeTypeFace};
+        face->data.assign(static_cast<const char*>(data), static_cast<const char*>(data) + sizeInBytes);
+        if ((FT_Init_FreeType(&face->library) != 0)
+         || (FT_New_Memory_Face(face->library, reinterpret_cast<const FT_Byte*>(face->data.data()), static_cast<FT_Long>(sizeInBytes), 0, &face->face) != 0))
+            return false;
+
+        return get(font)->setFace(std::move(face));
+#else
+        (void)font;
+        (void)data;
+        (void)sizeInBytes;
+        return false;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DistanceFieldFont::loadGlyphs(const sf::String& string, bool bold)
+    {
+        GlyphAtlas& atlas = GlyphAtlas::getGlobal();
+        std::lock_guard<std::recursive_mutex> lock{atlas.getMutex()};
+
+        // Tabs are drawn as spaces, so the space glyph is needed for them
+        std::vector<sf::Uint32> codePoints;
+        codePoints.reserve(string.getSize());
+        for (auto codePoint : string)
+        {
+            if (codePoint == '\n')
+                continue;
+            else if (codePoint == '\t')
+                codePoints.push_back(' ');
+            else
+                codePoints.push_back(codePoint);
+        }
+
+        std::sort(codePoints.begin(), codePoints.end());
+        codePoints.erase(std::unique(codePoints.begin(), codePoints.end()), codePoints.end());
+
+        // The shelves containing glyphs of this string must not be emptied while the missing glyphs are added
+        atlas.beginUse();
+
+        std::vector<sf::Uint32> missingCodePoints;
+        for (auto codePoint : codePoints)
+        {
+            const Glyph* glyph = getGlyph(codePoint, bold);
+            if (glyph)
+                atlas.touch(glyph->shelf);
+            else
+                missingCodePoints.push_back(codePoint);
+        }
+
+        if (missingCodePoints.empty())
+            return true;
+
+        if (m_face)
+        {
+            GlyphMetrics metrics;
+            std::vector<bool> insideGlyph;
+            for (auto codePoint : missingCodePoints)
+            {
+                rasterizeGlyph(codePoint, bold, metrics, insideGlyph);
+                m_glyphMetrics[getGlyphKey(codePoint, bold)] = metrics;
+
+                const int glyphWidth = static_cast<int>(metrics.bounds.width);
+                const int glyphHeight = static_cast<int>(metrics.bounds.height);
+                if (!addGlyph(codePoint, bold, metrics, glyphWidth, glyphHeight, insideGlyph))
+                    return false;
+            }
+
+            return true;
+        }
+
+        // Rasterize all missing glyphs before copying the texture of the font, because adding glyphs may resize it
+        for (auto codePoint : missingCodePoints)
+            m_font.getGlyph(codePoint, ReferenceSize, bold);
+
+        const sf::Image page = m_font.getTexture(ReferenceSize).copyToImage();
+        for (auto codePoint : missingCodePoints)
+        {
+            const sf::Glyph& fontGlyph = m_font.getGlyph(codePoint, ReferenceSize, bold);
+            const GlyphMetrics& metrics = getGlyphMetrics(codePoint, bold);
+
+            // Find out which pixels are part of the glyph
+            const int glyphWidth = std::max(fontGlyph.textureRect.width, 0);
+            const int glyphHeight = std::max(fontGlyph.textureRect.height, 0);
+            std::vector<bool> insideGlyph(glyphWidth * glyphHeight, false);
+            for (int y = 0; y < glyphHeight; ++y)
+            {
+                for (int x = 0; x < glyphWidth; ++x)
+                {
+                    const int pageX = fontGlyph.textureRect.left + x;
+                    const int pageY = fontGlyph.textureRect.top + y;
+                    if ((pageX < static_cast<int>(page.getSize().x)) && (pageY < static_cast<int>(page.getSize().y)))
+                        insideGlyph[y * glyphWidth + x] = page.getPixel(pageX, pageY).a >= 128;
+                }
+            }
+
+            if (!addGlyph(codePoint, bold, metrics, glyphWidth, glyphHeight, insideGlyph))
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DistanceFieldFont::Glyph* DistanceFieldFont::getGlyph(sf::Uint32 codePoint, bool bold) const
+    {
+        std::lock_guard<std::recursive_mutex> lock{GlyphAtlas::getGlobal().getMutex()};
+
+        auto it = m_glyphs.find(getGlyphKey(codePoint, bold));
+        if (it != m_glyphs.end())
+            return &it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DistanceFieldFont::GlyphMetrics& DistanceFieldFont::getGlyphMetrics(sf::Uint32 codePoint, bool bold)
+    {
+        std::lock_guard<std::recursive_mutex> lock{GlyphAtlas::getGlobal().getMutex()};
+
+        const sf::Uint64 key = getGlyphKey(codePoint, bold);
+        auto it = m_glyphMetrics.find(key);
+        if (it != m_glyphMetrics.end())
+            return it->second;
+
+        GlyphMetrics& metrics = m_glyphMetrics[key];
+        if (m_face)
+        {
+            std::vector<bool> insideGlyph;
+            rasterizeGlyph(codePoint, bold, metrics, insideGlyph);
+        }
+        else
+        {
+            const sf::Glyph& fontGlyph = m_font.getGlyph(codePoint, ReferenceSize, bold);
+            metrics.advance = fontGlyph.advance;
+            metrics.bounds = fontGlyph.bounds;
+        }
+
+        return metrics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float DistanceFieldFont::getKerning(sf::Uint32 first, sf::Uint32 second, unsigned int characterSize) const
+    {
+        std::lock_guard<std::recursive_mutex> lock{GlyphAtlas::getGlobal().getMutex()};
+
+#ifdef TGUI_USE_FREETYPE
+        if (m_face)
+        {
+            // Same calculation as sf::Font, the size of the face is always the reference size
+            FT_Face face = m_face->face;
+            if ((first == 0) || (second == 0) || !FT_HAS_KERNING(face))
+                return 0;
+
+            FT_Vector kerning;
+            if (FT_Get_Kerning(face, FT_Get_Char_Index(face, first), FT_Get_Char_Index(face, second), FT_KERNING_DEFAULT, &kerning) != 0)
+                return 0;
+
+            const float referenceKerning = FT_IS_SCALABLE(face) ? static_cast<float>(kerning.x >> 6) : static_cast<float>(kerning.x);
+            return referenceKerning * characterSize / ReferenceSize;
+        }
+#endif
+
+        return static_cast<float>(m_font.getKerning(first, second, ReferenceSize)) * characterSize / ReferenceSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float DistanceFieldFont::getLineSpacing(unsigned int characterSize) const
+    {
+        std::lock_guard<std::recursive_mutex> lock{GlyphAtlas::getGlobal().getMutex()};
+
+#ifdef TGUI_USE_FREETYPE
+        if (m_face)
+            return static_cast<float>(m_face->face->size->metrics.height) / (1 << 6) * characterSize / ReferenceSize;
+#endif
+
+        return static_cast<float>(m_font.getLineSpacing(ReferenceSize)) * characterSize / ReferenceSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<sf::Vertex>* DistanceFieldFont::getGeometry(const sf::Text& text, unsigned int* shelves)
+    {
+        GlyphAtlas& atlas = GlyphAtlas::getGlobal();
+        std::lock_guard<std::recursive_mutex> lock{atlas.getMutex()};
+
+        if (text.getFont() != &m_font)
+            return nullptr;
+
+        // Lines are not part of the glyphs
+        const sf::Uint32 style = text.getStyle();
+        if (style & (sf::Text::Underlined | sf::Text::StrikeThrough))
+            return nullptr;
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        const sf::Color color = text.getFillColor();
+#else
+        const sf::Color color = text.getColor();
+#endif
+
+        const sf::String& string = text.getString();
+        const unsigned int characterSize = text.getCharacterSize();
+        const std::size_t hash = hashText(string, characterSize, style, color);
+
+        // Reuse the geometry when the text didn't change and none of its glyphs were removed from the atlas
+        auto it = m_geometryCache.find(hash);
+        if (it != m_geometryCache.end())
+        {
+            CachedGeometry& geometry = it->second;
+            if ((geometry.characterSize == characterSize) && (geometry.style == style) && (geometry.color == color)
+             && (geometry.string == string) && !atlas.shelvesClearedSince(geometry.shelves, geometry.atlasGeneration))
+            {
+                // Mark the glyphs as recently used, so that they stay in the atlas
+                for (unsigned int shelf = 0; shelf < GlyphAtlas::ShelfCount; ++shelf)
+                {
+                    if (geometry.shelves & (1u << shelf))
+                        atlas.touch(shelf);
+                }
+
+                if (shelves)
+                    *shelves = geometry.shelves;
+
+                geometry.lastUse = ++m_geometryUseCounter;
+                return &geometry.vertices;
+            }
+        }
+
+        if (!loadGlyphs(string, (style & sf::Text::Bold) != 0))
+            return nullptr;
+
+        if ((it == m_geometryCache.end()) && (m_geometryCache.size() >= MaxCachedGeometries))
+            removeOldGeometry();
+
+        CachedGeometry& geometry = m_geometryCache[hash];
+        geometry.string = string;
+        geometry.characterSize = characterSize;
+        geometry.style = style;
+        geometry.color = color;
+        geometry.atlasGeneration = atlas.getGeneration();
+        geometry.shelves = createGeometry(text, geometry.vertices);
+        geometry.lastUse = ++m_geometryUseCounter;
+        if (shelves)
+            *shelves = geometry.shelves;
+
+        return &geometry.vertices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int DistanceFieldFont::createGeometry(const sf::Text& text, std::vector<sf::Vertex>& vertices)
+    {
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        const sf::Color color = text.getFillColor();
+#else
+        const sf::Color color = text.getColor();
+#endif
+
+        const sf::Uint32 style = text.getStyle();
+        const bool bold = (style & sf::Text::Bold) != 0;
+        const sf::String& string = text.getString();
+        const unsigned int characterSize = text.getCharacterSize();
+        const float scale = static_cast<float>(characterSize) / ReferenceSize;
+        const float italic = (style & sf::Text::Italic) ? 0.208f : 0.f; // 12 degrees, same as sf::Text
+        const float lineSpacing = getLineSpacing(characterSize);
+
+        // The positions are calculated in the same way as sf::Text does
+        unsigned int shelves = 0;
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        sf::Uint32 prevCodePoint = 0;
+        vertices.clear();
+        vertices.reserve(string.getSize() * 6);
+        for (auto codePoint : string)
+        {
+            x += getKerning(prevCodePoint, codePoint, characterSize);
+            prevCodePoint = codePoint;
+
+            if (codePoint == '\n')
+            {
+                y += lineSpacing;
+                x = 0;
+                continue;
+            }
+            else if (codePoint == '\t')
+            {
+                x += getGlyph(' ', bold)->advance * scale * 4;
+                continue;
+            }
+
+            const Glyph& glyph = *getGlyph(codePoint, bold);
+            if ((glyph.textureRect.width > 0) && (glyph.textureRect.height > 0))
+            {
+                const float left = glyph.bounds.left * scale;
+                const float top = glyph.bounds.top * scale;
+                const float right = (glyph.bounds.left + glyph.bounds.width) * scale;
+                const float bottom = (glyph.bounds.top + glyph.bounds.height) * scale;
+
+                const float u1 = static_cast<float>(glyph.textureRect.left);
+                const float v1 = static_cast<float>(glyph.textureRect.top);
+                const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+                const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+
+                vertices.emplace_back(sf::Vector2f{x + left - italic * top, y + top}, color, sf::Vector2f{u1, v1});
+                vertices.emplace_back(sf::Vector2f{x + right - italic * top, y + top}, color, sf::Vector2f{u2, v1});
+                vertices.emplace_back(sf::Vector2f{x + left - italic * bottom, y + bottom}, color, sf::Vector2f{u1, v2});
+                vertices.emplace_back(sf::Vector2f{x + left - italic * bottom, y + bottom}, color, sf::Vector2f{u1, v2});
+                vertices.emplace_back(sf::Vector2f{x + right - italic * top, y + top}, color, sf::Vector2f{u2, v1});
+                vertices.emplace_back(sf::Vector2f{x + right - italic * bottom, y + bottom}, color, sf::Vector2f{u2, v2});
+
+                shelves |= 1u << glyph.shelf;
+            }
+
+            x += glyph.advance * scale;
+        }
+
+        return shelves;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldFont::removeOldGeometry()
+    {
+        // Keep the half of the texts that were drawn most recently
+        std::vector<unsigned long long> lastUses;
+        lastUses.reserve(m_geometryCache.size());
+        for (const auto& geometry : m_geometryCache)
+            lastUses.push_back(geometry.second.lastUse);
+
+        auto median = lastUses.begin() + lastUses.size() / 2;
+        std::nth_element(lastUses.begin(), median, lastUses.end());
+        const unsigned long long oldestKept = *median;
+
+        for (auto it = m_geometryCache.begin(); it != m_geometryCache.end();)
+        {
+            if (it->second.lastUse < oldestKept)
+                it = m_geometryCache.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DistanceFieldFont::setFace(std::unique_ptr<FreeTypeFace> face)
+    {
+#ifdef TGUI_USE_FREETYPE
+        // Only the reference size is ever used, so the size is set once
+        if ((FT_Select_Charmap(face->face, FT_ENCODING_UNICODE) != 0) || (FT_Set_Pixel_Sizes(face->face, 0, ReferenceSize) != 0))
+            return false;
+#endif
+
+        std::lock_guard<std::recursive_mutex> lock{GlyphAtlas::getGlobal().getMutex()};
+        m_face = std::move(face);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldFont::rasterizeGlyph(sf::Uint32 codePoint, bool bold, GlyphMetrics& metrics, std::vector<bool>& insideGlyph)
+    {
+        metrics = {};
+        insideGlyph.clear();
+
+#ifdef TGUI_USE_FREETYPE
+        FT_Face face = m_face->face;
+
+        // The same flags are used as in sf::Font, so that the glyphs look the same as when the font would rasterize them
+        FT_Glyph glyphDesc;
+        if ((FT_Load_Char(face, codePoint, FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT) != 0) || (FT_Get_Glyph(face->glyph, &glyphDesc) != 0))
+            return;
+
+        const FT_Pos weight = 1 << 6;
+        const bool outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+        if (bold && outline)
+            FT_Outline_Embolden(&reinterpret_cast<FT_OutlineGlyph>(glyphDesc)->outline, weight);
+
+        FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
+        FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+        FT_Bitmap& bitmap = bitmapGlyph->bitmap;
+        if (bold && !outline)
+            FT_Bitmap_Embolden(m_face->library, &bitmap, weight, weight);
+
+        metrics.advance = static_cast<float>(face->glyph->metrics.horiAdvance) / (1 << 6);
+        if (bold)
+            metrics.advance += static_cast<float>(weight) / (1 << 6);
+
+        const int width = static_cast<int>(bitmap.width);
+        const int height = static_cast<int>(bitmap.rows);
+        if ((width > 0) && (height > 0))
+        {
+            metrics.bounds = {static_cast<float>(bitmapGlyph->left), static_cast<float>(-bitmapGlyph->top),
+                              static_cast<float>(width), static_cast<float>(height)};
+
+            insideGlyph.resize(width * height);
+            const unsigned char* row = bitmap.buffer;
+            for (int y = 0; y < height; ++y)
+            {
+                for (int x = 0; x < width; ++x)
+                {
+                    if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+                        insideGlyph[y * width + x] = (row[x / 8] & (0x80 >> (x % 8))) != 0;
+                    else
+                        insideGlyph[y * width + x] = row[x] >= 128;
+                }
+
+                row += bitmap.pitch;
+            }
+        }
+
+        FT_Done_Glyph(glyphDesc);
+#else
+        (void)codePoint;
+        (void)bold;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DistanceFieldFont::addGlyph(sf::Uint32 codePoint, bool bold, const GlyphMetrics& metrics, int glyphWidth, int glyphHeight, const std::vector<bool>& insideGlyph)
+    {
+        Glyph glyph;
+        glyph.advance = metrics.advance;
+
+        // Glyphs without pixels (e.g. spaces) only need their advance
+        if ((glyphWidth <= 0) || (glyphHeight <= 0))
+        {
+            m_glyphs[getGlyphKey(codePoint, bold)] = glyph;
+            return true;
+        }
+
+        const int spread = static_cast<int>(Spread);
+        const unsigned int width = static_cast<unsigned int>(glyphWidth + 2 * spread);
+        const unsigned int height = static_cast<unsigned int>(glyphHeight + 2 * spread);
+
+        // Find a free spot in the atlas, which may remove the glyphs that weren't used for the longest time
+        GlyphAtlas& atlas = GlyphAtlas::getGlobal();
+        sf::Vector2u position;
+        if (!atlas.allocate(*this, getGlyphKey(codePoint, bold), width, height, position, glyph.shelf))
+            return false;
+
+        auto isInside = [&](int x, int y) {
+            if ((x < 0) || (y < 0) || (x >= glyphWidth) || (y >= glyphHeight))
+                return false;
+            return static_cast<bool>(insideGlyph[y * glyphWidth + x]);
+        };
+
+        // Search the nearest pixel on the other side of the edge for every pixel, within the spread
+        std::vector<sf::Uint8> distances(width * height);
+        for (int y = 0; y < static_cast<int>(height); ++y)
+        {
+            for (int x = 0; x < static_cast<int>(width); ++x)
+            {
+                const int glyphX = x - spread;
+                const int glyphY = y - spread;
+                const bool inside = isInside(glyphX, glyphY);
+
+                float nearestDistance = static_cast<float>(spread) + 0.5f;
+                for (int dy = -spread; dy <= spread; ++dy)
+                {
+                    for (int dx = -spread; dx <= spread; ++dx)
+                    {
+                        const float distance = std::sqrt(static_cast<float>(dx * dx + dy * dy));
+                        if ((distance < nearestDistance) && (isInside(glyphX + dx, glyphY + dy) != inside))
+                            nearestDistance = distance;
+                    }
+                }
+
+                // The edge lies halfway between the two pixels
+                const float signedDistance = inside ? (nearestDistance - 0.5f) : (0.5f - nearestDistance);
+                const float value = std::max(0.f, std::min(1.f, 0.5f + signedDistance / (2 * spread)));
+                distances[y * width + x] = static_cast<sf::Uint8>(value * 255 + 0.5f);
+            }
+        }
+
+        atlas.update(distances, width, height, position);
+
+        glyph.bounds = {metrics.bounds.left - spread, metrics.bounds.top - spread,
+                        metrics.bounds.width + 2 * spread, metrics.bounds.height + 2 * spread};
+        glyph.textureRect = {static_cast<int>(position.x), static_cast<int>(position.y), static_cast<int>(width), static_cast<int>(height)};
+        m_glyphs[getGlyphKey(codePoint, bold)] = glyph;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextMetrics::TextMetrics(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold) :
+        m_font         (*font),
+        m_characterSize(characterSize),
+        m_bold         (bold)
+    {
+        if (TGUI_DistanceFieldTextEnabled)
+        {
+            m_distanceFieldFont = DistanceFieldFont::get(font);
+            m_scale = static_cast<float>(characterSize) / DistanceFieldFont::ReferenceSize;
+            m_lock = std::unique_lock<std::recursive_mutex>{GlyphAtlas::getGlobal().getMutex()};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getAdvance(sf::Uint32 codePoint)
+    {
+        if (m_distanceFieldFont)
+            return m_distanceFieldFont->getGlyphMetrics(codePoint, m_bold).advance * m_scale;
+        else
+            return static_cast<float>(m_font.getGlyph(codePoint, m_characterSize, m_bold).advance);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getWidth(sf::Uint32 codePoint)
+    {
+        if (m_distanceFieldFont)
+            return m_distanceFieldFont->getGlyphMetrics(codePoint, m_bold).bounds.width * m_scale;
+        else
+            return static_cast<float>(m_font.getGlyph(codePoint, m_characterSize, m_bold).textureRect.width);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect TextMetrics::getBounds(sf::Uint32 codePoint)
+    {
+        if (m_distanceFieldFont)
+        {
+            const sf::FloatRect& bounds = m_distanceFieldFont->getGlyphMetrics(codePoint, m_bold).bounds;
+            return {bounds.left * m_scale, bounds.top * m_scale, bounds.width * m_scale, bounds.height * m_scale};
+        }
+        else
+            return m_font.getGlyph(codePoint, m_characterSize, m_bold).bounds;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getKerning(sf::Uint32 first, sf::Uint32 second) const
+    {
+        if (m_distanceFieldFont)
+            return m_distanceFieldFont->getKerning(first, second, m_characterSize);
+        else
+            return static_cast<float>(m_font.getKerning(first, second, m_characterSize));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextMetrics::getLineSpacing() const
+    {
+        if (m_distanceFieldFont)
+            return m_distanceFieldFont->getLineSpacing(m_characterSize);
+        else
+            return static_cast<float>(m_font.getLineSpacing(m_characterSize));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2f findCharacterPos(const sf::Text& text, const std::shared_ptr<sf::Font>& font, std::size_t index)
+    {
+        if (!TGUI_DistanceFieldTextEnabled || !font || (text.getFont() != font.get()))
+            return text.findCharacterPos(index);
+
+        const sf::String& string = text.getString();
+        index = std::min(index, string.getSize());
+
+        TextMetrics metrics{font, text.getCharacterSize(), (text.getStyle() & sf::Text::Bold) != 0};
+
+        sf::Vector2f position;
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            const sf::Uint32 curChar = string[i];
+            position.x += metrics.getKerning(prevChar, curChar);
+            prevChar = curChar;
+
+            if (curChar == '\n')
+            {
+                position.y += metrics.getLineSpacing();
+                position.x = 0;
+            }
+            else if (curChar == '\t')
+                position.x += metrics.getAdvance(' ') * 4;
+            else
+                position.x += metrics.getAdvance(curChar);
+        }
+
+        return text.getTransform().transformPoint(position);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::FloatRect getTextBounds(const sf::Text& text, const std::shared_ptr<sf::Font>& font)
+    {
+        if (!TGUI_DistanceFieldTextEnabled || !font || (text.getFont() != font.get()))
+            return text.getLocalBounds();
+
+        const sf::String& string = text.getString();
+        if (string.isEmpty())
+            return {};
+
+        const unsigned int characterSize = text.getCharacterSize();
+        const float italic = (text.getStyle() & sf::Text::Italic) ? 0.208f : 0.f;
+        TextMetrics metrics{font, characterSize, (text.getStyle() & sf::Text::Bold) != 0};
+
+        // The bounds are calculated in the same way as sf::Text does
+        float minX = static_cast<float>(characterSize);
+        float minY = static_cast<float>(characterSize);
+        float maxX = 0;
+        float maxY = 0;
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        sf::Uint32 prevChar = 0;
+        for (auto curChar : string)
+        {
+            x += metrics.getKerning(prevChar, curChar);
+            prevChar = curChar;
+
+            if ((curChar == ' ') || (curChar == '\t') || (curChar == '\n'))
+            {
+                minX = std::min(minX, x);
+                minY = std::min(minY, y);
+
+                if (curChar == ' ')
+                    x += metrics.getAdvance(' ');
+                else if (curChar == '\t')
+                    x += metrics.getAdvance(' ') * 4;
+                else
+                {
+                    y += metrics.getLineSpacing();
+                    x = 0;
+                }
+
+                maxX = std::max(maxX, x);
+                maxY = std::max(maxY, y);
+                continue;
+            }
+
+            const sf::FloatRect bounds = metrics.getBounds(curChar);
+            minX = std::min(minX, x + bounds.left - italic * (bounds.top + bounds.height));
+            maxX = std::max(maxX, x + bounds.left + bounds.width - italic * bounds.top);
+            minY = std::min(minY, y + bounds.top);
+            maxY = std::max(maxY, y + bounds.top + bounds.height);
+
+            x += metrics.getAdvance(curChar);
+        }
+
+        return {minX, minY, maxX - minX, maxY - minY};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Shader* getDistanceFieldShader()
+    {
+        // The shader is created only once, other threads that draw text at the same time wait until it is ready
+        static const std::unique_ptr<sf::Shader> shader = []() -> std::unique_ptr<sf::Shader>
+            {
+                if (!sf::Shader::isAvailable())
+                    return nullptr;
+
+                std::unique_ptr<sf::Shader> newShader{new sf::Shader};
+                if (!newShader->loadFromMemory(fragmentShader, sf::Shader::Fragment))
+                    return nullptr;
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                newShader->setUniform("texture", sf::Shader::CurrentTexture);
+#else
+                newShader->setParameter("texture", sf::Shader::CurrentTexture);
+#endif
+                return newShader;
+            }();
+
+        return shader.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void drawText(sf::RenderTarget& target, sf::RenderStates states, const sf::Text& text, const std::shared_ptr<sf::Font>& font)
+    {
+        if (TGUI_DistanceFieldTextEnabled && font && (text.getFont() == font.get()))
+        {
+            sf::Shader* shader = getDistanceFieldShader();
+            if (shader)
+            {
+                // Other threads may not replace glyphs in the atlas until the text has been drawn
+                auto distanceFieldFont = DistanceFieldFont::get(font);
+                std::lock_guard<std::recursive_mutex> lock{GlyphAtlas::getGlobal().getMutex()};
+                const std::vector<sf::Vertex>* vertices = distanceFieldFont->getGeometry(text);
+                if (vertices)
+                {
+                    if (vertices->empty())
+                        return;
+
+                    states.transform *= text.getTransform();
+                    states.texture = &distanceFieldFont->getTexture();
+                    states.shader = shader;
+                    target.draw(vertices->data(), vertices->size(), sf::Triangles, states);
+                    return;
+                }
+            }
+        }
+
+        target.draw(text, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,422 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/EventRecorder.hpp>
+
+#include <fstream>
+#include <cstring>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Every recording starts with these bytes, the last one being the version of the format
+    const char recordingHeader[] = {'T', 'G', 'U', 'I', 'R', 'E', 'C', 1};
+
+    // Tag that is written instead of an event type to mark a time update
+    const unsigned char timeTag = 255;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Unsigned values are written with 7 bits per byte, so that small values only take a single byte
+    void writeUnsigned(std::ostream& stream, sf::Uint64 value)
+    {
+        while (value >= 0x80)
+        {
+            stream.put(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+
+        stream.put(static_cast<char>(value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Signed values are zigzag encoded so that small negative numbers also remain small
+    void writeSigned(std::ostream& stream, sf::Int64 value)
+    {
+        writeUnsigned(stream, (static_cast<sf::Uint64>(value) << 1) ^ static_cast<sf::Uint64>(value >> 63));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeFloat(std::ostream& stream, float value)
+    {
+        sf::Uint32 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeUnsigned(stream, bits);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Uint64 readUnsigned(std::istream& stream)
+    {
+        sf::Uint64 value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7)
+        {
+            const int c = stream.get();
+            if (c == std::char_traits<char>::eof())
+                throw tgui::Exception{"Failed to read event recording, unexpected end of data."};
+
+            value |= static_cast<sf::Uint64>(c & 0x7F) << shift;
+            if ((c & 0x80) == 0)
+                return value;
+        }
+
+        throw tgui::Exception{"Failed to read event recording, value is too large."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Int64 readSigned(std::istream& stream)
+    {
+        const sf::Uint64 value = readUnsigned(stream);
+        return static_cast<sf::Int64>(value >> 1) ^ -static_cast<sf::Int64>(value & 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float readFloat(std::istream& stream)
+    {
+        const sf::Uint32 bits = static_cast<sf::Uint32>(readUnsigned(stream));
+
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void writeEvent(std::ostream& stream, const sf::Event& event)
+    {
+        stream.put(static_cast<char>(event.type));
+
+        switch (event.type)
+        {
+            case sf::Event::Resized:
+                writeUnsigned(stream, event.size.width);
+                writeUnsigned(stream, event.size.height);
+                break;
+
+            case sf::Event::TextEntered:
+                writeUnsigned(stream, event.text.unicode);
+                break;
+
+            case sf::Event::KeyPressed:
+            case sf::Event::KeyReleased:
+                writeSigned(stream, event.key.code);
+                writeUnsigned(stream, (event.key.alt ? 1 : 0) | (event.key.control ? 2 : 0) | (event.key.shift ? 4 : 0) | (event.key.system ? 8 : 0));
+                break;
+
+            case sf::Event::MouseWheelMoved:
+                writeSigned(stream, event.mouseWheel.delta);
+                writeSigned(stream, event.mouseWheel.x);
+                writeSigned(stream, event.mouseWheel.y);
+                break;
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 3)
+            case sf::Event::MouseWheelScrolled:
+                writeSigned(stream, event.mouseWheelScroll.wheel);
+                writeFloat(stream, event.mouseWheelScroll.delta);
+                writeSigned(stream, event.mouseWheelScroll.x);
+                writeSigned(stream, event.mouseWheelScroll.y);
+                break;
+#endif
+
+            case sf::Event::MouseButtonPressed:
+            case sf::Event::MouseButtonReleased:
+                writeSigned(stream, event.mouseButton.button);
+                writeSigned(stream, event.mouseButton.x);
+                writeSigned(stream, event.mouseButton.y);
+                break;
+
+            case sf::Event::MouseMoved:
+                writeSigned(stream, event.mouseMove.x);
+                writeSigned(stream, event.mouseMove.y);
+                break;
+
+            case sf::Event::JoystickButtonPressed:
+            case sf::Event::JoystickButtonReleased:
+                writeUnsigned(stream, event.joystickButton.joystickId);
+                writeUnsigned(stream, event.joystickButton.button);
+                break;
+
+            case sf::Event::JoystickMoved:
+                writeUnsigned(stream, event.joystickMove.joystickId);
+                writeSigned(stream, event.joystickMove.axis);
+                writeFloat(stream, event.joystickMove.position);
+                break;
+
+            case sf::Event::JoystickConnected:
+            case sf::Event::JoystickDisconnected:
+                writeUnsigned(stream, event.joystickConnect.joystickId);
+                break;
+
+            case sf::Event::TouchBegan:
+            case sf::Event::TouchMoved:
+            case sf::Event::TouchEnded:
+                writeUnsigned(stream, event.touch.finger);
+                writeSigned(stream, event.touch.x);
+                writeSigned(stream, event.touch.y);
+                break;
+
+            case sf::Event::SensorChanged:
+                writeSigned(stream, event.sensor.type);
+                writeFloat(stream, event.sensor.x);
+                writeFloat(stream, event.sensor.y);
+                writeFloat(stream, event.sensor.z);
+                break;
+
+            default: // Events without data
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Event readEvent(std::istream& stream, unsigned char type)
+    {
+        if (type >= sf::Event::Count)
+            throw tgui::Exception{"Failed to read event recording, unknown event type " + tgui::to_string(static_cast<unsigned int>(type)) + "."};
+
+        sf::Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.type = static_cast<sf::Event::EventType>(type);
+
+        switch (event.type)
+        {
+            case sf::Event::Resized:
+                event.size.width = static_cast<unsigned int>(readUnsigned(stream));
+                event.size.height = static_cast<unsigned int>(readUnsigned(stream));
+                break;
+
+            case sf::Event::TextEntered:
+                event.text.unicode = static_cast<sf::Uint32>(readUnsigned(stream));
+                break;
+
+            case sf::Event::KeyPressed:
+            case sf::Event::KeyReleased:
+            {
+                event.key.code = static_cast<sf::Keyboard::Key>(readSigned(stream));
+                const sf::Uint64 modifiers = readUnsigned(stream);
+                event.key.alt = ((modifiers & 1) != 0);
+                event.key.control = ((modifiers & 2) != 0);
+                event.key.shift = ((modifiers & 4) != 0);
+                event.key.system = ((modifiers & 8) != 0);
+                break;
+            }
+
+            case sf::Event::MouseWheelMoved:
+                event.mouseWheel.delta = static_cast<int>(readSigned(stream));
+                event.mouseWheel.x = static_cast<int>(readSigned(stream));
+                event.mouseWheel.y = static_cast<int>(readSigned(stream));
+                break;
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 3)
+            case sf::Event::MouseWheelScrolled:
+                event.mouseWheelScroll.wheel = static_cast<sf::Mouse::Wheel>(readSigned(stream));
+                event.mouseWheelScroll.delta = readFloat(stream);
+                event.mouseWheelScroll.x = static_cast<int>(readSigned(stream));
+                event.mouseWheelScroll.y = static_cast<int>(readSigned(stream));
+                break;
+#endif
+
+            case sf::Event::MouseButtonPressed:
+            case sf::Event::MouseButtonReleased:
+                event.mouseButton.button = static_cast<sf::Mouse::Button>(readSigned(stream));
+                event.mouseButton.x = static_cast<int>(readSigned(stream));
+                event.mouseButton.y = static_cast<int>(readSigned(stream));
+                break;
+
+            case sf::Event::MouseMoved:
+                event.mouseMove.x = static_cast<int>(readSigned(stream));
+                event.mouseMove.y = static_cast<int>(readSigned(stream));
+                break;
+
+            case sf::Event::JoystickButtonPressed:
+            case sf::Event::JoystickButtonReleased:
+                event.joystickButton.joystickId = static_cast<unsigned int>(readUnsigned(stream));
+                event.joystickButton.button = static_cast<unsigned int>(readUnsigned(stream));
+                break;
+
+            case sf::Event::JoystickMoved:
+                event.joystickMove.joystickId = static_cast<unsigned int>(readUnsigned(stream));
+                event.joystickMove.axis = static_cast<sf::Joystick::Axis>(readSigned(stream));
+                event.joystickMove.position = readFloat(stream);
+                break;
+
+            case sf::Event::JoystickConnected:
+            case sf::Event::JoystickDisconnected:
+                event.joystickConnect.joystickId = static_cast<unsigned int>(readUnsigned(stream));
+                break;
+
+            case sf::Event::TouchBegan:
+            case sf::Event::TouchMoved:
+            case sf::Event::TouchEnded:
+                event.touch.finger = static_cast<unsigned int>(readUnsigned(stream));
+                event.touch.x = static_cast<int>(readSigned(stream));
+                event.touch.y = static_cast<int>(readSigned(stream));
+                break;
+
+            case sf::Event::SensorChanged:
+                event.sensor.type = static_cast<sf::Sensor::Type>(readSigned(stream));
+                event.sensor.x = readFloat(stream);
+                event.sensor.y = readFloat(stream);
+                event.sensor.z = readFloat(stream);
+                break;
+
+            default: // Events without data
+                break;
+        }
+
+        return event;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    EventRecorder::Ptr EventRecorder::create()
+    {
+        return std::make_shared<EventRecorder>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecorder::recordEvent(const sf::Event& event)
+    {
+        if (!m_paused)
+            m_entries.push_back({true, event, sf::Time::Zero});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecorder::recordTime(sf::Time elapsedTime)
+    {
+        if (!m_paused)
+        {
+            Entry entry;
+            entry.isEvent = false;
+            entry.elapsedTime = elapsedTime;
+            m_entries.push_back(entry);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecorder::setPaused(bool paused)
+    {
+        m_paused = paused;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecorder::clear()
+    {
+        m_entries.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecorder::saveToFile(const std::string& filename) const
+    {
+        std::ofstream file{filename, std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + filename + "' to save the event recording."};
+
+        saveToStream(file);
+        if (!file)
+            throw Exception{"Failed to write event recording to '" + filename + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecorder::loadFromFile(const std::string& filename)
+    {
+        std::ifstream file{filename, std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + filename + "' to load the event recording."};
+
+        loadFromStream(file);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecorder::saveToStream(std::ostream& stream) const
+    {
+        stream.write(recordingHeader, sizeof(recordingHeader));
+
+        for (auto& entry : m_entries)
+        {
+            if (entry.isEvent)
+                writeEvent(stream, entry.event);
+            else
+            {
+                stream.put(static_cast<char>(timeTag));
+                writeSigned(stream, entry.elapsedTime.asMicroseconds());
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EventRecorder::loadFromStream(std::istream& stream)
+    {
+        char header[sizeof(recordingHeader)];
+        if (!stream.read(header, sizeof(header)) || (std::memcmp(header, recordingHeader, sizeof(header)) != 0))
+            throw Exception{"Failed to read event recording, the data does not start with a valid header."};
+
+        std::vector<Entry> entries;
+        int tag;
+        while ((tag = stream.get()) != std::char_traits<char>::eof())
+        {
+            Entry entry;
+            if (static_cast<unsigned char>(tag) == timeTag)
+            {
+                entry.isEvent = false;
+                entry.elapsedTime = sf::microseconds(readSigned(stream));
+            }
+            else
+            {
+                entry.isEvent = true;
+                entry.event = readEvent(stream, static_cast<unsigned char>(tag));
+            }
+
+            entries.push_back(entry);
+        }
+
+        m_entries = std::move(entries);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
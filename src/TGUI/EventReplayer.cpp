@@ -0,0 +1,211 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/EventReplayer.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Loading/WidgetSaver.hpp>
+#include <TGUI/Loading/DataIO.hpp>
+
+#include <cstring>
+#include <sstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // 64-bit FNV-1a hash, which is fast and gives the same result on every platform
+    class Checksum
+    {
+    public:
+
+        void add(const void* data, std::size_t size)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                m_value ^= bytes[i];
+                m_value *= 1099511628211ULL;
+            }
+        }
+
+        void add(sf::Uint32 value)
+        {
+            const unsigned char bytes[] = {static_cast<unsigned char>(value), static_cast<unsigned char>(value >> 8),
+                                           static_cast<unsigned char>(value >> 16), static_cast<unsigned char>(value >> 24)};
+            add(bytes, sizeof(bytes));
+        }
+
+        void add(float value)
+        {
+            sf::Uint32 bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            add(bits);
+        }
+
+        void add(sf::Vector2f value)
+        {
+            add(value.x);
+            add(value.y);
+        }
+
+        void add(const sf::String& value)
+        {
+            add(static_cast<sf::Uint32>(value.getSize()));
+            for (std::size_t i = 0; i < value.getSize(); ++i)
+                add(static_cast<sf::Uint32>(value[i]));
+        }
+
+        sf::Uint64 getValue() const
+        {
+            return m_value;
+        }
+
+    private:
+        sf::Uint64 m_value = 14695981039346656037ULL;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The contents of a widget (text, value, selected item, ...) are taken from what it would write to a widget file.
+    // The saved form of a container already includes its children, so their contents are only added once.
+    void addWidgetsToChecksum(Checksum& checksum, const tgui::Container& container, bool addContents)
+    {
+        const auto& widgets = container.getWidgets();
+        const auto& widgetNames = container.getWidgetNames();
+
+        checksum.add(static_cast<sf::Uint32>(widgets.size()));
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+        {
+            const auto& widget = widgets[i];
+            checksum.add(static_cast<sf::Uint32>(widget->getWidgetTypeId()));
+            checksum.add(widgetNames[i]);
+            checksum.add(widget->getPosition());
+            checksum.add(widget->getSize());
+            checksum.add(static_cast<sf::Uint32>((widget->isVisible() ? 1 : 0) | (widget->isEnabled() ? 2 : 0) | (widget->isFocused() ? 4 : 0)));
+
+            bool childContentsAdded = false;
+            if (addContents)
+            {
+                const auto saveFunction = tgui::WidgetSaver::getSaveFunction(widget->getWidgetType());
+                if (saveFunction)
+                {
+                    std::stringstream stream;
+                    tgui::DataIO::Emitter emitter{stream};
+                    emitter.writeNode(*saveFunction(tgui::WidgetConverter{widget}));
+
+                    const std::string contents = stream.str();
+                    checksum.add(static_cast<sf::Uint32>(contents.size()));
+                    checksum.add(contents.data(), contents.size());
+                    childContentsAdded = true;
+                }
+            }
+
+            auto childContainer = std::dynamic_pointer_cast<tgui::Container>(widget);
+            if (childContainer)
+                addWidgetsToChecksum(checksum, *childContainer, addContents && !childContentsAdded);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<EventReplayer::Frame> EventReplayer::replay(const EventRecorder& recording, Gui& gui, bool draw)
+    {
+        std::vector<Frame> frames;
+
+        sf::Clock clock;
+        Frame frame;
+        for (auto& entry : recording.getEntries())
+        {
+            if (entry.isEvent)
+            {
+                clock.restart();
+                gui.handleEvent(entry.event);
+                frame.eventDuration += clock.getElapsedTime();
+                frame.events++;
+            }
+            else
+            {
+                frame.elapsedTime = entry.elapsedTime;
+
+                clock.restart();
+                gui.updateTime(entry.elapsedTime);
+                frame.updateDuration = clock.getElapsedTime();
+
+                if (draw)
+                {
+                    clock.restart();
+                    gui.drawWidgets();
+                    frame.drawDuration = clock.getElapsedTime();
+                }
+
+                frame.checksum = getChecksum(gui);
+                frames.push_back(frame);
+                frame = Frame{};
+            }
+        }
+
+        // Events that were handled after the last time update still form a frame
+        if (frame.events > 0)
+        {
+            if (draw)
+            {
+                clock.restart();
+                gui.drawWidgets();
+                frame.drawDuration = clock.getElapsedTime();
+            }
+
+            frame.checksum = getChecksum(gui);
+            frames.push_back(frame);
+        }
+
+        return frames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Uint64 EventReplayer::getChecksum(const Gui& gui)
+    {
+        return getChecksum(*gui.getContainer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Uint64 EventReplayer::getChecksum(const Container& container)
+    {
+        Checksum checksum;
+        addWidgetsToChecksum(checksum, container, true);
+        return checksum.getValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
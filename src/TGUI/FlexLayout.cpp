@@ -0,0 +1,449 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/FlexLayout.hpp>
+#include <TGUI/RenderBackend.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::FlexLayout()
+    {
+        setWidgetType(WidgetType::FlexLayout);
+
+        setBackgroundColor(sf::Color::Transparent);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Ptr FlexLayout::create(Direction direction)
+    {
+        auto layout = std::make_shared<FlexLayout>();
+        layout->setDirection(direction);
+        return layout;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Ptr FlexLayout::copy(FlexLayout::ConstPtr layout)
+    {
+        if (layout)
+            return std::static_pointer_cast<FlexLayout>(layout->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setSize(const Layout2d& size)
+    {
+        Panel::setSize(size);
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::add(const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        insert(m_widgets.size(), widget, widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName)
+    {
+        Container::add(widget, widgetName);
+
+        Item item;
+        item.preferredSize = widget->getFullSize();
+
+        if (index >= m_widgets.size())
+        {
+            m_items.push_back(item);
+            updateWidgetPositions();
+            return false;
+        }
+        else
+        {
+            m_widgets.insert(m_widgets.begin() + index, widget);
+            m_widgets.pop_back(); // The widget was added at the back with Container::add
+
+            m_objName.insert(m_objName.begin() + index, m_objName.back());
+            m_objName.pop_back();
+
+            m_internedObjName.insert(m_internedObjName.begin() + index, m_internedObjName.back());
+            m_internedObjName.pop_back();
+
+            m_items.insert(m_items.begin() + index, item);
+            updateWidgetPositions();
+            return true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::remove(const Widget::Ptr& widget)
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i] == widget)
+            {
+                Container::remove(widget);
+                m_items.erase(m_items.begin() + i);
+                updateWidgetPositions();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::removeAllWidgets()
+    {
+        Container::removeAllWidgets();
+        m_items.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setDirection(Direction direction)
+    {
+        m_direction = direction;
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setWrap(bool wrap)
+    {
+        m_wrap = wrap;
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setGap(float gap)
+    {
+        m_gap = gap;
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setJustify(Justify justify)
+    {
+        m_justify = justify;
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setAlignment(Alignment alignment)
+    {
+        m_alignment = alignment;
+        updateWidgetPositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setGrow(const Widget::Ptr& widget, float grow)
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i] == widget)
+            {
+                m_items[i].grow = grow;
+                updateWidgetPositions();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FlexLayout::getGrow(const Widget::Ptr& widget) const
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i] == widget)
+                return m_items[i].grow;
+        }
+
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setShrink(const Widget::Ptr& widget, float shrink)
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i] == widget)
+            {
+                m_items[i].shrink = shrink;
+                updateWidgetPositions();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FlexLayout::getShrink(const Widget::Ptr& widget) const
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i] == widget)
+                return m_items[i].shrink;
+        }
+
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setBasis(const Widget::Ptr& widget, float basis)
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i] == widget)
+            {
+                m_items[i].basis = basis;
+                updateWidgetPositions();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FlexLayout::getBasis(const Widget::Ptr& widget) const
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i] == widget)
+            {
+                if (m_items[i].basis >= 0)
+                    return m_items[i].basis;
+                else if (m_direction == Direction::Row)
+                    return m_items[i].preferredSize.x;
+                else
+                    return m_items[i].preferredSize.y;
+            }
+        }
+
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::updateWidgetPositions()
+    {
+        const bool row = (m_direction == Direction::Row);
+        const float mainAvailable = row ? getSize().x : getSize().y;
+        const float crossAvailable = row ? getSize().y : getSize().x;
+
+        // Measure pass: determine the basis sizes and split the children into lines
+        m_geometry.resize(m_items.size());
+        m_lineStarts.clear();
+        m_lineCrossSizes.clear();
+
+        float lineMain = 0;
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            const Item& item = m_items[i];
+            ItemGeometry& geometry = m_geometry[i];
+            geometry.mainSize = (item.basis >= 0) ? item.basis : (row ? item.preferredSize.x : item.preferredSize.y);
+            geometry.crossSize = row ? item.preferredSize.y : item.preferredSize.x;
+
+            if (m_lineStarts.empty() || (m_wrap && (lineMain + m_gap + geometry.mainSize > mainAvailable)))
+            {
+                m_lineStarts.push_back(i);
+                m_lineCrossSizes.push_back(geometry.crossSize);
+                lineMain = geometry.mainSize;
+            }
+            else
+            {
+                m_lineCrossSizes.back() = std::max(m_lineCrossSizes.back(), geometry.crossSize);
+                lineMain += m_gap + geometry.mainSize;
+            }
+        }
+
+        // A single line that doesn't wrap always fills the layout
+        if (!m_wrap && !m_lineCrossSizes.empty())
+            m_lineCrossSizes[0] = crossAvailable;
+
+        // Arrange pass: grow or shrink the children on each line and place them
+        float crossOffset = 0;
+        for (std::size_t line = 0; line < m_lineStarts.size(); ++line)
+        {
+            const std::size_t begin = m_lineStarts[line];
+            const std::size_t end = (line + 1 < m_lineStarts.size()) ? m_lineStarts[line + 1] : m_items.size();
+            const float lineCrossSize = m_lineCrossSizes[line];
+
+            float usedSpace = m_gap * (end - begin - 1);
+            float totalGrow = 0;
+            float totalScaledShrink = 0;
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                usedSpace += m_geometry[i].mainSize;
+                totalGrow += m_items[i].grow;
+                totalScaledShrink += m_items[i].shrink * m_geometry[i].mainSize;
+            }
+
+            float freeSpace = mainAvailable - usedSpace;
+            if ((freeSpace > 0) && (totalGrow > 0))
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                    m_geometry[i].mainSize += freeSpace * m_items[i].grow / totalGrow;
+
+                freeSpace = 0;
+            }
+            else if ((freeSpace < 0) && (totalScaledShrink > 0))
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const float shrinkSize = -freeSpace * m_items[i].shrink * m_geometry[i].mainSize / totalScaledShrink;
+                    m_geometry[i].mainSize = std::max(0.f, m_geometry[i].mainSize - shrinkSize);
+                }
+
+                freeSpace = 0;
+            }
+
+            float mainOffset = 0;
+            float spacing = m_gap;
+            if (freeSpace > 0)
+            {
+                const std::size_t count = end - begin;
+                switch (m_justify)
+                {
+                    case Justify::Start:
+                        break;
+                    case Justify::Center:
+                        mainOffset = freeSpace / 2.f;
+                        break;
+                    case Justify::End:
+                        mainOffset = freeSpace;
+                        break;
+                    case Justify::SpaceBetween:
+                        if (count > 1)
+                            spacing += freeSpace / (count - 1);
+                        else
+                            mainOffset = freeSpace / 2.f;
+                        break;
+                    case Justify::SpaceAround:
+                        mainOffset = freeSpace / (2.f * count);
+                        spacing += freeSpace / count;
+                        break;
+                }
+            }
+
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                float crossSize = m_geometry[i].crossSize;
+                float crossPos = crossOffset;
+                switch (m_alignment)
+                {
+                    case Alignment::Start:
+                        break;
+                    case Alignment::Center:
+                        crossPos += (lineCrossSize - crossSize) / 2.f;
+                        break;
+                    case Alignment::End:
+                        crossPos += lineCrossSize - crossSize;
+                        break;
+                    case Alignment::Stretch:
+                        crossSize = lineCrossSize;
+                        break;
+                }
+
+                sf::Vector2f position = row ? sf::Vector2f{mainOffset, crossPos} : sf::Vector2f{crossPos, mainOffset};
+                sf::Vector2f size = row ? sf::Vector2f{m_geometry[i].mainSize, crossSize} : sf::Vector2f{crossSize, m_geometry[i].mainSize};
+                mainOffset += m_geometry[i].mainSize + spacing;
+
+                // Correct the size for widgets that have borders around it or a text next to them
+                const Widget::Ptr& widget = m_widgets[i];
+                const sf::Vector2f extraSize = widget->getFullSize() - widget->getSize();
+                if ((size.x - extraSize.x > 0) && (size.y - extraSize.y > 0))
+                {
+                    size -= extraSize;
+                    position += widget->getWidgetOffset();
+                }
+
+                // Only touch the widget when something changed, to avoid sending signals and rebinding layouts
+                if (widget->getSize() != size)
+                    widget->setSize(size);
+                if (widget->getPosition() != position)
+                    widget->setPosition(position);
+            }
+
+            crossOffset += lineCrossSize + m_gap;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        // Set the position
+        transform.translate(getPosition());
+
+        // Draw the background
+        if (m_backgroundColor != sf::Color::Transparent)
+        {
+            sf::RectangleShape background(getSize());
+            background.setFillColor(m_backgroundColor);
+            commands.addShape(transform, background);
+        }
+
+        // Draw the widgets
+        emitWidgetContainerCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
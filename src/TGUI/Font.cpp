@@ -25,6 +25,46 @@
 
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <deque>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Glyphs that still have to be loaded after preloadIncrementally was called
+    struct IncrementalPreload
+    {
+        std::weak_ptr<sf::Font> font;
+        sf::String characters;
+        std::vector<unsigned int> characterSizes;
+        bool bold;
+
+        // Distance field glyphs only have to be loaded once for all sizes
+        bool distanceField;
+
+        // The next glyph that has to be loaded
+        std::size_t sizeIndex;
+        std::size_t characterIndex;
+    };
+
+    // Fonts can't be shared between threads, so every thread continues its own preloads
+    thread_local std::deque<IncrementalPreload> incrementalPreloads;
+
+    sf::String getCharacterRange(sf::Uint32 firstCodePoint, sf::Uint32 lastCodePoint)
+    {
+        std::basic_string<sf::Uint32> characters;
+        if (firstCodePoint > lastCodePoint)
+            return characters;
+
+        for (sf::Uint32 codePoint = firstCodePoint; codePoint != lastCodePoint; ++codePoint)
+            characters += codePoint;
+
+        characters += lastCodePoint;
+
+        return sf::String{characters};
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -80,6 +120,87 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preload(sf::Uint32 firstCodePoint, sf::Uint32 lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold) const
+    {
+        preload(getCharacterRange(firstCodePoint, lastCodePoint), characterSizes, bold);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preload(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool bold) const
+    {
+        if (!m_font)
+            return;
+
+        // Distance field glyphs don't depend on the text size
+        if (TGUI_DistanceFieldTextEnabled)
+        {
+            priv::DistanceFieldFont::get(m_font)->loadGlyphs(characters, bold);
+            return;
+        }
+
+        for (auto characterSize : characterSizes)
+        {
+            for (auto codePoint : characters)
+                m_font->getGlyph(codePoint, characterSize, bold);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preloadIncrementally(sf::Uint32 firstCodePoint, sf::Uint32 lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold) const
+    {
+        preloadIncrementally(getCharacterRange(firstCodePoint, lastCodePoint), characterSizes, bold);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preloadIncrementally(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool bold) const
+    {
+        if (!m_font || characters.isEmpty() || characterSizes.empty())
+            return;
+
+        incrementalPreloads.push_back({m_font, characters, characterSizes, bold, TGUI_DistanceFieldTextEnabled, 0, 0});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isPreloadingIncrementally()
+    {
+        return !incrementalPreloads.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::continueIncrementalPreload(sf::Time maxDuration)
+    {
+        sf::Clock clock;
+        while (!incrementalPreloads.empty() && (clock.getElapsedTime() < maxDuration))
+        {
+            auto& preload = incrementalPreloads.front();
+            auto font = preload.font.lock();
+            if (!font)
+            {
+                incrementalPreloads.pop_front();
+                continue;
+            }
+
+            if (preload.distanceField)
+                priv::DistanceFieldFont::get(font)->loadGlyphs(sf::String{preload.characters[preload.characterIndex]}, preload.bold);
+            else
+                font->getGlyph(preload.characters[preload.characterIndex], preload.characterSizes[preload.sizeIndex], preload.bold);
+
+            if (++preload.characterIndex == preload.characters.getSize())
+            {
+                preload.characterIndex = 0;
+                if (preload.distanceField || (++preload.sizeIndex == preload.characterSizes.size()))
+                    incrementalPreloads.pop_front();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,8 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/Context.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
 #include <TGUI/Texture.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
@@ -40,7 +42,7 @@ namespace tgui
 
     bool TGUI_TabKeyUsageEnabled = true;
 
-    std::string TGUI_ResourcePath = "";
+    bool TGUI_DistanceFieldTextEnabled = false;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -58,22 +60,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void setResourcePath(const std::string& path)
+    void enableDistanceFieldText()
     {
-        TGUI_ResourcePath = path;
+        TGUI_DistanceFieldTextEnabled = true;
+    }
 
-        if (!TGUI_ResourcePath.empty())
-        {
-            if (TGUI_ResourcePath[TGUI_ResourcePath.length()-1] != '/')
-                TGUI_ResourcePath.push_back('/');
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void disableDistanceFieldText()
+    {
+        TGUI_DistanceFieldTextEnabled = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void setResourcePath(const std::string& path)
+    {
+        Context::getGlobal().setResourcePath(path);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::string& getResourcePath()
+    std::string getResourcePath()
     {
-        return TGUI_ResourcePath;
+        return Context::getGlobal().getResourcePath();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -205,15 +215,14 @@ namespace tgui
         if (!font)
             return 0;
 
-        bool bold = (style & sf::Text::Bold) != 0;
+        priv::TextMetrics metrics{font, characterSize, (style & sf::Text::Bold) != 0};
 
         // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        float lineHeight = characterSize
-                           + font->getGlyph('g', characterSize, bold).bounds.height
-                           + font->getGlyph('g', characterSize, bold).bounds.top;
+        const sf::FloatRect bounds = metrics.getBounds('g');
+        float lineHeight = characterSize + bounds.height + bounds.top;
 
         // Get the line spacing sfml returns
-        float lineSpacing = font->getLineSpacing(characterSize);
+        float lineSpacing = metrics.getLineSpacing();
 
         // Calculate the offset of the text
         return lineHeight - lineSpacing;
@@ -233,16 +242,16 @@ namespace tgui
         for (unsigned int i = 0; i < static_cast<unsigned int>(height); ++i)
             textSizes[i] = i + 1;
 
-        auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height, [&font](unsigned int charSize, float h){ return font->getLineSpacing(charSize) < h; });
+        auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height, [&font](unsigned int charSize, float h){ return priv::TextMetrics{font, charSize}.getLineSpacing() < h; });
         if (high == textSizes.end())
             return static_cast<unsigned int>(height);
 
-        float highLineSpacing = font->getLineSpacing(*high);
+        float highLineSpacing = priv::TextMetrics{font, *high}.getLineSpacing();
         if (highLineSpacing == height)
             return *high;
 
         auto low = high - 1;
-        float lowLineSpacing = font->getLineSpacing(*low);
+        float lowLineSpacing = priv::TextMetrics{font, *low}.getLineSpacing();
 
         if (fit < 0)
             return *low;
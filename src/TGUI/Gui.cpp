@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/ToolTip.hpp>
 #include <TGUI/Gui.hpp>
 #include <TGUI/DefaultFont.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
 
 #include <SFML/OpenGL.hpp>
 
@@ -35,6 +36,27 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // All guis on the same thread share the default font, so that its glyphs are only rendered once
+        std::shared_ptr<sf::Font> getDefaultFont()
+        {
+            thread_local std::weak_ptr<sf::Font> sharedFont;
+
+            auto font = sharedFont.lock();
+            if (font)
+                return font;
+
+            font = std::make_shared<sf::Font>();
+            if (!font->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
+                return nullptr;
+
+            priv::DistanceFieldFont::setFontData(font, defaultFontBytes, sizeof(defaultFontBytes));
+            sharedFont = font;
+            return font;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui() :
@@ -43,9 +65,7 @@ namespace tgui
     {
         m_container->m_focused = true;
 
-        sf::Font defaultFont;
-        if (defaultFont.loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
-            setFont(defaultFont);
+        setFont(getDefaultFont());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,9 +81,7 @@ namespace tgui
 
         setView(window.getDefaultView());
 
-        sf::Font defaultFont;
-        if (defaultFont.loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
-            setFont(defaultFont);
+        setFont(getDefaultFont());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -77,9 +95,7 @@ namespace tgui
 
         setView(window.getDefaultView());
 
-        sf::Font defaultFont;
-        if (defaultFont.loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
-            setFont(defaultFont);
+        setFont(getDefaultFont());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -117,7 +133,9 @@ namespace tgui
             m_view = view;
 
             m_container->m_size = view.getSize();
-            m_container->m_callback.size = m_container->getSize();
+            if (m_container->m_callback)
+                m_container->m_callback->size = m_container->getSize();
+
             m_container->sendSignal("SizeChanged", m_container->getSize());
         }
         else // Set it anyway in case something changed that we didn't care to check
@@ -130,6 +148,10 @@ namespace tgui
     {
         assert(m_window != nullptr);
 
+        // The event is recorded before its coordinates are mapped, as the gui will map them again when replaying
+        if (m_eventRecorder)
+            m_eventRecorder->recordEvent(event);
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -218,18 +240,29 @@ namespace tgui
     {
         assert(m_window != nullptr);
 
-        // Make sure the right opengl context is set when clipping
-        if (dynamic_cast<sf::RenderWindow*>(m_window))
-            dynamic_cast<sf::RenderWindow*>(m_window)->setActive(true);
-        else if (dynamic_cast<sf::RenderTexture*>(m_window))
-            dynamic_cast<sf::RenderTexture*>(m_window)->setActive(true);
-
         // Update the time
         if (m_container->m_focused)
             updateTime(m_clock.restart());
         else
             m_clock.restart();
 
+        // Load some of the glyphs that were requested with Font::preloadIncrementally
+        if (Font::isPreloadingIncrementally())
+            Font::continueIncrementalPreload(sf::milliseconds(2));
+
+        drawWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawWidgets()
+    {
+        // Make sure the right opengl context is set when clipping
+        if (dynamic_cast<sf::RenderWindow*>(m_window))
+            dynamic_cast<sf::RenderWindow*>(m_window)->setActive(true);
+        else if (dynamic_cast<sf::RenderTexture*>(m_window))
+            dynamic_cast<sf::RenderTexture*>(m_window)->setActive(true);
+
         // Check if clipping is enabled
         GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
         GLint scissor[4];
@@ -393,10 +426,36 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setEventRecorder(const EventRecorder::Ptr& recorder)
+    {
+        m_eventRecorder = recorder;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setParallelUpdate(bool enabled, unsigned int threadCount)
+    {
+        if (enabled)
+            m_updatePool = std::unique_ptr<priv::UpdatePool>(new priv::UpdatePool{threadCount});
+        else
+            m_updatePool = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        if (m_eventRecorder)
+            m_eventRecorder->recordTime(elapsedTime);
+
         m_container->m_animationTimeElapsed = elapsedTime;
-        m_container->update(elapsedTime);
+        if (m_updatePool)
+            m_container->updateParallel(elapsedTime, *m_updatePool);
+        else
+            m_container->update(elapsedTime);
+
+        // Call the signal handlers of the widgets in this gui that didn't want to be called immediately
+        m_container->m_delayedSignalQueue->deliver(elapsedTime);
 
         if (m_tooltipPossible)
         {
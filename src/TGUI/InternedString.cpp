@@ -0,0 +1,192 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/InternedString.hpp>
+#include <TGUI/Context.hpp>
+
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        std::string toUtf8(const sf::String& string)
+        {
+            const auto utf8 = string.toUtf8();
+            return std::string(utf8.begin(), utf8.end());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString::InternedString(const std::string& string)
+    {
+        if (string.empty())
+            return;
+
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_internedStringMutex};
+
+        auto it = context.m_internedStrings.find(string);
+        if (it == context.m_internedStrings.end())
+            it = context.m_internedStrings.emplace(string, 0).first;
+
+        m_entry = &*it;
+        ++m_entry->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString::InternedString(const char* string) :
+        InternedString{std::string{string}}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString::InternedString(const sf::String& string) :
+        InternedString{toUtf8(string)}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString::InternedString(const InternedString& other) :
+        m_entry{other.m_entry}
+    {
+        // The other string keeps the entry alive, so the count can't reach zero while it is being increased
+        if (m_entry)
+            m_entry->second.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString::InternedString(InternedString&& other) noexcept :
+        m_entry{other.m_entry}
+    {
+        other.m_entry = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString::~InternedString()
+    {
+        if (!m_entry)
+            return;
+
+        // As long as other copies exist, the count can be decreased without locking
+        std::size_t count = m_entry->second.load(std::memory_order_relaxed);
+        while (count > 1)
+        {
+            if (m_entry->second.compare_exchange_weak(count, count - 1, std::memory_order_release, std::memory_order_relaxed))
+                return;
+        }
+
+        // The last copy is released while locked, because another thread may be interning the same string at this moment
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_internedStringMutex};
+        if (m_entry->second.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            context.m_internedStrings.erase(context.m_internedStrings.find(m_entry->first));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString& InternedString::operator=(const InternedString& other)
+    {
+        if (this != &other)
+        {
+            InternedString temp(other);
+            std::swap(m_entry, temp.m_entry);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString& InternedString::operator=(InternedString&& other) noexcept
+    {
+        std::swap(m_entry, other.m_entry);
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString InternedString::find(const std::string& string)
+    {
+        InternedString result;
+        if (string.empty())
+            return result;
+
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_internedStringMutex};
+
+        auto it = context.m_internedStrings.find(string);
+        if (it != context.m_internedStrings.end())
+        {
+            result.m_entry = &*it;
+            ++result.m_entry->second;
+        }
+
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString InternedString::find(const char* string)
+    {
+        return find(std::string{string});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InternedString InternedString::find(const sf::String& string)
+    {
+        return find(toUtf8(string));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& InternedString::getString() const
+    {
+        static const std::string emptyString;
+        return m_entry ? m_entry->first : emptyString;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String InternedString::toSfString() const
+    {
+        const std::string& string = getString();
+        return sf::String::fromUtf8(string.begin(), string.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Gui.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <cmath>
@@ -105,15 +106,70 @@ namespace
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float calculateOperation(tgui::LayoutImpl::Operation operation, float left, float right)
+    {
+        switch (operation)
+        {
+        case tgui::LayoutImpl::Operation::Plus:
+            return left + right;
+        case tgui::LayoutImpl::Operation::Minus:
+            return left - right;
+        case tgui::LayoutImpl::Operation::Multiplies:
+            return left * right;
+        case tgui::LayoutImpl::Operation::Divides:
+            return left / right;
+        case tgui::LayoutImpl::Operation::Modulus:
+            return std::fmod(left, right);
+        case tgui::LayoutImpl::Operation::And:
+            return left && right;
+        case tgui::LayoutImpl::Operation::Or:
+            return left || right;
+        case tgui::LayoutImpl::Operation::LessThan:
+            return left < right;
+        case tgui::LayoutImpl::Operation::LessOrEqual:
+            return left <= right;
+        case tgui::LayoutImpl::Operation::GreaterThan:
+            return left > right;
+        case tgui::LayoutImpl::Operation::GreaterOrEqual:
+            return left >= right;
+        case tgui::LayoutImpl::Operation::Equal:
+            return left == right;
+        case tgui::LayoutImpl::Operation::NotEqual:
+            return left != right;
+        case tgui::LayoutImpl::Operation::Minimum:
+            return std::min(left, right);
+        case tgui::LayoutImpl::Operation::Maximum:
+            return std::max(left, right);
+        default:
+            assert(false);
+            return 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void addParent(tgui::LayoutImpl& layout, tgui::LayoutImpl* parent)
+    {
+        if (std::find(layout.parents.begin(), layout.parents.end(), parent) == layout.parents.end())
+            layout.parents.push_back(parent);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     tgui::Layout layoutOperator(tgui::Layout&& left, tgui::Layout&& right, tgui::LayoutImpl::Operation operation)
     {
+        // The result of an operation between constants is a constant as well
+        if (left.isConstant() && right.isConstant())
+            return {calculateOperation(operation, left.getValue(), right.getValue())};
+
         tgui::Layout result;
-        result.getImpl()->operation = operation;
-        result.getImpl()->operands.push_back(left.getImpl());
-        result.getImpl()->operands.push_back(right.getImpl());
-        left.getImpl()->parents.insert(result.getImpl().get());
-        right.getImpl()->parents.insert(result.getImpl().get());
-        result.getImpl()->recalculate();
+        auto resultImpl = result.getImpl();
+        resultImpl->operation = operation;
+        resultImpl->operands.push_back(left.getImpl());
+        resultImpl->operands.push_back(right.getImpl());
+        addParent(*resultImpl->operands[0], resultImpl.get());
+        addParent(*resultImpl->operands[1], resultImpl.get());
+        resultImpl->recalculate();
         return result;
     }
 
@@ -129,7 +185,29 @@ namespace tgui
     LayoutImpl::~LayoutImpl()
     {
         for (auto& operand : operands)
-            operand->parents.erase(this);
+            operand->parents.erase(std::remove(operand->parents.begin(), operand->parents.end(), this), operand->parents.end());
+
+        // The signal no longer exists when the widget was destroyed
+        for (auto& dependency : dependencies)
+        {
+            auto signal = dependency.signal.lock();
+            if (signal)
+                signal->disconnect(dependency.id);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutImpl::addWidgetDependency(Widget* widget, const std::string& signalName, float (*getValue)(Widget*))
+    {
+        std::weak_ptr<LayoutImpl> weakLayout = shared_from_this();
+        const unsigned int id = widget->connect(signalName, [weakLayout, widget, getValue]() {
+            auto layout = weakLayout.lock();
+            if (layout)
+                resetLayout(layout, getValue(widget));
+        });
+
+        dependencies.push_back({widget->m_signals[toLower(signalName)], id});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,54 +224,12 @@ namespace tgui
         case Operation::String:
             value = parseLayoutString(stringExpression);
             break;
-        case Operation::Plus:
-            value = operands[0]->value + operands[1]->value;
-            break;
-        case Operation::Minus:
-            value = operands[0]->value - operands[1]->value;
-            break;
-        case Operation::Multiplies:
-            value = operands[0]->value * operands[1]->value;
-            break;
-        case Operation::Divides:
-            value = operands[0]->value / operands[1]->value;
-            break;
-        case Operation::Modulus:
-            value = std::fmod(operands[0]->value, operands[1]->value);
-            break;
-        case Operation::And:
-            value = operands[0]->value && operands[1]->value;
-            break;
-        case Operation::Or:
-            value = operands[0]->value || operands[1]->value;
-            break;
-        case Operation::LessThan:
-            value = operands[0]->value < operands[1]->value;
-            break;
-        case Operation::LessOrEqual:
-            value = operands[0]->value <= operands[1]->value;
-            break;
-        case Operation::GreaterThan:
-            value = operands[0]->value > operands[1]->value;
-            break;
-        case Operation::GreaterOrEqual:
-            value = operands[0]->value >= operands[1]->value;
-            break;
-        case Operation::Equal:
-            value = operands[0]->value == operands[1]->value;
-            break;
-        case Operation::NotEqual:
-            value = operands[0]->value != operands[1]->value;
-            break;
-        case Operation::Minimum:
-            value = std::min(operands[0]->value, operands[1]->value);
-            break;
-        case Operation::Maximum:
-            value = std::max(operands[0]->value, operands[1]->value);
-            break;
         case Operation::Conditional:
             value = operands[0]->value ? operands[1]->value : operands[2]->value;
             break;
+        default:
+            value = calculateOperation(operation, operands[0]->value, operands[1]->value);
+            break;
         }
 
         // Alert the widgets that are using this layout
@@ -546,7 +582,7 @@ namespace tgui
             if (boundCallbacks.find(alreadyParsedPart + "position") == boundCallbacks.end())
             {
                 boundCallbacks.insert(alreadyParsedPart + "position");
-                widget->connect("PositionChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetLeft, widget)));
+                addWidgetDependency(widget, "PositionChanged", getWidgetLeft);
             }
 
             return widget->getPosition().x;
@@ -556,7 +592,7 @@ namespace tgui
             if (boundCallbacks.find(alreadyParsedPart + "position") == boundCallbacks.end())
             {
                 boundCallbacks.insert(alreadyParsedPart + "position");
-                widget->connect("PositionChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetTop, widget)));
+                addWidgetDependency(widget, "PositionChanged", getWidgetTop);
             }
 
             return widget->getPosition().y;
@@ -566,7 +602,7 @@ namespace tgui
             if (boundCallbacks.find(alreadyParsedPart + "size") == boundCallbacks.end())
             {
                 boundCallbacks.insert(alreadyParsedPart + "size");
-                widget->connect("SizeChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetWidth, widget)));
+                addWidgetDependency(widget, "SizeChanged", getWidgetWidth);
             }
 
             return widget->getSize().x;
@@ -576,7 +612,7 @@ namespace tgui
             if (boundCallbacks.find(alreadyParsedPart + "size") == boundCallbacks.end())
             {
                 boundCallbacks.insert(alreadyParsedPart + "size");
-                widget->connect("SizeChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetHeight, widget)));
+                addWidgetDependency(widget, "SizeChanged", getWidgetHeight);
             }
 
             return widget->getSize().y;
@@ -586,12 +622,12 @@ namespace tgui
             if (boundCallbacks.find(alreadyParsedPart + "position") == boundCallbacks.end())
             {
                 boundCallbacks.insert(alreadyParsedPart + "position");
-                widget->connect("PositionChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetLeft, widget)));
+                addWidgetDependency(widget, "PositionChanged", getWidgetLeft);
             }
             if (boundCallbacks.find(alreadyParsedPart + "size") == boundCallbacks.end())
             {
                 boundCallbacks.insert(alreadyParsedPart + "size");
-                widget->connect("SizeChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetWidth, widget)));
+                addWidgetDependency(widget, "SizeChanged", getWidgetWidth);
             }
 
             return widget->getPosition().x + widget->getSize().x;
@@ -601,12 +637,12 @@ namespace tgui
             if (boundCallbacks.find(alreadyParsedPart + "position") == boundCallbacks.end())
             {
                 boundCallbacks.insert(alreadyParsedPart + "position");
-                widget->connect("PositionChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetTop, widget)));
+                addWidgetDependency(widget, "PositionChanged", getWidgetTop);
             }
             if (boundCallbacks.find(alreadyParsedPart + "size") == boundCallbacks.end())
             {
                 boundCallbacks.insert(alreadyParsedPart + "size");
-                widget->connect("SizeChanged", std::bind(resetLayout, shared_from_this(), std::bind(getWidgetHeight, widget)));
+                addWidgetDependency(widget, "SizeChanged", getWidgetHeight);
             }
 
             return widget->getPosition().y + widget->getSize().y;
@@ -653,8 +689,6 @@ namespace tgui
 
     Layout::Layout()
     {
-        m_impl->value = 0;
-        m_impl->attachedLayouts.insert(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -666,27 +700,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(const std::string& expression)
+    Layout::Layout(const std::string& expression) :
+        m_impl{std::make_shared<LayoutImpl>()}
     {
         m_impl->stringExpression = expression;
         m_impl->operation = LayoutImpl::Operation::String;
-        m_impl->attachedLayouts.insert(this);
+        m_impl->attachedLayouts.push_back(this);
         m_impl->recalculate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(const Layout& copy)
+    Layout::Layout(const Layout& copy) :
+        m_impl    {copy.m_impl},
+        m_constant{copy.m_constant}
     {
-        m_impl = copy.m_impl;
-        m_impl->attachedLayouts.insert(this);
+        if (m_impl)
+            m_impl->attachedLayouts.push_back(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::~Layout()
     {
-        m_impl->attachedLayouts.erase(this);
+        if (m_impl)
+            m_impl->attachedLayouts.erase(std::find(m_impl->attachedLayouts.begin(), m_impl->attachedLayouts.end(), this));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -695,9 +733,14 @@ namespace tgui
     {
         if (&right != this)
         {
-            m_impl->attachedLayouts.erase(this);
-            right.m_impl->attachedLayouts.insert(this);
+            if (m_impl)
+                m_impl->attachedLayouts.erase(std::find(m_impl->attachedLayouts.begin(), m_impl->attachedLayouts.end(), this));
+
             m_impl = right.m_impl;
+            m_constant = right.m_constant;
+
+            if (m_impl)
+                m_impl->attachedLayouts.push_back(this);
         }
 
         return *this;
@@ -707,7 +750,7 @@ namespace tgui
 
     float Layout::getValue() const
     {
-        return m_impl->value;
+        return m_impl ? m_impl->value : m_constant;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -729,11 +772,59 @@ namespace tgui
 
     std::shared_ptr<LayoutImpl> Layout::getImpl() const
     {
+        if (!m_impl)
+        {
+            m_impl = std::make_shared<LayoutImpl>();
+            m_impl->value = m_constant;
+            m_impl->attachedLayouts.push_back(const_cast<Layout*>(this));
+        }
+
         return m_impl;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Layout::isConstant() const
+    {
+        return !m_impl;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::isStringExpression() const
+    {
+        return m_impl && (m_impl->operation == LayoutImpl::Operation::String);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::attachToWidget(Widget* widget) const
+    {
+        if (m_impl && (m_impl->parentWidget != widget))
+        {
+            m_impl->parentWidget = widget;
+            m_impl->recalculate();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::detachFromWidget(const Widget* widget) const
+    {
+        if (m_impl && (m_impl->parentWidget == widget))
+            m_impl->parentWidget = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::recalculate() const
+    {
+        if (m_impl)
+            m_impl->recalculate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Layout Layout::operator+()
     {
         return *this;
@@ -1079,7 +1170,7 @@ namespace tgui
     {
         Layout result;
         result.getImpl()->value = widget->getPosition().x;
-        widget->connect("PositionChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetLeft, widget.get())));
+        result.getImpl()->addWidgetDependency(widget.get(), "PositionChanged", getWidgetLeft);
         return result;
     }
 
@@ -1089,7 +1180,7 @@ namespace tgui
     {
         Layout result;
         result.getImpl()->value = widget->getPosition().y;
-        widget->connect("PositionChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetTop, widget.get())));
+        result.getImpl()->addWidgetDependency(widget.get(), "PositionChanged", getWidgetTop);
         return result;
     }
 
@@ -1099,7 +1190,7 @@ namespace tgui
     {
         Layout result;
         result.getImpl()->value = widget->getSize().x;
-        widget->connect("SizeChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetWidth, widget.get())));
+        result.getImpl()->addWidgetDependency(widget.get(), "SizeChanged", getWidgetWidth);
         return result;
     }
 
@@ -1109,7 +1200,7 @@ namespace tgui
     {
         Layout result;
         result.getImpl()->value = widget->getSize().y;
-        widget->connect("SizeChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetHeight, widget.get())));
+        result.getImpl()->addWidgetDependency(widget.get(), "SizeChanged", getWidgetHeight);
         return result;
     }
 
@@ -1119,8 +1210,8 @@ namespace tgui
     {
         Layout result;
         result.getImpl()->value = widget->getPosition().x + widget->getSize().x;
-        widget->connect("PositionChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetRight, widget.get())));
-        widget->connect("SizeChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetRight, widget.get())));
+        result.getImpl()->addWidgetDependency(widget.get(), "PositionChanged", getWidgetRight);
+        result.getImpl()->addWidgetDependency(widget.get(), "SizeChanged", getWidgetRight);
         return result;
     }
 
@@ -1130,8 +1221,8 @@ namespace tgui
     {
         Layout result;
         result.getImpl()->value = widget->getPosition().y + widget->getSize().y;
-        widget->connect("PositionChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetBottom, widget.get())));
-        widget->connect("SizeChanged", std::bind(resetLayout, result.getImpl(), std::bind(getWidgetBottom, widget.get())));
+        result.getImpl()->addWidgetDependency(widget.get(), "PositionChanged", getWidgetBottom);
+        result.getImpl()->addWidgetDependency(widget.get(), "SizeChanged", getWidgetBottom);
         return result;
     }
 
@@ -1230,15 +1321,19 @@ namespace tgui
 
     Layout bindIf(Layout condition, Layout trueExpr, Layout falseExpr)
     {
+        // When the condition can't change, the result is simply one of the two layouts
+        if (condition.isConstant())
+            return condition.getValue() ? trueExpr : falseExpr;
+
         tgui::Layout result;
-        result.getImpl()->operation = LayoutImpl::Operation::Conditional;
-        result.getImpl()->operands.push_back(condition.getImpl());
-        result.getImpl()->operands.push_back(trueExpr.getImpl());
-        result.getImpl()->operands.push_back(falseExpr.getImpl());
-        condition.getImpl()->parents.insert(result.getImpl().get());
-        trueExpr.getImpl()->parents.insert(result.getImpl().get());
-        falseExpr.getImpl()->parents.insert(result.getImpl().get());
-        result.getImpl()->recalculate();
+        auto resultImpl = result.getImpl();
+        resultImpl->operation = LayoutImpl::Operation::Conditional;
+        resultImpl->operands.push_back(condition.getImpl());
+        resultImpl->operands.push_back(trueExpr.getImpl());
+        resultImpl->operands.push_back(falseExpr.getImpl());
+        for (auto& operand : resultImpl->operands)
+            addParent(*operand, resultImpl.get());
+        resultImpl->recalculate();
         return result;
     }
 
@@ -26,6 +26,7 @@
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Global.hpp>
 
+#include <cassert>
 #include <cctype>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,61 +119,115 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void DataIO::emit(std::shared_ptr<Node> rootNode, std::stringstream& stream)
+    DataIO::Emitter::Emitter(std::ostream& stream) :
+        m_stream(stream)
     {
-        for (auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << ": " << pair.second->value << ";" << std::endl;
+    }
 
-        if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
-            stream << std::endl;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::vector<std::string> output;
-        for (std::size_t i = 0; i < rootNode->children.size(); ++i)
+    void DataIO::Emitter::beginSection(const std::string& name)
+    {
+        // Sections are separated by an empty line from whatever came before them in the parent section
+        const std::size_t depth = m_sectionHasContents.size() - 1;
+        if (m_sectionHasContents.back())
         {
-            for (auto& line : convertNodesToLines(rootNode->children[i]))
-                output.emplace_back(std::move(line));
-
-            if (i < rootNode->children.size()-1)
-                output.emplace_back("");
+            writeIndentation(depth > 0 ? depth - 1 : 0);
+            m_stream << '\n';
         }
 
-        for (auto& line : output)
-            stream << line << std::endl;
+        m_sectionHasContents.back() = true;
+        m_sectionHasContents.push_back(false);
+
+        writeIndentation(depth);
+        if (name.empty())
+            m_stream << "{\n";
+        else
+            m_stream << name << " {\n";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<std::string> DataIO::convertNodesToLines(std::shared_ptr<Node> node)
+    void DataIO::Emitter::endSection()
     {
-        std::vector<std::string> output;
-        if (node->name.empty())
-            output.emplace_back("{");
-        else
-            output.emplace_back(node->name + " {");
+        assert(m_sectionHasContents.size() > 1);
+        m_sectionHasContents.pop_back();
+
+        writeIndentation(m_sectionHasContents.size() - 1);
+        m_stream << "}\n";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Emitter::writeProperty(const std::string& property, const std::string& value)
+    {
+        m_sectionHasContents.back() = true;
 
-        if (node->propertyValuePairs.size())
+        writeIndentation(m_sectionHasContents.size() - 1);
+        m_stream << property << ": " << value << ";\n";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Emitter::writeNode(const Node& node)
+    {
+        // A deferred node only lives for as long as it takes to write it
+        if (node.deferred)
         {
-            for (auto& pair : node->propertyValuePairs)
-                output.emplace_back("    " + pair.first + ": " + pair.second->value + ";");
+            writeNode(*node.deferred());
+            return;
         }
 
-        if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
-            output.emplace_back("");
+        beginSection(node.name);
+
+        for (auto& pair : node.propertyValuePairs)
+            writeProperty(pair.first, pair.second->value);
 
-        if (node->children.size())
+        for (auto& child : node.children)
+            writeNode(*child);
+
+        endSection();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Emitter::writeIndentation(std::size_t depth)
+    {
+        for (std::size_t i = 0; i < depth; ++i)
+            m_stream << "    ";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emit(std::shared_ptr<Node> rootNode, std::ostream& stream)
+    {
+        Emitter emitter{stream};
+
+        for (auto& pair : rootNode->propertyValuePairs)
+            emitter.writeProperty(pair.first, pair.second->value);
+
+        for (auto& child : rootNode->children)
+            emitter.writeNode(*child);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<DataIO::Node> DataIO::resolveDeferredNodes(std::shared_ptr<Node> node)
+    {
+        if (node->deferred)
         {
-            for (std::size_t i = 0; i < node->children.size(); ++i)
-            {
-                for (auto& line : convertNodesToLines(node->children[i]))
-                    output.emplace_back("    " + line);
+            auto realNode = node->deferred();
+            realNode->parent = node->parent;
+            node = realNode;
+        }
 
-                if (i < node->children.size() - 1)
-                    output.emplace_back("");
-            }
+        for (auto& child : node->children)
+        {
+            child = resolveDeferredNodes(child);
+            child->parent = node.get();
         }
 
-        output.emplace_back("}");
-        return output;
+        return node;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
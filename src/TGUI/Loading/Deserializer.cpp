@@ -24,6 +24,8 @@
 
 
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Context.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
 #include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,8 +84,12 @@ namespace tgui
         if (value == "null" || value == "nullptr")
             return std::shared_ptr<sf::Font>();
 
+        const std::string filename = Deserializer::deserialize(ObjectConverter::Type::String, value).getString();
         auto font = std::make_shared<sf::Font>();
-        font->loadFromFile(Deserializer::deserialize(ObjectConverter::Type::String, value).getString());
+        font->loadFromFile(filename);
+
+        // Let distance field text rasterize its glyphs without needing the texture of the font
+        priv::DistanceFieldFont::setFontFile(font, filename);
         return font;
     }
 
@@ -350,22 +356,145 @@ namespace tgui
 
     ObjectConverter Deserializer::deserialize(ObjectConverter::Type type, const std::string& serializedString)
     {
-        assert(m_deserializers.find(type) != m_deserializers.end());
-        return m_deserializers[type](serializedString);
+        Context& context = Context::getGlobal();
+
+        // The lock is not kept while deserializing, as deserialize functions may call this function again
+        DeserializeFunc deserializer;
+        bool cacheEnabled;
+        std::size_t cacheGeneration;
+        {
+            std::lock_guard<std::mutex> lock{context.m_deserializerMutex};
+            assert(m_deserializers.find(type) != m_deserializers.end());
+            deserializer = m_deserializers[type];
+
+            // Fonts are never cached, as an sf::Font may not be shared between guis that run on different threads
+            cacheEnabled = context.m_deserializeCacheEnabled && (type != ObjectConverter::Type::Font);
+            if (cacheEnabled)
+            {
+                // Textures are loaded relative to the resource path, so they can't be reused when it changed
+                const std::string resourcePath = getResourcePath();
+                if (context.m_deserializeCacheResourcePath != resourcePath)
+                {
+                    context.m_deserializeCache[ObjectConverter::Type::Texture].clear();
+                    context.m_deserializeCacheResourcePath = resourcePath;
+                    context.m_deserializeCacheGeneration++;
+                }
+
+                auto& cache = context.m_deserializeCache[type];
+                auto it = cache.find(serializedString);
+                if (it != cache.end())
+                {
+                    context.m_deserializeCacheHits++;
+                    return it->second;
+                }
+
+                context.m_deserializeCacheMisses++;
+            }
+
+            cacheGeneration = context.m_deserializeCacheGeneration;
+        }
+
+        if (!cacheEnabled)
+            return deserializer(serializedString);
+
+        // Values that failed to deserialize are not stored, the exception is just passed on
+        ObjectConverter value = deserializer(serializedString);
+
+        // The value isn't stored when the cache was cleared or the function was replaced while deserializing it
+        std::lock_guard<std::mutex> lock{context.m_deserializerMutex};
+        if (context.m_deserializeCacheEnabled && (context.m_deserializeCacheGeneration == cacheGeneration))
+            context.m_deserializeCache[type].emplace(serializedString, value);
+
+        return value;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Deserializer::setFunction(ObjectConverter::Type type, const DeserializeFunc& deserializer)
     {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_deserializerMutex};
         m_deserializers[type] = deserializer;
+        context.m_deserializeCache.erase(type);
+        context.m_deserializeCacheGeneration++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Deserializer::DeserializeFunc Deserializer::getFunction(ObjectConverter::Type type)
+    {
+        std::lock_guard<std::mutex> lock{Context::getGlobal().m_deserializerMutex};
+
+        auto it = m_deserializers.find(type);
+        if (it != m_deserializers.end())
+            return it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Deserializer::enableCache()
+    {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_deserializerMutex};
+        context.m_deserializeCacheEnabled = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Deserializer::disableCache()
+    {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_deserializerMutex};
+        context.m_deserializeCacheEnabled = false;
+        context.m_deserializeCache.clear();
+        context.m_deserializeCacheGeneration++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Deserializer::isCacheEnabled()
+    {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_deserializerMutex};
+        return context.m_deserializeCacheEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Deserializer::clearCache()
+    {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_deserializerMutex};
+        context.m_deserializeCache.clear();
+        context.m_deserializeCacheGeneration++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Deserializer::CacheStatistics Deserializer::getCacheStatistics()
+    {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_deserializerMutex};
+
+        CacheStatistics statistics;
+        statistics.hits = context.m_deserializeCacheHits;
+        statistics.misses = context.m_deserializeCacheMisses;
+        for (auto& typeCache : context.m_deserializeCache)
+            statistics.entries += typeCache.second.size();
+
+        return statistics;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const Deserializer::DeserializeFunc& Deserializer::getFunction(ObjectConverter::Type type)
+    void Deserializer::resetCacheStatistics()
     {
-        return m_deserializers[type];
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_deserializerMutex};
+        context.m_deserializeCacheHits = 0;
+        context.m_deserializeCacheMisses = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/ObjectConverter.hpp>
 #include <cassert>
+#include <new>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -87,6 +88,55 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ObjectConverter::ObjectConverter(const ObjectConverter& other) :
+        m_type(Type::None)
+    {
+        copyFrom(other);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter::ObjectConverter(ObjectConverter&& other) :
+        m_type(Type::None)
+    {
+        moveFrom(std::move(other));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter::~ObjectConverter()
+    {
+        reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& ObjectConverter::operator=(const ObjectConverter& right)
+    {
+        if (this != &right)
+        {
+            reset();
+            copyFrom(right);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& ObjectConverter::operator=(ObjectConverter&& right)
+    {
+        if (this != &right)
+        {
+            reset();
+            moveFrom(std::move(right));
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     const std::shared_ptr<sf::Font>& ObjectConverter::getFont() const
     {
         assert(m_type == Type::Font);
@@ -141,6 +191,99 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::copyFrom(const ObjectConverter& other)
+    {
+        assert(m_type == Type::None);
+
+        switch (other.m_type)
+        {
+            case Type::None:
+                break;
+            case Type::Font:
+                new (&m_font) std::shared_ptr<sf::Font>(other.m_font);
+                break;
+            case Type::Color:
+                new (&m_color) sf::Color(other.m_color);
+                break;
+            case Type::String:
+                new (&m_string) sf::String(other.m_string);
+                break;
+            case Type::Number:
+                m_number = other.m_number;
+                break;
+            case Type::Borders:
+                new (&m_borders) Borders(other.m_borders);
+                break;
+            case Type::Texture:
+                new (&m_texture) Texture(other.m_texture);
+                break;
+        }
+
+        m_type = other.m_type;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::moveFrom(ObjectConverter&& other)
+    {
+        assert(m_type == Type::None);
+
+        switch (other.m_type)
+        {
+            case Type::None:
+                break;
+            case Type::Font:
+                new (&m_font) std::shared_ptr<sf::Font>(std::move(other.m_font));
+                break;
+            case Type::Color:
+                new (&m_color) sf::Color(other.m_color);
+                break;
+            case Type::String:
+                new (&m_string) sf::String(std::move(other.m_string));
+                break;
+            case Type::Number:
+                m_number = other.m_number;
+                break;
+            case Type::Borders:
+                new (&m_borders) Borders(other.m_borders);
+                break;
+            case Type::Texture:
+                new (&m_texture) Texture(std::move(other.m_texture));
+                break;
+        }
+
+        m_type = other.m_type;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::reset()
+    {
+        switch (m_type)
+        {
+            case Type::Font:
+                m_font.~shared_ptr<sf::Font>();
+                break;
+            case Type::String:
+                m_string.~String();
+                break;
+            case Type::Borders:
+                m_borders.~Borders();
+                break;
+            case Type::Texture:
+                m_texture.~Texture();
+                break;
+            case Type::None:
+            case Type::Color:
+            case Type::Number:
+                break;
+        }
+
+        m_type = Type::None;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,8 @@
 
 
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Context.hpp>
+
 #include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -166,7 +168,7 @@ namespace tgui
             result += " Part(" + tgui::to_string(texture.getData()->rect.left) + ", " + tgui::to_string(texture.getData()->rect.top)
                         + ", " + tgui::to_string(texture.getData()->rect.width) + ", " + tgui::to_string(texture.getData()->rect.height) + ")";
         }
-        if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getData()->texture.getSize().x), static_cast<int>(texture.getData()->texture.getSize().y)})
+        if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getData()->size.x), static_cast<int>(texture.getData()->size.y)})
         {
             result += " Middle(" + tgui::to_string(texture.getMiddleRect().left) + ", " + tgui::to_string(texture.getMiddleRect().top)
                           + ", " + tgui::to_string(texture.getMiddleRect().width) + ", " + tgui::to_string(texture.getMiddleRect().height) + ")";
@@ -197,21 +199,30 @@ namespace tgui
 
     std::string Serializer::serialize(ObjectConverter&& object)
     {
-        return m_serializers[object.getType()](std::move(object));
+        // The lock is not kept while serializing, the function may call this function again
+        SerializeFunc serializer = getFunction(object.getType());
+        return serializer(std::move(object));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Serializer::setFunction(ObjectConverter::Type type, const SerializeFunc& serializer)
     {
+        std::lock_guard<std::mutex> lock{Context::getGlobal().m_serializerMutex};
         m_serializers[type] = serializer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const Serializer::SerializeFunc& Serializer::getFunction(ObjectConverter::Type type)
+    Serializer::SerializeFunc Serializer::getFunction(ObjectConverter::Type type)
     {
-        return m_serializers[type];
+        std::lock_guard<std::mutex> lock{Context::getGlobal().m_serializerMutex};
+
+        auto it = m_serializers.find(type);
+        if (it != m_serializers.end())
+            return it->second;
+        else
+            return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
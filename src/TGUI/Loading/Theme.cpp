@@ -25,25 +25,7 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
-#include <TGUI/Widgets/Button.hpp>
-#include <TGUI/Widgets/ChatBox.hpp>
-#include <TGUI/Widgets/CheckBox.hpp>
-#include <TGUI/Widgets/ChildWindow.hpp>
-#include <TGUI/Widgets/ComboBox.hpp>
-#include <TGUI/Widgets/Knob.hpp>
-#include <TGUI/Widgets/Label.hpp>
-#include <TGUI/Widgets/ListBox.hpp>
-#include <TGUI/Widgets/MenuBar.hpp>
-#include <TGUI/Widgets/MessageBox.hpp>
-#include <TGUI/Widgets/Panel.hpp>
-#include <TGUI/Widgets/ProgressBar.hpp>
-#include <TGUI/Widgets/EditBox.hpp>
-#include <TGUI/Widgets/RadioButton.hpp>
-#include <TGUI/Widgets/Scrollbar.hpp>
-#include <TGUI/Widgets/Slider.hpp>
-#include <TGUI/Widgets/SpinButton.hpp>
-#include <TGUI/Widgets/Tab.hpp>
-#include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/Context.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,33 +33,6 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::map<std::string, std::function<Widget::Ptr()>> BaseTheme::m_constructors =
-        {
-            {"button", std::make_shared<Button>},
-            {"chatbox", std::make_shared<ChatBox>},
-            {"checkbox", std::make_shared<CheckBox>},
-            {"childwindow", std::make_shared<ChildWindow>},
-            {"combobox", std::make_shared<ComboBox>},
-            {"editbox", std::make_shared<EditBox>},
-            {"knob", std::make_shared<Knob>},
-            {"label", std::make_shared<Label>},
-            {"listbox", std::make_shared<ListBox>},
-            {"menubar", std::make_shared<MenuBar>},
-            {"messagebox", std::make_shared<MessageBox>},
-            {"panel", std::make_shared<Panel>},
-            {"progressbar", std::make_shared<ProgressBar>},
-            {"radiobutton", std::make_shared<RadioButton>},
-            {"scrollbar", std::make_shared<Scrollbar>},
-            {"slider", std::make_shared<Slider>},
-            {"spinbutton", std::make_shared<SpinButton>},
-            {"tab", std::make_shared<Tab>},
-            {"textbox", std::make_shared<TextBox>}
-        };
-
-    std::shared_ptr<BaseThemeLoader> BaseTheme::m_themeLoader = std::make_shared<DefaultThemeLoader>();
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     void BaseTheme::widgetAttached(Widget* widget)
     {
         widget->attachTheme(shared_from_this());
@@ -93,14 +48,41 @@ namespace tgui
 
     void BaseTheme::setConstructFunction(const std::string& type, const std::function<Widget::Ptr()>& constructor)
     {
-        m_constructors[toLower(type)] = constructor;
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_themeMutex};
+        context.m_widgetConstructors[toLower(type)] = constructor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BaseTheme::setThemeLoader(const std::shared_ptr<BaseThemeLoader>& themeLoader)
     {
-        m_themeLoader = themeLoader;
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_themeMutex};
+        context.m_themeLoader = themeLoader;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::function<Widget::Ptr()> BaseTheme::getConstructFunction(const std::string& type)
+    {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_themeMutex};
+
+        auto it = context.m_widgetConstructors.find(toLower(type));
+        if (it != context.m_widgetConstructors.end())
+            return it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BaseThemeLoader> BaseTheme::getThemeLoader()
+    {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_themeMutex};
+        return context.m_themeLoader;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -110,6 +92,14 @@ namespace tgui
         widget->reload(primary, secondary, force);
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BaseTheme::widgetSetLoadingParameters(Widget* widget, const std::string& primary, const std::string& secondary)
+    {
+        widget->m_primaryLoadingParameter = primary;
+        widget->m_secondaryLoadingParameter = secondary;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -134,20 +124,35 @@ namespace tgui
     {
         className = toLower(className);
 
+        // When a widget of this class was already loaded then its renderer properties don't have to be parsed again
+        auto prototypeIt = m_prototypes.find(className);
+        if ((prototypeIt != m_prototypes.end()) && prototypeIt->second)
+        {
+            Widget::Ptr widget = prototypeIt->second->clone();
+            m_widgets[widget.get()] = className;
+
+            widgetAttached(widget.get());
+            widgetSetLoadingParameters(widget.get(), m_filename, className);
+
+            return WidgetConverter{widget};
+        }
+
+        const std::size_t loadCount = ++m_loadCount;
+
         std::string widgetType;
         if (m_filename != "")
         {
             if (m_widgetTypes.find(className) != m_widgetTypes.end())
                 widgetType = m_widgetTypes[className];
             else
-                widgetType = toLower(m_themeLoader->load(m_filename, className, m_widgetProperties[className]));
+                widgetType = toLower(getThemeLoader()->load(m_filename, className, m_widgetProperties[className]));
         }
         else // Load the white theme
         {
             widgetType = className;
         }
 
-        auto constructor = m_constructors[widgetType];
+        auto constructor = getConstructFunction(widgetType);
         if (constructor)
         {
             Widget::Ptr widget = constructor();
@@ -157,6 +162,16 @@ namespace tgui
             widgetAttached(widget.get());
             widgetReload(widget.get(), m_filename, className, true);
 
+            // The copy of the widget is not connected to the theme. When other widgets were loaded while reloading this one
+            // (e.g. a scrollbar) then no copy is kept, because the parts inside a cloned widget wouldn't be connected either.
+            if (m_prototypes.find(className) == m_prototypes.end())
+            {
+                if (m_loadCount == loadCount)
+                    m_prototypes[className] = widget->clone();
+                else
+                    m_prototypes[className] = nullptr;
+            }
+
             return WidgetConverter{widget};
         }
         else
@@ -176,6 +191,7 @@ namespace tgui
 
         m_widgetTypes.clear();
         m_widgetProperties.clear();
+        m_prototypes.clear();
 
         for (auto& widget : m_widgets)
         {
@@ -187,7 +203,7 @@ namespace tgui
                 else
                 {
                     m_widgetProperties[widget.second].clear();
-                    widgetType = toLower(m_themeLoader->load(m_filename, widget.second, m_widgetProperties[widget.second]));
+                    widgetType = toLower(getThemeLoader()->load(m_filename, widget.second, m_widgetProperties[widget.second]));
                 }
             }
             else
@@ -204,6 +220,7 @@ namespace tgui
     {
         oldClassName = toLower(oldClassName);
         newClassName = toLower(newClassName);
+        m_prototypes.erase(newClassName);
 
         // If we don't have the new class name in the cache then check if the theme loader has it
         if (m_filename != "")
@@ -211,7 +228,7 @@ namespace tgui
             if (m_widgetTypes.find(newClassName) == m_widgetTypes.end())
             {
                 m_widgetProperties[newClassName].clear();
-                m_themeLoader->load(m_filename, newClassName, m_widgetProperties[newClassName]);
+                getThemeLoader()->load(m_filename, newClassName, m_widgetProperties[newClassName]);
             }
         }
 
@@ -231,6 +248,7 @@ namespace tgui
     void Theme::reload(Widget::Ptr widget, std::string className)
     {
         className = toLower(className);
+        m_prototypes.erase(className);
 
         // If we don't have the class name in the cache then check if the theme loader has it
         std::string widgetType;
@@ -241,13 +259,13 @@ namespace tgui
             else
             {
                 m_widgetProperties[className].clear();
-                widgetType = toLower(m_themeLoader->load(m_filename, className, m_widgetProperties[className]));
+                widgetType = toLower(getThemeLoader()->load(m_filename, className, m_widgetProperties[className]));
             }
         }
         else // Load the white theme
         {
             widgetType = className;
-            if (!m_constructors[widgetType])
+            if (!getConstructFunction(widgetType))
                 throw Exception{"Failed to reload widget of type '" + widgetType + "'. No constructor function was set for that type."};
         }
 
@@ -264,6 +282,7 @@ namespace tgui
     {
         auto theme = std::make_shared<Theme>(*this);
         theme->m_widgets.clear();
+        theme->m_prototypes.clear();
         return theme;
     }
 
@@ -292,6 +311,7 @@ namespace tgui
     {
         className = toLower(className);
         m_widgetProperties[className][toLower(property)] = value;
+        m_prototypes.erase(className);
 
         for (auto& pair : m_widgets)
         {
@@ -306,6 +326,7 @@ namespace tgui
     {
         className = toLower(className);
         m_widgetProperties[className][toLower(property)] = Serializer::serialize(std::move(value));
+        m_prototypes.erase(className);
 
         for (auto& pair : m_widgets)
         {
@@ -347,15 +368,17 @@ namespace tgui
         if (filename != m_filename)
             throw Exception{"Theme tried to init widget which gave a wrong filename"};
 
-        // Temporarily change the resource path to load relative from the theme file
-        std::string oldResourcePath = getResourcePath();
+        // Temporarily change the resource path to load relative from the theme file.
+        // Only the path of the current thread is changed, so that guis on other threads aren't affected.
+        const std::string themeResourcePath = getResourcePath() + m_resourcePath;
+        const std::string* oldThreadResourcePath = nullptr;
 
         bool resourcePathChanged = false;
         if (!m_resourcePathLock && !m_resourcePath.empty())
         {
             m_resourcePathLock = true;
             resourcePathChanged = true;
-            setResourcePath(oldResourcePath + m_resourcePath);
+            oldThreadResourcePath = Context::setThreadResourcePath(&themeResourcePath);
         }
 
         try
@@ -368,7 +391,7 @@ namespace tgui
             // Restore the resource path before throwing
             if (resourcePathChanged)
             {
-                setResourcePath(oldResourcePath);
+                Context::setThreadResourcePath(oldThreadResourcePath);
                 m_resourcePathLock = false;
             }
             throw e;
@@ -377,7 +400,7 @@ namespace tgui
         // Restore the resource path
         if (resourcePathChanged)
         {
-            setResourcePath(oldResourcePath);
+            Context::setThreadResourcePath(oldThreadResourcePath);
             m_resourcePathLock = false;
         }
     }
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Context.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Label.hpp>
@@ -55,27 +56,27 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::map<std::string, std::map<std::string, DefaultThemeLoader::PropertyValuePairs>> DefaultThemeLoader::m_propertiesCache;
-    std::map<std::string, std::map<std::string, std::string>> DefaultThemeLoader::m_widgetTypeCache;
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_themeCacheMutex};
+        auto& propertiesCache = context.m_themePropertiesCache;
+        auto& widgetTypeCache = context.m_themeWidgetTypeCache;
+
         if (filename != "")
         {
-            auto propertiesCacheIt = m_propertiesCache.find(filename);
-            if (propertiesCacheIt != m_propertiesCache.end())
-                m_propertiesCache.erase(propertiesCacheIt);
+            auto propertiesCacheIt = propertiesCache.find(filename);
+            if (propertiesCacheIt != propertiesCache.end())
+                propertiesCache.erase(propertiesCacheIt);
 
-            auto widgetTypeCacheIt = m_widgetTypeCache.find(filename);
-            if (widgetTypeCacheIt != m_widgetTypeCache.end())
-                m_widgetTypeCache.erase(widgetTypeCacheIt);
+            auto widgetTypeCacheIt = widgetTypeCache.find(filename);
+            if (widgetTypeCacheIt != widgetTypeCache.end())
+                widgetTypeCache.erase(widgetTypeCacheIt);
         }
         else
         {
-            m_propertiesCache.clear();
-            m_widgetTypeCache.clear();
+            propertiesCache.clear();
+            widgetTypeCache.clear();
         }
     }
 
@@ -83,10 +84,15 @@ namespace tgui
 
     std::string DefaultThemeLoader::load(const std::string& filename, const std::string& className, std::map<std::string, std::string>& propertyValuePair)
     {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_themeCacheMutex};
+        auto& propertiesCache = context.m_themePropertiesCache;
+        auto& widgetTypeCache = context.m_themeWidgetTypeCache;
+
         std::string lowercaseClassName = toLower(className);
 
         // The file may be cached
-        if (m_propertiesCache.find(filename) == m_propertiesCache.end())
+        if (propertiesCache.find(filename) == propertiesCache.end())
         {
             std::stringstream fileContents;
             readFile(filename, fileContents);
@@ -116,24 +122,24 @@ namespace tgui
 
                 for (auto& pair : child->propertyValuePairs)
                 {
-                    m_propertiesCache[filename][parsedClassName][toLower(pair.first)] = pair.second->value;
-                    m_widgetTypeCache[filename][parsedClassName] = widgetType;
+                    propertiesCache[filename][parsedClassName][toLower(pair.first)] = pair.second->value;
+                    widgetTypeCache[filename][parsedClassName] = widgetType;
                 }
             }
         }
 
         // The class name should be in the cache now
-        if (m_propertiesCache[filename].find(lowercaseClassName) == m_propertiesCache[filename].end())
+        if (propertiesCache[filename].find(lowercaseClassName) == propertiesCache[filename].end())
             throw Exception{"No class '" + className + "' was found in " + filename + "."};
 
         // Copy the properties that were not already set
-        for (auto& pair : m_propertiesCache[filename][lowercaseClassName])
+        for (auto& pair : propertiesCache[filename][lowercaseClassName])
         {
             if (propertyValuePair.find(pair.first) == propertyValuePair.end())
                 propertyValuePair[pair.first] = pair.second;
         }
 
-        return m_widgetTypeCache[filename][lowercaseClassName];
+        return widgetTypeCache[filename][lowercaseClassName];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,11 @@
 #include <TGUI/Widgets/SpinButton.hpp>
 #include <TGUI/Widgets/Tab.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/UpdatePool.hpp>
+#include <TGUI/Context.hpp>
+
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -122,6 +127,109 @@ namespace
         else
             throw tgui::Exception{"Failed to parse layout '" + str + "'. Expected (x,y) or a quoted layout string."};
     }
+
+    // Returns the filename when the value is a serialized texture, or an empty string when it doesn't refer to an image
+    std::string getImageFilename(const std::string& value)
+    {
+        auto openingQuotePos = value.find_first_not_of(" \t\r\n");
+        if ((openingQuotePos == std::string::npos) || (value[openingQuotePos] != '"'))
+            return "";
+
+        // Look for the closing quote in the same way as the texture deserializer does
+        std::string filename;
+        char prev = '\0';
+        for (auto c = value.begin() + openingQuotePos + 1; c != value.end(); ++c)
+        {
+            if ((*c != '"') || (prev == '\\'))
+            {
+                prev = *c;
+                filename.push_back(*c);
+            }
+            else
+            {
+                // Only files with an extension of an image format that SFML can load are decoded
+                auto dotPos = filename.find_last_of('.');
+                if (dotPos == std::string::npos)
+                    return "";
+
+                const std::string extension = tgui::toLower(filename.substr(dotPos + 1));
+                if ((extension == "png") || (extension == "jpg") || (extension == "jpeg") || (extension == "bmp")
+                 || (extension == "tga") || (extension == "gif") || (extension == "psd") || (extension == "hdr") || (extension == "pic"))
+                    return filename;
+                else
+                    return "";
+            }
+        }
+
+        return "";
+    }
+
+    void collectImageFilenames(const std::shared_ptr<tgui::DataIO::Node>& node, std::set<std::string>& filenames)
+    {
+        // Pictures store their filename directly in the widget instead of in the renderer
+        auto filenameIt = node->propertyValuePairs.find("filename");
+        if ((filenameIt != node->propertyValuePairs.end()) && filenameIt->second)
+        {
+            const std::string filename = getImageFilename(filenameIt->second->value);
+            if (!filename.empty())
+                filenames.insert(filename);
+        }
+
+        for (auto& childNode : node->children)
+        {
+            if (tgui::toLower(childNode->name) == "renderer")
+            {
+                for (auto& pair : childNode->propertyValuePairs)
+                {
+                    if (!pair.second)
+                        continue;
+
+                    const std::string filename = getImageFilename(pair.second->value);
+                    if (!filename.empty())
+                        filenames.insert(tgui::getResourcePath() + filename);
+                }
+            }
+            else
+                collectImageFilenames(childNode, filenames);
+        }
+    }
+
+    // Images that were decoded before creating the widgets, they are released when the widgets have been loaded
+    struct PreloadedImages
+    {
+        PreloadedImages(const std::shared_ptr<tgui::DataIO::Node>& rootNode, unsigned int threadCount)
+        {
+            std::set<std::string> filenameSet;
+            collectImageFilenames(rootNode, filenameSet);
+            if (filenameSet.empty())
+                return;
+
+            std::vector<std::string> filenames{filenameSet.begin(), filenameSet.end()};
+            std::vector<std::shared_ptr<sf::Image>> images(filenames.size());
+
+            auto imageLoader = tgui::Texture::getImageLoader();
+            tgui::priv::UpdatePool pool{threadCount};
+            pool.run(filenames.size(), [&](std::size_t i){ images[i] = imageLoader(filenames[i]); });
+
+            // Images that failed to load are loaded again while creating the widgets, to report the error at the same place
+            for (std::size_t i = 0; i < filenames.size(); ++i)
+            {
+                if (images[i])
+                {
+                    tgui::TextureManager::addPreloadedImage(filenames[i], images[i]);
+                    m_filenames.push_back(filenames[i]);
+                }
+            }
+        }
+
+        ~PreloadedImages()
+        {
+            for (auto& filename : m_filenames)
+                tgui::TextureManager::removePreloadedImage(filename);
+        }
+
+        std::vector<std::string> m_filenames;
+    };
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,7 +299,7 @@ namespace tgui
         {
             auto nameSeparator = childNode->name.find('.');
             auto widgetType = childNode->name.substr(0, nameSeparator);
-            auto& loadFunction = WidgetLoader::getLoadFunction(toLower(widgetType));
+            const auto loadFunction = WidgetLoader::getLoadFunction(toLower(widgetType));
             if (loadFunction)
             {
                 std::string className;
@@ -878,10 +986,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::atomic<unsigned int> WidgetLoader::m_threadCount{1};
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetLoader::load(Container::Ptr parent, std::stringstream& stream)
     {
         auto rootNode = DataIO::parse(stream);
 
+        // Decode the images on multiple threads first, the widgets are still created on this thread
+        std::unique_ptr<PreloadedImages> preloadedImages;
+        const unsigned int threadCount = m_threadCount;
+        if (threadCount != 1)
+            preloadedImages = std::unique_ptr<PreloadedImages>(new PreloadedImages{rootNode, threadCount});
+
         if (rootNode->propertyValuePairs.size() != 0)
             loadWidget(rootNode, parent);
 
@@ -889,7 +1007,7 @@ namespace tgui
         {
             auto nameSeparator = node->name.find('.');
             auto widgetType = node->name.substr(0, nameSeparator);
-            auto& loadFunction = m_loadFunctions[toLower(widgetType)];
+            const auto loadFunction = getLoadFunction(widgetType);
             if (loadFunction)
             {
                 std::string className;
@@ -908,14 +1026,35 @@ namespace tgui
 
     void WidgetLoader::setLoadFunction(const std::string& type, const LoadFunction& loadFunction)
     {
+        std::lock_guard<std::mutex> lock{Context::getGlobal().m_widgetLoaderMutex};
         m_loadFunctions[toLower(type)] = loadFunction;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const WidgetLoader::LoadFunction& WidgetLoader::getLoadFunction(const std::string& type)
+    WidgetLoader::LoadFunction WidgetLoader::getLoadFunction(const std::string& type)
+    {
+        std::lock_guard<std::mutex> lock{Context::getGlobal().m_widgetLoaderMutex};
+
+        auto it = m_loadFunctions.find(toLower(type));
+        if (it != m_loadFunctions.end())
+            return it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetLoader::setThreadCount(unsigned int threadCount)
+    {
+        m_threadCount = threadCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int WidgetLoader::getThreadCount()
     {
-        return m_loadFunctions[toLower(type)];
+        return m_threadCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,6 +40,7 @@
 #include <TGUI/Widgets/SpinButton.hpp>
 #include <TGUI/Widgets/Tab.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/Context.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -50,14 +51,14 @@ namespace
         std::string str;
         str += "(";
 
-        if (layout.x.getImpl()->operation == tgui::LayoutImpl::Operation::String)
+        if (layout.x.isStringExpression())
             str += "\"" + layout.x.getImpl()->stringExpression + "\"";
         else
             str += tgui::to_string(layout.x.getValue());
 
         str += ", ";
 
-        if (layout.y.getImpl()->operation == tgui::LayoutImpl::Operation::String)
+        if (layout.y.isStringExpression())
             str += "\"" + layout.y.getImpl()->stringExpression + "\"";
         else
             str += tgui::to_string(layout.y.getValue());
@@ -123,13 +124,17 @@ namespace tgui
     TGUI_API std::shared_ptr<DataIO::Node> saveContainer(Container::Ptr container)
     {
         auto node = saveWidget(container);
+
+        // The nodes of the child widgets are only created when they are emitted, so that the whole tree never has to exist at once
         for (auto& child : container->getWidgets())
         {
-            auto& saveFunction = WidgetSaver::getSaveFunction(toLower(child->getWidgetType()));
-            if (saveFunction)
-                node->children.emplace_back(saveFunction(WidgetConverter{child}));
-            else
+            const auto saveFunction = WidgetSaver::getSaveFunction(toLower(child->getWidgetType()));
+            if (!saveFunction)
                 throw Exception{"No save function exists for widget type '" + child->getWidgetType() + "'."};
+
+            node->children.emplace_back(std::make_shared<DataIO::Node>());
+            node->children.back()->parent = node.get();
+            node->children.back()->deferred = [saveFunction, child]() { return saveFunction(WidgetConverter{child}); };
         }
 
         return node;
@@ -572,33 +577,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetSaver::save(Container::Ptr widget, std::stringstream& stream)
+    void WidgetSaver::save(Container::Ptr widget, std::ostream& stream)
     {
-        auto node = std::make_shared<DataIO::Node>();
+        DataIO::Emitter emitter{stream};
         for (auto& child : widget->getWidgets())
         {
-            auto& saveFunction = WidgetSaver::getSaveFunction(toLower(child->getWidgetType()));
+            const auto saveFunction = WidgetSaver::getSaveFunction(toLower(child->getWidgetType()));
             if (saveFunction)
-                node->children.emplace_back(saveFunction(WidgetConverter{child}));
+                emitter.writeNode(*saveFunction(WidgetConverter{child}));
             else
                 throw Exception{"No save function exists for widget type '" + child->getWidgetType() + "'."};
         }
-
-        DataIO::emit(node, stream);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetSaver::setSaveFunction(const std::string& type, const SaveFunction& saveFunction)
     {
+        std::lock_guard<std::mutex> lock{Context::getGlobal().m_widgetSaverMutex};
         m_saveFunctions[toLower(type)] = saveFunction;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const WidgetSaver::SaveFunction& WidgetSaver::getSaveFunction(const std::string& type)
+    WidgetSaver::SaveFunction WidgetSaver::getSaveFunction(const std::string& type)
     {
-        return m_saveFunctions[toLower(type)];
+        std::lock_guard<std::mutex> lock{Context::getGlobal().m_widgetSaverMutex};
+
+        auto it = m_saveFunctions.find(toLower(type));
+        if (it != m_saveFunctions.end())
+            return it->second;
+        else
+            return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
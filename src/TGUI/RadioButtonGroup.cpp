@@ -0,0 +1,85 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RadioButtonGroup.hpp>
+#include <TGUI/Widgets/RadioButton.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButtonGroup::Ptr RadioButtonGroup::create()
+    {
+        return std::make_shared<RadioButtonGroup>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButton::Ptr RadioButtonGroup::getCheckedRadioButton() const
+    {
+        return m_checkedRadioButton.lock();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButtonGroup::uncheckRadioButtons()
+    {
+        // The radio button will call radioButtonUnchecked which resets the pointer
+        RadioButton::Ptr checkedRadioButton = m_checkedRadioButton.lock();
+        if (checkedRadioButton)
+            checkedRadioButton->uncheck();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButtonGroup::radioButtonChecked(const RadioButton::Ptr& radioButton)
+    {
+        RadioButton::Ptr previousRadioButton = m_checkedRadioButton.lock();
+        if (previousRadioButton == radioButton)
+            return;
+
+        m_checkedRadioButton = radioButton;
+
+        if (previousRadioButton)
+            previousRadioButton->uncheck();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButtonGroup::radioButtonUnchecked(RadioButton* radioButton)
+    {
+        // The weak pointer has already expired when the radio button is being destroyed
+        RadioButton::Ptr checkedRadioButton = m_checkedRadioButton.lock();
+        if (!checkedRadioButton || (checkedRadioButton.get() == radioButton))
+            m_checkedRadioButton.reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,432 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RenderBackend.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/Texture.hpp>
+#include <TGUI/Widget.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Lists that are handed out by RenderCommandList::ScratchList, the first "used" lists are currently in use
+    struct ScratchLists
+    {
+        std::vector<std::unique_ptr<tgui::RenderCommandList>> lists;
+        std::size_t used = 0;
+    };
+
+    ScratchLists& getScratchLists()
+    {
+        thread_local ScratchLists scratchLists;
+        return scratchLists;
+    }
+
+    // Same calculation as in sf::Shape
+    sf::Vector2f computeNormal(const sf::Vector2f& p1, const sf::Vector2f& p2)
+    {
+        sf::Vector2f normal{p1.y - p2.y, p2.x - p1.x};
+        const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+        if (length != 0)
+            normal /= length;
+        return normal;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addQuad(const sf::Transform& transform, const sf::FloatRect& rect, const sf::Color& color)
+    {
+        const sf::Vector2f topLeft = transform.transformPoint(rect.left, rect.top);
+        const sf::Vector2f topRight = transform.transformPoint(rect.left + rect.width, rect.top);
+        const sf::Vector2f bottomLeft = transform.transformPoint(rect.left, rect.top + rect.height);
+        const sf::Vector2f bottomRight = transform.transformPoint(rect.left + rect.width, rect.top + rect.height);
+
+        m_vertices.emplace_back(topLeft, color);
+        m_vertices.emplace_back(topRight, color);
+        m_vertices.emplace_back(bottomLeft, color);
+        m_vertices.emplace_back(bottomLeft, color);
+        m_vertices.emplace_back(topRight, color);
+        m_vertices.emplace_back(bottomRight, color);
+
+        addTriangles(Command::Type::Quad, nullptr, 6);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addTexture(sf::Transform transform, const Texture& texture)
+    {
+        if (!texture.m_loaded || (texture.m_geometry.vertexCount < 3))
+            return;
+
+        // A rotation can cause the image to be shifted, so we move it upfront so that it ends at the correct location
+        if (texture.getRotation() != 0)
+        {
+            const sf::FloatRect bounds = texture.getTransform().transformRect(sf::FloatRect({}, texture.getSize()));
+            transform.translate(texture.getPosition() - sf::Vector2f{bounds.left, bounds.top});
+        }
+
+        transform *= texture.getTransform();
+
+        const bool clipped = (texture.m_textureRect != sf::FloatRect(0, 0, 0, 0));
+        if (clipped)
+            pushClip(transform, texture.m_textureRect);
+
+        // The geometry of the texture is a triangle strip, which is split into separate triangles
+        const priv::TextureGeometry& geometry = texture.m_geometry;
+        for (std::size_t i = 2; i < geometry.vertexCount; ++i)
+        {
+            for (std::size_t j = i - 2; j <= i; ++j)
+                m_vertices.emplace_back(transform.transformPoint(geometry.positions[j]), texture.m_vertexColor, geometry.texCoords[j]);
+        }
+
+        addTriangles(Command::Type::TexturedQuad, texture.m_data, 3 * (geometry.vertexCount - 2));
+
+        if (clipped)
+            popClip();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addText(const sf::Transform& transform, const sf::Text& text, const std::shared_ptr<sf::Font>& font)
+    {
+        if (text.getString().isEmpty())
+            return;
+
+        // The text is always stored, so that it can still be drawn separately when its glyphs are no longer in the atlas
+        m_glyphRuns.push_back({text, font, transform});
+
+        if (TGUI_DistanceFieldTextEnabled && font && (text.getFont() == font.get()))
+        {
+            auto distanceFieldFont = priv::DistanceFieldFont::get(font);
+            priv::GlyphAtlas& atlas = priv::GlyphAtlas::getGlobal();
+            std::lock_guard<std::recursive_mutex> lock{atlas.getMutex()};
+
+            unsigned int shelves = 0;
+            const std::vector<sf::Vertex>* geometry = distanceFieldFont->getGeometry(text, &shelves);
+            if (geometry)
+            {
+                const sf::Transform textTransform = transform * text.getTransform();
+                for (const auto& vertex : *geometry)
+                    m_vertices.emplace_back(textTransform.transformPoint(vertex.position), vertex.color, vertex.texCoords);
+
+                // All glyphs are in the same texture, so the text can be merged with the previous one unless loading the glyphs
+                // of this text removed glyphs that the previous texts need
+                if (!m_commands.empty() && (m_commands.back().type == Command::Type::GlyphAtlasTriangles)
+                 && (m_commands.back().firstVertex + m_commands.back().vertexCount == m_vertices.size() - geometry->size())
+                 && !atlas.shelvesClearedSince(m_commands.back().atlasShelves, m_commands.back().atlasGeneration))
+                {
+                    m_commands.back().vertexCount += geometry->size();
+                    m_commands.back().glyphRunCount++;
+                    m_commands.back().atlasShelves |= shelves;
+                    m_commands.back().atlasGeneration = atlas.getGeneration();
+                    return;
+                }
+
+                Command command;
+                command.type = Command::Type::GlyphAtlasTriangles;
+                command.firstVertex = m_vertices.size() - geometry->size();
+                command.vertexCount = geometry->size();
+                command.glyphRun = m_glyphRuns.size() - 1;
+                command.glyphRunCount = 1;
+                command.atlasShelves = shelves;
+                command.atlasGeneration = atlas.getGeneration();
+                m_commands.push_back(command);
+                return;
+            }
+        }
+
+        Command command;
+        command.type = Command::Type::GlyphRun;
+        command.glyphRun = m_glyphRuns.size() - 1;
+        m_commands.push_back(command);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addShape(const sf::Transform& transform, const sf::Shape& shape)
+    {
+        const std::size_t pointCount = shape.getPointCount();
+        if (pointCount < 3)
+            return;
+
+        const sf::Transform shapeTransform = transform * shape.getTransform();
+
+        // The fill is a triangle fan around the center of the shape, like sf::Shape does it
+        std::vector<sf::Vector2f> points(pointCount);
+        sf::Vector2f minPoint = shape.getPoint(0);
+        sf::Vector2f maxPoint = minPoint;
+        for (std::size_t i = 0; i < pointCount; ++i)
+        {
+            points[i] = shape.getPoint(i);
+            minPoint = {std::min(minPoint.x, points[i].x), std::min(minPoint.y, points[i].y)};
+            maxPoint = {std::max(maxPoint.x, points[i].x), std::max(maxPoint.y, points[i].y)};
+        }
+        const sf::Vector2f center = (minPoint + maxPoint) / 2.f;
+
+        if (shape.getFillColor() != sf::Color::Transparent)
+        {
+            for (std::size_t i = 0; i < pointCount; ++i)
+            {
+                m_vertices.emplace_back(shapeTransform.transformPoint(center), shape.getFillColor());
+                m_vertices.emplace_back(shapeTransform.transformPoint(points[i]), shape.getFillColor());
+                m_vertices.emplace_back(shapeTransform.transformPoint(points[(i + 1) % pointCount]), shape.getFillColor());
+            }
+
+            addTriangles(Command::Type::Quad, nullptr, 3 * pointCount);
+        }
+
+        // The outline is a band along the edges, with the same corners as the ones that sf::Shape calculates
+        const float thickness = shape.getOutlineThickness();
+        if ((thickness != 0) && (shape.getOutlineColor() != sf::Color::Transparent))
+        {
+            std::vector<sf::Vector2f> outline(2 * pointCount);
+            for (std::size_t i = 0; i < pointCount; ++i)
+            {
+                const sf::Vector2f& p0 = points[(i + pointCount - 1) % pointCount];
+                const sf::Vector2f& p1 = points[i];
+                const sf::Vector2f& p2 = points[(i + 1) % pointCount];
+
+                // Make sure that the normals point towards the outside of the shape
+                sf::Vector2f n1 = computeNormal(p0, p1);
+                sf::Vector2f n2 = computeNormal(p1, p2);
+                if (n1.x * (center.x - p1.x) + n1.y * (center.y - p1.y) > 0)
+                    n1 = -n1;
+                if (n2.x * (center.x - p1.x) + n2.y * (center.y - p1.y) > 0)
+                    n2 = -n2;
+
+                const float factor = 1.f + (n1.x * n2.x + n1.y * n2.y);
+                const sf::Vector2f normal = (n1 + n2) / factor;
+
+                outline[2 * i] = shapeTransform.transformPoint(p1);
+                outline[2 * i + 1] = shapeTransform.transformPoint(p1 + normal * thickness);
+            }
+
+            for (std::size_t i = 0; i < pointCount; ++i)
+            {
+                const std::size_t next = (i + 1) % pointCount;
+                m_vertices.emplace_back(outline[2 * i], shape.getOutlineColor());
+                m_vertices.emplace_back(outline[2 * i + 1], shape.getOutlineColor());
+                m_vertices.emplace_back(outline[2 * next], shape.getOutlineColor());
+                m_vertices.emplace_back(outline[2 * next], shape.getOutlineColor());
+                m_vertices.emplace_back(outline[2 * i + 1], shape.getOutlineColor());
+                m_vertices.emplace_back(outline[2 * next + 1], shape.getOutlineColor());
+            }
+
+            addTriangles(Command::Type::Quad, nullptr, 6 * pointCount);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addWidget(const sf::Transform& transform, const tgui::Widget& widget)
+    {
+        Command command;
+        command.type = Command::Type::Widget;
+        command.widget = &widget;
+        command.widgetTransform = transform;
+        m_commands.push_back(command);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::pushClip(const sf::Transform& transform, const sf::FloatRect& rect)
+    {
+        Command command;
+        command.type = Command::Type::PushClip;
+        command.clipRect = rect;
+        command.clipTransform = transform;
+        m_commands.push_back(command);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::popClip()
+    {
+        Command command;
+        command.type = Command::Type::PopClip;
+        m_commands.push_back(command);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::clear()
+    {
+        m_commands.clear();
+        m_vertices.clear();
+        m_glyphRuns.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderCommandList::ScratchList::ScratchList() :
+        m_commands([]() -> RenderCommandList& {
+            ScratchLists& scratchLists = getScratchLists();
+            if (scratchLists.used == scratchLists.lists.size())
+                scratchLists.lists.emplace_back(new RenderCommandList);
+
+            RenderCommandList& commands = *scratchLists.lists[scratchLists.used++];
+            commands.clear();
+            return commands;
+        }())
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderCommandList::ScratchList::~ScratchList()
+    {
+        getScratchLists().used--;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addTriangles(Command::Type type, const std::shared_ptr<const TextureData>& texture, std::size_t vertexCount)
+    {
+        if (!m_commands.empty() && (m_commands.back().type == type) && (m_commands.back().texture == texture)
+         && (m_commands.back().firstVertex + m_commands.back().vertexCount == m_vertices.size() - vertexCount))
+        {
+            m_commands.back().vertexCount += vertexCount;
+            return;
+        }
+
+        Command command;
+        command.type = type;
+        command.firstVertex = m_vertices.size() - vertexCount;
+        command.vertexCount = vertexCount;
+        command.texture = texture;
+        m_commands.push_back(command);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SfmlRenderBackend::SfmlRenderBackend(sf::RenderTarget& target) :
+        m_target(target)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SfmlRenderBackend::~SfmlRenderBackend()
+    {
+        // The clipping has to be restored in the opposite order in which it was set
+        while (!m_clipping.empty())
+            m_clipping.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SfmlRenderBackend::render(const RenderCommandList& commands)
+    {
+        const std::vector<RenderCommandList::Command>& commandList = commands.getCommands();
+        const std::vector<sf::Vertex>& vertices = commands.getVertices();
+
+        for (const auto& command : commandList)
+        {
+            switch (command.type)
+            {
+                case RenderCommandList::Command::Type::Quad:
+                case RenderCommandList::Command::Type::TexturedQuad:
+                {
+                    // Consecutive triangles with the same texture were already merged into one command while recording
+                    sf::RenderStates states;
+                    if (command.texture)
+                        states.texture = &command.texture->getTexture();
+
+                    m_target.draw(&vertices[command.firstVertex], command.vertexCount, sf::PrimitiveType::Triangles, states);
+                    ++m_drawCallCount;
+                    break;
+                }
+                case RenderCommandList::Command::Type::GlyphRun:
+                {
+                    const RenderCommandList::GlyphRun& glyphRun = commands.getGlyphRuns()[command.glyphRun];
+                    priv::drawText(m_target, sf::RenderStates{glyphRun.transform}, glyphRun.text, glyphRun.font);
+                    ++m_drawCallCount;
+                    break;
+                }
+                case RenderCommandList::Command::Type::GlyphAtlasTriangles:
+                {
+                    // The glyphs may not be replaced in the atlas until the texts have been drawn
+                    priv::GlyphAtlas& atlas = priv::GlyphAtlas::getGlobal();
+                    std::lock_guard<std::recursive_mutex> lock{atlas.getMutex()};
+
+                    sf::Shader* shader = priv::getDistanceFieldShader();
+                    if (shader && !atlas.shelvesClearedSince(command.atlasShelves, command.atlasGeneration))
+                    {
+                        sf::RenderStates states;
+                        states.texture = &atlas.getTexture();
+                        states.shader = shader;
+                        m_target.draw(vertices.data() + command.firstVertex, command.vertexCount, sf::PrimitiveType::Triangles, states);
+                        ++m_drawCallCount;
+                    }
+                    else // The texts can't be drawn together, so draw them one by one
+                    {
+                        for (std::size_t i = command.glyphRun; i < command.glyphRun + command.glyphRunCount; ++i)
+                        {
+                            const RenderCommandList::GlyphRun& glyphRun = commands.getGlyphRuns()[i];
+                            priv::drawText(m_target, sf::RenderStates{glyphRun.transform}, glyphRun.text, glyphRun.font);
+                            ++m_drawCallCount;
+                        }
+                    }
+                    break;
+                }
+                case RenderCommandList::Command::Type::PushClip:
+                {
+                    m_clipping.emplace_back(new Clipping{m_target, sf::RenderStates{command.clipTransform},
+                                                         {command.clipRect.left, command.clipRect.top},
+                                                         {command.clipRect.width, command.clipRect.height}});
+                    break;
+                }
+                case RenderCommandList::Command::Type::PopClip:
+                {
+                    if (!m_clipping.empty())
+                        m_clipping.pop_back();
+                    break;
+                }
+                case RenderCommandList::Command::Type::Widget:
+                {
+                    m_target.draw(*command.widget, sf::RenderStates{command.widgetTransform});
+                    ++m_drawCallCount;
+                    break;
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
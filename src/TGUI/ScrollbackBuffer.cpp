@@ -0,0 +1,421 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/ScrollbackBuffer.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+#ifndef _WIN32
+    #include <sys/types.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // The heights of this many lines are summed together
+    const std::size_t blockSize = 1024;
+
+    bool seekFile(std::FILE* file, std::uint64_t offset)
+    {
+#ifdef _WIN32
+        return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+        // Without large file support off_t only has 32 bits, the text can then not grow beyond 2GB
+        if (offset > static_cast<std::uint64_t>(std::numeric_limits<off_t>::max()))
+            return false;
+
+        return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ScrollbackBuffer::ScrollbackBuffer(bool useFile)
+        {
+            if (useFile)
+            {
+                m_file = std::tmpfile();
+                if (!m_file)
+                    throw Exception{"Failed to create temporary file for the scrollback buffer."};
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ScrollbackBuffer::ScrollbackBuffer(const ScrollbackBuffer& copy) :
+            ScrollbackBuffer{copy.isUsingFile()}
+        {
+            m_fonts = copy.m_fonts;
+            m_totalHeight = copy.m_totalHeight;
+            m_blockHeights = copy.m_blockHeights;
+            m_firstLineInBlock = copy.m_firstLineInBlock;
+
+            // Only the text that is still used is copied
+            for (const auto& record : copy.m_records)
+            {
+                LineRecord newRecord = record;
+                newRecord.offset = m_textSize;
+                m_records.push_back(newRecord);
+                writeText(copy.readText(record));
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ScrollbackBuffer& ScrollbackBuffer::operator=(const ScrollbackBuffer& right)
+        {
+            if (this != &right)
+            {
+                ScrollbackBuffer temp{right};
+
+                std::swap(m_records,      temp.m_records);
+                std::swap(m_blockHeights, temp.m_blockHeights);
+                std::swap(m_firstLineInBlock, temp.m_firstLineInBlock);
+                std::swap(m_fonts,        temp.m_fonts);
+                std::swap(m_text,         temp.m_text);
+                std::swap(m_file,         temp.m_file);
+                std::swap(m_textSize,     temp.m_textSize);
+                std::swap(m_usedTextSize, temp.m_usedTextSize);
+                std::swap(m_totalHeight,  temp.m_totalHeight);
+            }
+
+            return *this;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ScrollbackBuffer::~ScrollbackBuffer()
+        {
+            // Temporary files are removed automatically when they are closed
+            if (m_file)
+                std::fclose(m_file);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool ScrollbackBuffer::isUsingFile() const
+        {
+            return m_file != nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ScrollbackBuffer::append(const sf::String& text, const sf::Color& color, unsigned int textSize, const std::shared_ptr<sf::Font>& font, float height)
+        {
+            auto fontIt = std::find(m_fonts.begin(), m_fonts.end(), font);
+            if (fontIt == m_fonts.end())
+            {
+                assert(m_fonts.size() < 0xFFFF);
+                fontIt = m_fonts.insert(m_fonts.end(), font);
+            }
+
+            const auto utf8 = text.toUtf8();
+
+            LineRecord record;
+            record.offset = m_textSize;
+            record.length = static_cast<std::uint32_t>(utf8.size());
+            record.color = (static_cast<sf::Uint32>(color.r) << 24) | (static_cast<sf::Uint32>(color.g) << 16) | (static_cast<sf::Uint32>(color.b) << 8) | color.a;
+            record.textSize = static_cast<std::uint16_t>(textSize);
+            record.fontIndex = static_cast<std::uint16_t>(fontIt - m_fonts.begin());
+            record.height = height;
+
+            writeText(utf8);
+
+            if ((m_firstLineInBlock + m_records.size()) % blockSize == 0)
+                m_blockHeights.push_back(0);
+
+            m_records.push_back(record);
+            m_blockHeights.back() += height;
+            m_totalHeight += height;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ScrollbackBuffer::remove(std::size_t index, std::size_t count)
+        {
+            assert(index + count <= m_records.size());
+
+            for (std::size_t i = index; i < index + count; ++i)
+                m_usedTextSize -= m_records[i].length;
+
+            if (count == m_records.size())
+            {
+                clear();
+                return;
+            }
+
+            if (index == 0)
+            {
+                // The oldest lines are removed each time a line is added to a full chat box. The lines behind them keep their
+                // blocks, the first block just starts with fewer lines.
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    m_blockHeights[(m_firstLineInBlock + i) / blockSize] -= m_records[i].height;
+                    m_totalHeight -= m_records[i].height;
+                }
+
+                m_records.erase(m_records.begin(), m_records.begin() + count);
+
+                m_firstLineInBlock += count;
+                m_blockHeights.erase(m_blockHeights.begin(), m_blockHeights.begin() + m_firstLineInBlock / blockSize);
+                m_firstLineInBlock %= blockSize;
+            }
+            else
+            {
+                m_records.erase(m_records.begin() + index, m_records.begin() + index + count);
+
+                // The lines behind the removed ones move to other blocks
+                recalculateBlockHeights((m_firstLineInBlock + index) / blockSize);
+            }
+
+            // Rewrite the text once most of it is no longer used
+            if ((m_textSize - m_usedTextSize > m_usedTextSize) && (m_textSize - m_usedTextSize > (1 << 20)))
+                compact();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ScrollbackBuffer::clear()
+        {
+            m_records.clear();
+            m_blockHeights.clear();
+            m_firstLineInBlock = 0;
+            m_fonts.clear();
+            m_text.clear();
+            m_textSize = 0;
+            m_usedTextSize = 0;
+            m_totalHeight = 0;
+
+            if (m_file)
+            {
+                std::fclose(m_file);
+                m_file = std::tmpfile();
+                if (!m_file)
+                    throw Exception{"Failed to create temporary file for the scrollback buffer."};
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t ScrollbackBuffer::getLineCount() const
+        {
+            return m_records.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::String ScrollbackBuffer::getText(std::size_t index) const
+        {
+            const auto utf8 = readText(m_records[index]);
+            return sf::String::fromUtf8(utf8.begin(), utf8.end());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::Color ScrollbackBuffer::getColor(std::size_t index) const
+        {
+            const sf::Uint32 color = m_records[index].color;
+            return {static_cast<sf::Uint8>(color >> 24), static_cast<sf::Uint8>(color >> 16), static_cast<sf::Uint8>(color >> 8), static_cast<sf::Uint8>(color)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int ScrollbackBuffer::getTextSize(std::size_t index) const
+        {
+            return m_records[index].textSize;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::shared_ptr<sf::Font> ScrollbackBuffer::getFont(std::size_t index) const
+        {
+            return m_fonts[m_records[index].fontIndex];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float ScrollbackBuffer::getHeight(std::size_t index) const
+        {
+            return m_records[index].height;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ScrollbackBuffer::setHeight(std::size_t index, float height)
+        {
+            const double difference = height - m_records[index].height;
+            m_records[index].height = height;
+            m_blockHeights[(m_firstLineInBlock + index) / blockSize] += difference;
+            m_totalHeight += difference;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ScrollbackBuffer::replaceMissingFont(const std::shared_ptr<sf::Font>& font)
+        {
+            auto fontIt = std::find(m_fonts.begin(), m_fonts.end(), nullptr);
+            if (fontIt != m_fonts.end())
+                *fontIt = font;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float ScrollbackBuffer::getTotalHeight() const
+        {
+            return static_cast<float>(m_totalHeight);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float ScrollbackBuffer::getTopPosition(std::size_t index) const
+        {
+            double position = 0;
+
+            const std::size_t block = (m_firstLineInBlock + index) / blockSize;
+            for (std::size_t i = 0; i < block; ++i)
+                position += m_blockHeights[i];
+
+            for (std::size_t i = getFirstLineOfBlock(block); i < index; ++i)
+                position += m_records[i].height;
+
+            return static_cast<float>(position);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t ScrollbackBuffer::findLine(float position) const
+        {
+            double top = 0;
+            for (std::size_t block = 0; block < m_blockHeights.size(); ++block)
+            {
+                if (position >= top + m_blockHeights[block])
+                {
+                    top += m_blockHeights[block];
+                    continue;
+                }
+
+                const std::size_t end = std::min(getFirstLineOfBlock(block + 1), m_records.size());
+                for (std::size_t i = getFirstLineOfBlock(block); i < end; ++i)
+                {
+                    top += m_records[i].height;
+                    if (position < top)
+                        return i;
+                }
+            }
+
+            return m_records.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ScrollbackBuffer::writeText(const std::basic_string<sf::Uint8>& text)
+        {
+            if (m_file)
+            {
+                if (!seekFile(m_file, m_textSize) || (std::fwrite(text.data(), 1, text.size(), m_file) != text.size()))
+                    throw Exception{"Failed to write to the file of the scrollback buffer."};
+            }
+            else
+                m_text.insert(m_text.end(), text.begin(), text.end());
+
+            m_textSize += text.size();
+            m_usedTextSize += text.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::basic_string<sf::Uint8> ScrollbackBuffer::readText(const LineRecord& record) const
+        {
+            if (m_file)
+            {
+                std::basic_string<sf::Uint8> text(record.length, 0);
+                if (!seekFile(m_file, record.offset) || (std::fread(&text[0], 1, record.length, m_file) != record.length))
+                    throw Exception{"Failed to read from the file of the scrollback buffer."};
+
+                return text;
+            }
+            else
+                return {m_text.begin() + static_cast<std::ptrdiff_t>(record.offset), m_text.begin() + static_cast<std::ptrdiff_t>(record.offset + record.length)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t ScrollbackBuffer::getFirstLineOfBlock(std::size_t block) const
+        {
+            if (block == 0)
+                return 0;
+            else
+                return block * blockSize - m_firstLineInBlock;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ScrollbackBuffer::recalculateBlockHeights(std::size_t firstBlock)
+        {
+            m_blockHeights.resize((m_firstLineInBlock + m_records.size() + blockSize - 1) / blockSize);
+
+            for (std::size_t block = firstBlock; block < m_blockHeights.size(); ++block)
+            {
+                m_blockHeights[block] = 0;
+
+                const std::size_t end = std::min(getFirstLineOfBlock(block + 1), m_records.size());
+                for (std::size_t i = getFirstLineOfBlock(block); i < end; ++i)
+                    m_blockHeights[block] += m_records[i].height;
+            }
+
+            m_totalHeight = 0;
+            for (const double height : m_blockHeights)
+                m_totalHeight += height;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ScrollbackBuffer::compact()
+        {
+            ScrollbackBuffer compacted{*this};
+
+            std::swap(m_records,      compacted.m_records);
+            std::swap(m_text,         compacted.m_text);
+            std::swap(m_file,         compacted.m_file);
+            std::swap(m_textSize,     compacted.m_textSize);
+            std::swap(m_usedTextSize, compacted.m_usedTextSize);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
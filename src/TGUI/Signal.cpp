@@ -24,6 +24,9 @@
 
 
 #include <TGUI/Signal.hpp>
+#include <TGUI/Context.hpp>
+
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -31,27 +34,156 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::deque<const void*> priv::data; // deque because vector could reallocate when resizing after parameters are already bound
-    unsigned int SignalWidgetBase::m_lastId = 0;
+    std::deque<const void*>& priv::getSignalData()
+    {
+        // Every thread has its own parameters, so that widgets on different threads can send signals at the same time
+        thread_local std::deque<const void*> data;
+        return data;
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal::Signal(std::vector<std::vector<std::string>>&& types)
+    std::vector<std::function<void()>>*& priv::getDeferredSignals()
+    {
+        thread_local std::vector<std::function<void()>>* deferredSignals = nullptr;
+        return deferredSignals;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    priv::DelayedSignalHandler::DelayedSignalHandler(const std::function<void()>& func, SignalDelivery signalDelivery, sf::Time signalDuration) :
+        function{func},
+        delivery{signalDelivery},
+        duration{signalDuration}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void priv::DelayedSignalHandler::queue(std::function<void()>&& call, const std::shared_ptr<DelayedSignalQueue>& target)
+    {
+        if ((delivery == SignalDelivery::Throttle) && !throttling)
+        {
+            // The first value is delivered immediately, later values have to wait until the duration has passed
+            throttling = true;
+            elapsed = {};
+            pendingCall = nullptr;
+            call();
+        }
+        else
+        {
+            if (delivery == SignalDelivery::Debounce)
+                elapsed = {};
+
+            pendingCall = std::move(call);
+        }
+
+        // When the widget was moved to another gui, the handler is moved to the queue of that gui
+        if (registeredQueue.lock() != target)
+        {
+            registeredQueue = target;
+            target->add(shared_from_this());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool priv::DelayedSignalHandler::update(sf::Time elapsedTime)
     {
-        std::size_t maxSize = 0;
-        for (auto& typeList : types)
-            maxSize += typeList.size();
+        elapsed += elapsedTime;
+
+        bool callNow = false;
+        if (delivery == SignalDelivery::Throttle)
+        {
+            if (elapsed >= duration)
+            {
+                elapsed = {};
+                callNow = (pendingCall != nullptr);
+                throttling = callNow;
+            }
+        }
+        else if (delivery == SignalDelivery::Debounce)
+            callNow = (elapsed >= duration);
+        else
+            callNow = true;
 
+        if (callNow && pendingCall)
+        {
+            // The call may send the signal again, which will store a new pending call
+            auto call = std::move(pendingCall);
+            pendingCall = nullptr;
+            call();
+        }
+
+        return throttling || pendingCall;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void priv::DelayedSignalQueue::add(const std::shared_ptr<DelayedSignalHandler>& handler)
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_handlers.push_back(handler);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void priv::DelayedSignalQueue::deliver(sf::Time elapsedTime)
+    {
+        // The handlers are taken out of the list, so that they can send signals (and thus register handlers) themselves
+        std::vector<std::weak_ptr<DelayedSignalHandler>> handlers;
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            handlers.swap(m_handlers);
+        }
+
+        std::set<const DelayedSignalHandler*> updatedHandlers;
+        std::vector<std::weak_ptr<DelayedSignalHandler>> remainingHandlers;
+        for (const auto& weakHandler : handlers)
+        {
+            // The handler no longer exists when the widget was destroyed or when the handler was disconnected
+            auto handler = weakHandler.lock();
+            if (!handler)
+                continue;
+
+            // The handler is no longer updated here when its widget was moved to another gui. When the widget was moved back,
+            // the handler can be in the list twice.
+            if ((handler->registeredQueue.lock().get() != this) || !updatedHandlers.insert(handler.get()).second)
+                continue;
+
+            if (handler->update(elapsedTime))
+                remainingHandlers.push_back(handler);
+            else
+                handler->registeredQueue.reset();
+        }
+
+        if (!remainingHandlers.empty())
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_handlers.insert(m_handlers.end(), remainingHandlers.begin(), remainingHandlers.end());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::Signal(std::vector<std::vector<std::string>>&& types)
+    {
         m_allowedTypes = types;
-        if (maxSize > priv::data.size())
-            priv::data.resize(maxSize, nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::generateId()
+    {
+        return Context::getGlobal().m_lastSignalId++;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::disconnect(unsigned int id)
     {
-        return !!m_functions.erase(id) || !!m_functionsEx.erase(id);
+        return !!m_functions.erase(id) || !!m_functionsEx.erase(id) || !!m_delayedFunctions.erase(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,13 +192,74 @@ namespace tgui
     {
         m_functions.clear();
         m_functionsEx.clear();
+        m_delayedFunctions.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::isEmpty() const
     {
-        return m_functions.empty();
+        return m_functions.empty() && m_delayedFunctions.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Signal::getHandlerCount() const
+    {
+        return m_functions.size() + m_functionsEx.size() + m_delayedFunctions.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::setDelivery(unsigned int id, SignalDelivery delivery, sf::Time duration)
+    {
+        std::function<void()> function;
+
+        auto it = m_functions.find(id);
+        if (it != m_functions.end())
+        {
+            function = it->second;
+            m_functions.erase(it);
+        }
+        else
+        {
+            auto delayedIt = m_delayedFunctions.find(id);
+            if (delayedIt == m_delayedFunctions.end())
+                return false;
+
+            // A call that was still pending is dropped
+            function = delayedIt->second->function;
+            m_delayedFunctions.erase(delayedIt);
+        }
+
+        if (delivery == SignalDelivery::Immediate)
+            m_functions[id] = function;
+        else
+            m_delayedFunctions[id] = std::make_shared<priv::DelayedSignalHandler>(function, delivery, duration);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::separateDelayedHandlers()
+    {
+        for (auto& handler : m_delayedFunctions)
+            handler.second = std::make_shared<priv::DelayedSignalHandler>(handler.second->function, handler.second->delivery, handler.second->duration);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::deliverDelayedSignals(sf::Time elapsedTime)
+    {
+        Context::getGlobal().m_delayedSignalQueue->deliver(elapsedTime);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<priv::DelayedSignalQueue> Signal::getGlobalDelayedSignalQueue()
+    {
+        return Context::getGlobal().m_delayedSignalQueue;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,7 +278,13 @@ namespace tgui
     SignalWidgetBase::SignalWidgetBase(const SignalWidgetBase& copy)
     {
         for (auto& signal : copy.m_signals)
+        {
             m_signals[signal.first] = std::make_shared<Signal>(*signal.second);
+            m_signals[signal.first]->separateDelayedHandlers();
+        }
+
+        if (copy.m_callback)
+            m_callback = std::unique_ptr<Callback>(new Callback(*copy.m_callback));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,7 +294,15 @@ namespace tgui
         if (this != &right)
         {
             for (auto& signal : right.m_signals)
+            {
                 m_signals[signal.first] = std::make_shared<Signal>(*signal.second);
+                m_signals[signal.first]->separateDelayedHandlers();
+            }
+
+            if (right.m_callback)
+                m_callback = std::unique_ptr<Callback>(new Callback(*right.m_callback));
+            else
+                m_callback = nullptr;
         }
 
         return *this;
@@ -103,6 +310,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void SignalWidgetBase::createCallback()
+    {
+        m_callback = std::unique_ptr<Callback>(new Callback);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<priv::DelayedSignalQueue> SignalWidgetBase::getDelayedSignalQueue() const
+    {
+        return Signal::getGlobalDelayedSignalQueue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SignalWidgetBase::disconnect(unsigned int id)
     {
         for (auto& signal : m_signals)
@@ -116,6 +337,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void SignalWidgetBase::setSignalDelivery(unsigned int id, SignalDelivery delivery, sf::Time duration)
+    {
+        for (auto& signal : m_signals)
+        {
+            if (signal.second->setDelivery(id, delivery, duration))
+                return;
+        }
+
+        throw Exception{"Failed to change signal delivery. There is no function bound to the given id " + tgui::to_string(id) + "."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SignalWidgetBase::getSignalHandlerCount(const std::string& signalName) const
+    {
+        auto it = m_signals.find(toLower(signalName));
+        if (it == m_signals.end())
+            throw Exception{"There is no signal called '" + signalName + "'."};
+
+        return it->second->getHandlerCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SignalWidgetBase::disconnectAll(const std::string& signalName)
     {
         for (auto& name : extractSignalNames(signalName))
@@ -0,0 +1,356 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/SoftwareRenderBackend.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/Exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Distance field values needed to draw the glyphs of a text
+    struct GlyphShaderData
+    {
+        const std::vector<sf::Uint8>* distances;
+        float smoothing;
+    };
+
+    float edgeFunction(sf::Vector2f from, sf::Vector2f to, sf::Vector2f point)
+    {
+        return (to.x - from.x) * (point.y - from.y) - (to.y - from.y) * (point.x - from.x);
+    }
+
+    // Pixels that lie exactly on an edge shared by two triangles may only be drawn once. Such an edge is walked in the opposite
+    // direction by the other triangle, so the pixel is only drawn for one of the two directions.
+    bool isCovered(float edgeValue, sf::Vector2f from, sf::Vector2f to)
+    {
+        if (edgeValue != 0)
+            return edgeValue > 0;
+        else
+            return (to.y > from.y) || ((to.y == from.y) && (to.x < from.x));
+    }
+
+    sf::Uint8 multiply(sf::Uint8 left, sf::Uint8 right)
+    {
+        return static_cast<sf::Uint8>((left * right + 127) / 255);
+    }
+
+    sf::Color solidShader(const void*, sf::Color color, sf::Vector2f)
+    {
+        return color;
+    }
+
+    sf::Color textureShader(const void* data, sf::Color color, sf::Vector2f texCoords)
+    {
+        const tgui::TextureData& textureData = *static_cast<const tgui::TextureData*>(data);
+        const sf::Image& image = *textureData.image;
+
+        // The texture may only contain a part of the image
+        sf::IntRect rect = textureData.rect;
+        if ((rect.width == 0) || (rect.height == 0))
+            rect = {0, 0, static_cast<int>(image.getSize().x), static_cast<int>(image.getSize().y)};
+
+        const int x = std::max(0, std::min(rect.width - 1, static_cast<int>(std::floor(texCoords.x))));
+        const int y = std::max(0, std::min(rect.height - 1, static_cast<int>(std::floor(texCoords.y))));
+        const sf::Color texel = image.getPixel(rect.left + x, rect.top + y);
+        return {multiply(texel.r, color.r), multiply(texel.g, color.g), multiply(texel.b, color.b), multiply(texel.a, color.a)};
+    }
+
+    // The edge of the glyph is smoothed over about one pixel, in the same way as when drawing with OpenGL.
+    // The screen scale is the amount of pixels on the screen per pixel of the glyph at the reference size.
+    float getSmoothing(float screenScale)
+    {
+        return std::min(0.5f, 0.25f / (tgui::priv::DistanceFieldFont::Spread * std::max(screenScale, 0.01f)));
+    }
+
+    sf::Color glyphShader(const void* data, sf::Color color, sf::Vector2f texCoords)
+    {
+        const GlyphShaderData& glyphData = *static_cast<const GlyphShaderData*>(data);
+        const int atlasSize = static_cast<int>(tgui::priv::GlyphAtlas::AtlasSize);
+
+        auto getDistance = [&](int x, int y) {
+            x = std::max(0, std::min(atlasSize - 1, x));
+            y = std::max(0, std::min(atlasSize - 1, y));
+            return (*glyphData.distances)[y * atlasSize + x] / 255.f;
+        };
+
+        // The distance field is interpolated between the pixel centers, like a smooth texture would be
+        const float x = texCoords.x - 0.5f;
+        const float y = texCoords.y - 0.5f;
+        const int left = static_cast<int>(std::floor(x));
+        const int top = static_cast<int>(std::floor(y));
+        const float fractionX = x - left;
+        const float fractionY = y - top;
+        const float distance = (getDistance(left, top) * (1 - fractionX) + getDistance(left + 1, top) * fractionX) * (1 - fractionY)
+                             + (getDistance(left, top + 1) * (1 - fractionX) + getDistance(left + 1, top + 1) * fractionX) * fractionY;
+
+        // Same calculation as the smoothstep in the shader that is used when drawing with OpenGL
+        const float t = std::max(0.f, std::min(1.f, (distance - (0.5f - glyphData.smoothing)) / (2 * glyphData.smoothing)));
+        const float alpha = t * t * (3 - 2 * t);
+
+        color.a = static_cast<sf::Uint8>(color.a * alpha + 0.5f);
+        return color;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SoftwareRenderBackend::SoftwareRenderBackend(unsigned int width, unsigned int height) :
+        m_size  {width, height},
+        m_pixels(width * height * 4, 0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderBackend::clear(const sf::Color& color)
+    {
+        for (std::size_t i = 0; i < m_pixels.size(); i += 4)
+        {
+            m_pixels[i] = color.r;
+            m_pixels[i+1] = color.g;
+            m_pixels[i+2] = color.b;
+            m_pixels[i+3] = color.a;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderBackend::render(const RenderCommandList& commands)
+    {
+        m_clipping.assign(1, ClipRect{0, 0, static_cast<int>(m_size.x), static_cast<int>(m_size.y)});
+
+        const std::vector<sf::Vertex>& vertices = commands.getVertices();
+        for (const auto& command : commands.getCommands())
+        {
+            switch (command.type)
+            {
+                case RenderCommandList::Command::Type::Quad:
+                {
+                    for (std::size_t i = command.firstVertex; i + 2 < command.firstVertex + command.vertexCount; i += 3)
+                        fillTriangle(vertices[i], vertices[i+1], vertices[i+2], &solidShader, nullptr);
+
+                    break;
+                }
+                case RenderCommandList::Command::Type::TexturedQuad:
+                {
+                    // Textures that were not loaded from an image have no pixels in memory
+                    if (!command.texture || !command.texture->image)
+                        break;
+
+                    for (std::size_t i = command.firstVertex; i + 2 < command.firstVertex + command.vertexCount; i += 3)
+                        fillTriangle(vertices[i], vertices[i+1], vertices[i+2], &textureShader, command.texture.get());
+
+                    break;
+                }
+                case RenderCommandList::Command::Type::GlyphRun:
+                {
+                    renderGlyphRun(commands.getGlyphRuns()[command.glyphRun]);
+                    break;
+                }
+                case RenderCommandList::Command::Type::GlyphAtlasTriangles:
+                {
+                    // The glyphs may not be replaced in the atlas until the texts have been drawn
+                    priv::GlyphAtlas& atlas = priv::GlyphAtlas::getGlobal();
+                    std::lock_guard<std::recursive_mutex> lock{atlas.getMutex()};
+                    if (atlas.shelvesClearedSince(command.atlasShelves, command.atlasGeneration))
+                    {
+                        for (std::size_t i = command.glyphRun; i < command.glyphRun + command.glyphRunCount; ++i)
+                            renderGlyphRun(commands.getGlyphRuns()[i]);
+
+                        break;
+                    }
+
+                    fillGlyphTriangles(vertices.data() + command.firstVertex, command.vertexCount);
+                    break;
+                }
+                case RenderCommandList::Command::Type::PushClip:
+                {
+                    // A pixel lies inside the clipping rectangle when its center does
+                    const ClipRect& oldClipping = m_clipping.back();
+                    const sf::FloatRect rect = command.clipTransform.transformRect(command.clipRect);
+                    m_clipping.push_back({std::max(oldClipping.left, static_cast<int>(std::ceil(rect.left - 0.5f))),
+                                          std::max(oldClipping.top, static_cast<int>(std::ceil(rect.top - 0.5f))),
+                                          std::min(oldClipping.right, static_cast<int>(std::ceil(rect.left + rect.width - 0.5f))),
+                                          std::min(oldClipping.bottom, static_cast<int>(std::ceil(rect.top + rect.height - 0.5f)))});
+                    break;
+                }
+                case RenderCommandList::Command::Type::PopClip:
+                {
+                    if (m_clipping.size() > 1)
+                        m_clipping.pop_back();
+                    break;
+                }
+                case RenderCommandList::Command::Type::Widget:
+                {
+                    throw Exception{"The software render backend can't draw a widget that only implements the draw function."};
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderBackend::renderGlyphRun(const RenderCommandList::GlyphRun& glyphRun)
+    {
+        if (!glyphRun.font || (glyphRun.text.getFont() != glyphRun.font.get()))
+            return;
+
+        // The glyphs may not be replaced in the atlas until the text has been drawn
+        auto distanceFieldFont = priv::DistanceFieldFont::get(glyphRun.font);
+        priv::GlyphAtlas& atlas = priv::GlyphAtlas::getGlobal();
+        std::lock_guard<std::recursive_mutex> lock{atlas.getMutex()};
+        const std::vector<sf::Vertex>* geometry = distanceFieldFont->getGeometry(glyphRun.text);
+        if (!geometry)
+            return;
+
+        std::vector<sf::Vertex> glyphVertices = *geometry;
+
+        const sf::Transform transform = glyphRun.transform * glyphRun.text.getTransform();
+        for (auto& vertex : glyphVertices)
+            vertex.position = transform.transformPoint(vertex.position);
+
+        fillGlyphTriangles(glyphVertices.data(), glyphVertices.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderBackend::fillGlyphTriangles(const sf::Vertex* vertices, std::size_t vertexCount)
+    {
+        const std::vector<sf::Uint8>& distances = priv::GlyphAtlas::getGlobal().getDistances();
+        for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+        {
+            // The texture coordinates are pixels of the glyph at the reference size, so the ratio between the areas of the
+            // triangle on the screen and in the atlas tells how much the glyph is scaled, like the derivatives in the shader do
+            const float textureArea = std::abs(edgeFunction(vertices[i].texCoords, vertices[i+1].texCoords, vertices[i+2].texCoords));
+            if (textureArea == 0)
+                continue;
+
+            const float screenArea = std::abs(edgeFunction(vertices[i].position, vertices[i+1].position, vertices[i+2].position));
+            const GlyphShaderData shaderData{&distances, getSmoothing(std::sqrt(screenArea / textureArea))};
+            fillTriangle(vertices[i], vertices[i+1], vertices[i+2], &glyphShader, &shaderData);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Color SoftwareRenderBackend::getPixel(unsigned int x, unsigned int y) const
+    {
+        const sf::Uint8* pixel = &m_pixels[(y * m_size.x + x) * 4];
+        return {pixel[0], pixel[1], pixel[2], pixel[3]};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Image SoftwareRenderBackend::copyToImage() const
+    {
+        sf::Image image;
+        image.create(m_size.x, m_size.y);
+        for (unsigned int y = 0; y < m_size.y; ++y)
+        {
+            for (unsigned int x = 0; x < m_size.x; ++x)
+                image.setPixel(x, y, getPixel(x, y));
+        }
+
+        return image;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderBackend::fillTriangle(sf::Vertex a, sf::Vertex b, sf::Vertex c, Shader shader, const void* shaderData)
+    {
+        // Give all triangles the same winding order, so that the edge functions are positive inside them
+        float area = edgeFunction(a.position, b.position, c.position);
+        if (area == 0)
+            return;
+        else if (area < 0)
+        {
+            std::swap(b, c);
+            area = -area;
+        }
+
+        const ClipRect& clipping = m_clipping.back();
+        const int left = std::max(clipping.left, static_cast<int>(std::floor(std::min({a.position.x, b.position.x, c.position.x}))));
+        const int top = std::max(clipping.top, static_cast<int>(std::floor(std::min({a.position.y, b.position.y, c.position.y}))));
+        const int right = std::min(clipping.right, static_cast<int>(std::ceil(std::max({a.position.x, b.position.x, c.position.x}))));
+        const int bottom = std::min(clipping.bottom, static_cast<int>(std::ceil(std::max({a.position.y, b.position.y, c.position.y}))));
+
+        for (int y = top; y < bottom; ++y)
+        {
+            for (int x = left; x < right; ++x)
+            {
+                const sf::Vector2f center{x + 0.5f, y + 0.5f};
+                const float weightA = edgeFunction(b.position, c.position, center);
+                const float weightB = edgeFunction(c.position, a.position, center);
+                const float weightC = edgeFunction(a.position, b.position, center);
+                if (!isCovered(weightA, b.position, c.position) || !isCovered(weightB, c.position, a.position) || !isCovered(weightC, a.position, b.position))
+                    continue;
+
+                auto interpolate = [&](float valueA, float valueB, float valueC) {
+                    return (valueA * weightA + valueB * weightB + valueC * weightC) / area;
+                };
+
+                auto interpolateChannel = [&](sf::Uint8 valueA, sf::Uint8 valueB, sf::Uint8 valueC) {
+                    return static_cast<sf::Uint8>(std::max(0.f, std::min(255.f, interpolate(valueA, valueB, valueC) + 0.5f)));
+                };
+
+                const sf::Color color{interpolateChannel(a.color.r, b.color.r, c.color.r),
+                                      interpolateChannel(a.color.g, b.color.g, c.color.g),
+                                      interpolateChannel(a.color.b, b.color.b, c.color.b),
+                                      interpolateChannel(a.color.a, b.color.a, c.color.a)};
+                const sf::Vector2f texCoords{interpolate(a.texCoords.x, b.texCoords.x, c.texCoords.x),
+                                             interpolate(a.texCoords.y, b.texCoords.y, c.texCoords.y)};
+
+                blend(static_cast<unsigned int>(x), static_cast<unsigned int>(y), shader(shaderData, color, texCoords));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderBackend::blend(unsigned int x, unsigned int y, sf::Color color)
+    {
+        // Same blending as sf::BlendAlpha
+        sf::Uint8* pixel = &m_pixels[(y * m_size.x + x) * 4];
+        const sf::Uint8 inverseAlpha = 255 - color.a;
+        pixel[0] = static_cast<sf::Uint8>(multiply(color.r, color.a) + multiply(pixel[0], inverseAlpha));
+        pixel[1] = static_cast<sf::Uint8>(multiply(color.g, color.a) + multiply(pixel[1], inverseAlpha));
+        pixel[2] = static_cast<sf::Uint8>(multiply(color.b, color.a) + multiply(pixel[2], inverseAlpha));
+        pixel[3] = static_cast<sf::Uint8>(color.a + multiply(pixel[3], inverseAlpha));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
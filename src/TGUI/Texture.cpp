@@ -25,10 +25,11 @@
 
 #include <TGUI/Texture.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/Clipping.hpp>
 
-#include <SFML/OpenGL.hpp>
-
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -64,12 +65,14 @@ namespace tgui
         sf::Transformable {copy},
         sf::Drawable      {copy},
         m_data            (copy.m_data),
-        m_vertices        (copy.m_vertices), // Did not compile in VS2013 when using braces
+        m_geometry        (copy.m_geometry),
         m_size            {copy.m_size},
         m_middleRect      {copy.m_middleRect},
         m_textureRect     {copy.m_textureRect},
         m_vertexColor     {copy.m_vertexColor},
         m_scalingType     {copy.m_scalingType},
+        m_pixelMappingX   (copy.m_pixelMappingX),
+        m_pixelMappingY   (copy.m_pixelMappingY),
         m_loaded          {copy.m_loaded},
         m_id              (copy.m_id), // Did not compile in VS2013 when using braces
         m_copyCallback    {copy.m_copyCallback},
@@ -98,12 +101,14 @@ namespace tgui
             sf::Drawable::operator=(right);
 
             std::swap(m_data,             temp.m_data);
-            std::swap(m_vertices,         temp.m_vertices);
+            std::swap(m_geometry,         temp.m_geometry);
             std::swap(m_size,             temp.m_size);
             std::swap(m_middleRect,       temp.m_middleRect);
             std::swap(m_textureRect,      temp.m_textureRect);
             std::swap(m_vertexColor,      temp.m_vertexColor);
             std::swap(m_scalingType,      temp.m_scalingType);
+            std::swap(m_pixelMappingX,    temp.m_pixelMappingX);
+            std::swap(m_pixelMappingY,    temp.m_pixelMappingY);
             std::swap(m_loaded,           temp.m_loaded);
             std::swap(m_id,               temp.m_id);
             std::swap(m_copyCallback,     temp.m_copyCallback);
@@ -138,11 +143,11 @@ namespace tgui
         m_loaded = false;
 
         auto data = std::make_shared<TextureData>();
-
+        data->setImage(std::make_shared<sf::Image>(texture.copyToImage()), partRect);
         if (partRect == sf::IntRect{})
-            data->texture = texture;
-        else
-            data->texture.loadFromImage(texture.copyToImage(), partRect);
+            data->setTexture(texture);
+
+        priv::createTransparentPixelMask(*data);
 
         m_id = "";
         setTexture(data, middleRect);
@@ -159,11 +164,11 @@ namespace tgui
         m_loaded = true;
 
         if (middleRect == sf::IntRect{})
-            m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+            m_middleRect = {0, 0, static_cast<int>(m_data->size.x), static_cast<int>(m_data->size.y)};
         else
             m_middleRect = middleRect;
 
-        setSize(sf::Vector2f{m_data->texture.getSize()});
+        setSize(sf::Vector2f{m_data->size});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -205,8 +210,6 @@ namespace tgui
     void Texture::setColor(const sf::Color& color)
     {
         m_vertexColor = color;
-        for (auto& vertex : m_vertices)
-            vertex.color = color;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,101 +224,25 @@ namespace tgui
     void Texture::setSmooth(bool smooth)
     {
         if (m_loaded)
-            m_data->texture.setSmooth(smooth);
+            m_data->setSmooth(smooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Texture::isTransparentPixel(float x, float y) const
     {
-        if (!m_data->image || (m_size.x == 0) || (m_size.y == 0))
+        // The mask is created when loading the texture, data that was created in another way has no transparent pixels
+        const sf::Vector2u textureSize = m_data->size;
+        if ((m_data->transparentPixels.size() != textureSize.x * textureSize.y) || (m_size.x == 0) || (m_size.y == 0))
             return false;
 
         assert((x >= getPosition().x) && (y >= getPosition().y) && (x < getPosition().x + getSize().x) && (y < getPosition().y + getSize().y));
-        x -= getPosition().x;
-        y -= getPosition().y;
 
         // Find out on which pixel the mouse is standing
-        sf::Vector2u pixel;
-        switch (m_scalingType)
-        {
-            case ScalingType::Normal:
-            {
-                pixel.x = static_cast<unsigned int>(x / m_size.x * m_data->texture.getSize().x);
-                pixel.y = static_cast<unsigned int>(y / m_size.y * m_data->texture.getSize().y);
-                break;
-            }
-            case ScalingType::Horizontal:
-            {
-                if (x >= m_size.x - (m_data->texture.getSize().x - m_middleRect.left - m_middleRect.width) * (m_size.y / m_data->texture.getSize().y))
-                {
-                    float xDiff = (x - (m_size.x - (m_data->texture.getSize().x - m_middleRect.left - m_middleRect.width) * (m_size.y / m_data->texture.getSize().y)));
-                    pixel.x = static_cast<unsigned int>(m_middleRect.left + m_middleRect.width + (xDiff / m_size.y * m_data->texture.getSize().y));
-                }
-                else if (x >= m_middleRect.left * (m_size.y / m_data->texture.getSize().y))
-                {
-                    float xDiff = x - (m_middleRect.left * (m_size.y / m_data->texture.getSize().y));
-                    pixel.x = static_cast<unsigned int>(m_middleRect.left + (xDiff / (m_size.x - ((m_data->texture.getSize().x - m_middleRect.width) * (m_size.y / m_data->texture.getSize().y))) * m_middleRect.width));
-                }
-                else // Mouse on the left part
-                {
-                    pixel.x = static_cast<unsigned int>(x / m_size.y * m_data->texture.getSize().y);
-                }
-
-                pixel.y = static_cast<unsigned int>(y / m_size.y * m_data->texture.getSize().y);
-                break;
-            }
-            case ScalingType::Vertical:
-            {
-                if (y >= m_size.y - (m_data->texture.getSize().y - m_middleRect.top - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x))
-                {
-                    float yDiff = (y - (m_size.y - (m_data->texture.getSize().y - m_middleRect.top - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x)));
-                    pixel.y = static_cast<unsigned int>(m_middleRect.top + m_middleRect.height + (yDiff / m_size.x * m_data->texture.getSize().x));
-                }
-                else if (y >= m_middleRect.top * (m_size.x / m_data->texture.getSize().x))
-                {
-                    float yDiff = y - (m_middleRect.top * (m_size.x / m_data->texture.getSize().x));
-                    pixel.y = static_cast<unsigned int>(m_middleRect.top + (yDiff / (m_size.y - ((m_data->texture.getSize().y - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x))) * m_middleRect.height));
-                }
-                else // Mouse on the top part
-                {
-                    pixel.y = static_cast<unsigned int>(y / m_size.x * m_data->texture.getSize().x);
-                }
-
-                pixel.x = static_cast<unsigned int>(x / m_size.x * m_data->texture.getSize().x);
-                break;
-            }
-            case ScalingType::NineSlice:
-            {
-                if (x < m_middleRect.left)
-                    pixel.x = static_cast<unsigned int>(x);
-                else if (x >= m_size.x - (m_data->texture.getSize().x - m_middleRect.width - m_middleRect.left))
-                    pixel.x = static_cast<unsigned int>(x - m_size.x + m_data->texture.getSize().x);
-                else
-                {
-                    float xDiff = (x - m_middleRect.left) / (m_size.x - (m_data->texture.getSize().x - m_middleRect.width)) * m_middleRect.width;
-                    pixel.x = static_cast<unsigned int>(m_middleRect.left + xDiff);
-                }
-
-                if (y < m_middleRect.top)
-                    pixel.y = static_cast<unsigned int>(y);
-                else if (y >= m_size.y - (m_data->texture.getSize().y - m_middleRect.height - m_middleRect.top))
-                    pixel.y = static_cast<unsigned int>(y - m_size.y + m_data->texture.getSize().y);
-                else
-                {
-                    float yDiff = (y - m_middleRect.top) / (m_size.y - (m_data->texture.getSize().y - m_middleRect.height)) * m_middleRect.height;
-                    pixel.y = static_cast<unsigned int>(m_middleRect.top + yDiff);
-                }
-
-                break;
-            }
-        };
+        const sf::Vector2u pixel{m_pixelMappingX.map(x - getPosition().x), m_pixelMappingY.map(y - getPosition().y)};
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
-        if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
-            return true;
-        else
-            return false;
+        assert(pixel.x < textureSize.x && pixel.y < textureSize.y);
+        return m_data->transparentPixels[pixel.y * textureSize.x + pixel.x];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,135 +294,215 @@ namespace tgui
     void Texture::updateVertices()
     {
         // Figure out how the image is scaled best
-        if (m_middleRect == sf::IntRect(0, 0, m_data->texture.getSize().x, m_data->texture.getSize().y))
+        if (m_middleRect == sf::IntRect(0, 0, m_data->size.x, m_data->size.y))
         {
             m_scalingType = ScalingType::Normal;
         }
-        else if (m_middleRect.height == static_cast<int>(m_data->texture.getSize().y))
+        else if (m_middleRect.height == static_cast<int>(m_data->size.y))
         {
-            if (m_size.x >= (m_data->texture.getSize().x - m_middleRect.width) * (m_size.y / m_data->texture.getSize().y))
+            if (m_size.x >= (m_data->size.x - m_middleRect.width) * (m_size.y / m_data->size.y))
                 m_scalingType = ScalingType::Horizontal;
             else
                 m_scalingType = ScalingType::Normal;
         }
-        else if (m_middleRect.width == static_cast<int>(m_data->texture.getSize().x))
+        else if (m_middleRect.width == static_cast<int>(m_data->size.x))
         {
-            if (m_size.y >= (m_data->texture.getSize().y - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x))
+            if (m_size.y >= (m_data->size.y - m_middleRect.height) * (m_size.x / m_data->size.x))
                 m_scalingType = ScalingType::Vertical;
             else
                 m_scalingType = ScalingType::Normal;
         }
         else
         {
-            if (m_size.x >= m_data->texture.getSize().x - m_middleRect.width)
+            if (m_size.x >= m_data->size.x - m_middleRect.width)
             {
-                if (m_size.y >= m_data->texture.getSize().y - m_middleRect.height)
+                if (m_size.y >= m_data->size.y - m_middleRect.height)
                     m_scalingType = ScalingType::NineSlice;
                 else
                     m_scalingType = ScalingType::Horizontal;
             }
-            else if (m_size.y >= (m_data->texture.getSize().y - m_middleRect.height) * (m_size.x / m_data->texture.getSize().x))
+            else if (m_size.y >= (m_data->size.y - m_middleRect.height) * (m_size.x / m_data->size.x))
                 m_scalingType = ScalingType::Vertical;
             else
                 m_scalingType = ScalingType::Normal;
         }
 
-        sf::Vector2f textureSize{m_data->texture.getSize()};
-        sf::FloatRect middleRect{m_middleRect};
+        calculateGeometry();
+        updatePixelMapping();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Calculate the vertices based on the way we are scaling
+    void Texture::calculateGeometry()
+    {
+        // Each vertex is a combination of one of the four positions on the horizontal axis and one on the vertical axis
+        static const unsigned char normalIndices[4][2] = {{0,0}, {3,0}, {0,3}, {3,3}};
+        static const unsigned char horizontalIndices[8][2] = {{0,0}, {0,3}, {1,0}, {1,3}, {2,0}, {2,3}, {3,0}, {3,3}};
+        static const unsigned char verticalIndices[8][2] = {{0,0}, {3,0}, {0,1}, {3,1}, {0,2}, {3,2}, {0,3}, {3,3}};
+        static const unsigned char nineSliceIndices[22][2] = {{0,0}, {1,0}, {0,1}, {1,1}, {0,2}, {1,2}, {0,3}, {1,3}, {2,3}, {1,2}, {2,2},
+                                                               {1,1}, {2,1}, {1,0}, {2,0}, {3,0}, {2,1}, {3,1}, {2,2}, {3,2}, {2,3}, {3,3}};
+
+        const sf::Vector2f textureSize{m_data->size};
+        const sf::FloatRect middleRect{m_middleRect};
+
+        // The texture coordinates of the parts are always the same, only the positions depend on the way we are scaling
+        const float texCoordsX[4] = {0, middleRect.left, middleRect.left + middleRect.width, textureSize.x};
+        const float texCoordsY[4] = {0, middleRect.top, middleRect.top + middleRect.height, textureSize.y};
+        float positionsX[4] = {0, 0, 0, m_size.x};
+        float positionsY[4] = {0, 0, 0, m_size.y};
+
+        const unsigned char (*indices)[2] = normalIndices;
         switch (m_scalingType)
         {
-        case ScalingType::Normal:
-            ///////////
-            // 0---1 //
-            // |   | //
-            // 2---3 //
-            ///////////
-            m_vertices.resize(4);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[3] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
-            break;
-
-        case ScalingType::Horizontal:
-            ///////////////////////
-            // 0---2-------4---6 //
-            // |   |       |   | //
-            // 1---3-------5---7 //
-            ///////////////////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[2] = {{middleRect.left * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[3] = {{middleRect.left * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[4] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[5] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[6] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
-            break;
-
-        case ScalingType::Vertical:
-            ///////////
-            // 0---1 //
-            // |   | //
-            // 2---3 //
-            // |   | //
-            // |   | //
-            // |   | //
-            // 4---5 //
-            // |   | //
-            // 6---7-//
-            ///////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{m_size.x, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
-            break;
-
-        case ScalingType::NineSlice:
-            //////////////////////////////////
-            // 0---1/13-----------14-----15 //
-            // |    |              |     |  //
-            // 2---3/11----------12/16---17 //
-            // |    |              |     |  //
-            // |    |              |     |  //
-            // |    |              |     |  //
-            // 4---5/9-----------10/18---19 //
-            // |    |              |     |  //
-            // 6----7-------------8/20---21 //
-            //////////////////////////////////
-            m_vertices.resize(22);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{middleRect.left, 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[2] = {{0, middleRect.top}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{middleRect.left, middleRect.top}, m_vertexColor, {middleRect.left, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{middleRect.left, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{middleRect.left, m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[8] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[9] = m_vertices[5];
-            m_vertices[10] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
-            m_vertices[11] = m_vertices[3];
-            m_vertices[12] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
-            m_vertices[13] = m_vertices[1];
-            m_vertices[14] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[15] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[16] = m_vertices[12];
-            m_vertices[17] = {{m_size.x, middleRect.top}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[18] = m_vertices[10];
-            m_vertices[19] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[20] = m_vertices[8];
-            m_vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
-            break;
+            case ScalingType::Normal:
+            {
+                ///////////
+                // 0---1 //
+                // |   | //
+                // 2---3 //
+                ///////////
+                m_geometry.vertexCount = 4;
+                break;
+            }
+            case ScalingType::Horizontal:
+            {
+                ///////////////////////
+                // 0---2-------4---6 //
+                // |   |       |   | //
+                // 1---3-------5---7 //
+                ///////////////////////
+                positionsX[1] = middleRect.left * (m_size.y / textureSize.y);
+                positionsX[2] = m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y);
+                indices = horizontalIndices;
+                m_geometry.vertexCount = 8;
+                break;
+            }
+            case ScalingType::Vertical:
+            {
+                ///////////
+                // 0---1 //
+                // |   | //
+                // 2---3 //
+                // |   | //
+                // |   | //
+                // |   | //
+                // 4---5 //
+                // |   | //
+                // 6---7-//
+                ///////////
+                positionsY[1] = middleRect.top * (m_size.x / textureSize.x);
+                positionsY[2] = m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x);
+                indices = verticalIndices;
+                m_geometry.vertexCount = 8;
+                break;
+            }
+            case ScalingType::NineSlice:
+            {
+                //////////////////////////////////
+                // 0---1/13-----------14-----15 //
+                // |    |              |     |  //
+                // 2---3/11----------12/16---17 //
+                // |    |              |     |  //
+                // |    |              |     |  //
+                // |    |              |     |  //
+                // 4---5/9-----------10/18---19 //
+                // |    |              |     |  //
+                // 6----7-------------8/20---21 //
+                //////////////////////////////////
+                positionsX[1] = middleRect.left;
+                positionsX[2] = m_size.x - (textureSize.x - middleRect.left - middleRect.width);
+                positionsY[1] = middleRect.top;
+                positionsY[2] = m_size.y - (textureSize.y - middleRect.top - middleRect.height);
+                indices = nineSliceIndices;
+                m_geometry.vertexCount = 22;
+                break;
+            }
         };
+
+        for (std::size_t i = 0; i < m_geometry.vertexCount; ++i)
+        {
+            m_geometry.positions[i] = {positionsX[indices[i][0]], positionsY[indices[i][1]]};
+            m_geometry.texCoords[i] = {texCoordsX[indices[i][0]], texCoordsY[indices[i][1]]};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Texture::updatePixelMapping()
+    {
+        const sf::Vector2u textureSize = m_data->size;
+        const float noSplit = std::numeric_limits<float>::infinity();
+
+        // The axis of which the image is not split is stretched over the whole length
+        const PixelMapping::Part stretchedX{0, 0, m_size.x, static_cast<float>(textureSize.x)};
+        const PixelMapping::Part stretchedY{0, 0, m_size.y, static_cast<float>(textureSize.y)};
+
+        // Horizontally the left and right parts keep their ratio, which depends on the height (and vice versa for vertically)
+        const PixelMapping::Part ratioX{0, 0, m_size.y, static_cast<float>(textureSize.y)};
+        const PixelMapping::Part ratioY{0, 0, m_size.x, static_cast<float>(textureSize.x)};
+
+        // The sides of a nine-slice image are not scaled at all
+        const PixelMapping::Part unscaled{0, 0, 1, 1};
+
+        switch (m_scalingType)
+        {
+            case ScalingType::Normal:
+            {
+                m_pixelMappingX = {noSplit, noSplit, {stretchedX, stretchedX, stretchedX}};
+                m_pixelMappingY = {noSplit, noSplit, {stretchedY, stretchedY, stretchedY}};
+                break;
+            }
+            case ScalingType::Horizontal:
+            {
+                const float middleStart = m_middleRect.left * (m_size.y / textureSize.y);
+                const float endStart = m_size.x - (textureSize.x - m_middleRect.left - m_middleRect.width) * (m_size.y / textureSize.y);
+
+                m_pixelMappingX = {middleStart, endStart, {
+                    ratioX,
+                    {middleStart, static_cast<float>(m_middleRect.left), m_size.x - ((textureSize.x - m_middleRect.width) * (m_size.y / textureSize.y)), static_cast<float>(m_middleRect.width)},
+                    {endStart, static_cast<float>(m_middleRect.left + m_middleRect.width), m_size.y, static_cast<float>(textureSize.y)}}};
+                m_pixelMappingY = {noSplit, noSplit, {stretchedY, stretchedY, stretchedY}};
+                break;
+            }
+            case ScalingType::Vertical:
+            {
+                const float middleStart = m_middleRect.top * (m_size.x / textureSize.x);
+                const float endStart = m_size.y - (textureSize.y - m_middleRect.top - m_middleRect.height) * (m_size.x / textureSize.x);
+
+                m_pixelMappingX = {noSplit, noSplit, {stretchedX, stretchedX, stretchedX}};
+                m_pixelMappingY = {middleStart, endStart, {
+                    ratioY,
+                    {middleStart, static_cast<float>(m_middleRect.top), m_size.y - ((textureSize.y - m_middleRect.height) * (m_size.x / textureSize.x)), static_cast<float>(m_middleRect.height)},
+                    {endStart, static_cast<float>(m_middleRect.top + m_middleRect.height), m_size.x, static_cast<float>(textureSize.x)}}};
+                break;
+            }
+            case ScalingType::NineSlice:
+            {
+                // The left and top parts take priority when they overlap with the right and bottom parts
+                const float middleStartX = static_cast<float>(m_middleRect.left);
+                const float middleStartY = static_cast<float>(m_middleRect.top);
+                const float endStartX = std::max(middleStartX, m_size.x - (textureSize.x - m_middleRect.width - m_middleRect.left));
+                const float endStartY = std::max(middleStartY, m_size.y - (textureSize.y - m_middleRect.height - m_middleRect.top));
+
+                m_pixelMappingX = {middleStartX, endStartX, {
+                    unscaled,
+                    {middleStartX, middleStartX, m_size.x - (textureSize.x - m_middleRect.width), static_cast<float>(m_middleRect.width)},
+                    {m_size.x, static_cast<float>(textureSize.x), 1, 1}}};
+                m_pixelMappingY = {middleStartY, endStartY, {
+                    unscaled,
+                    {middleStartY, middleStartY, m_size.y - (textureSize.y - m_middleRect.height), static_cast<float>(m_middleRect.height)},
+                    {m_size.y, static_cast<float>(textureSize.y), 1, 1}}};
+                break;
+            }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Texture::PixelMapping::map(float position) const
+    {
+        const Part& part = (position >= endStart) ? parts[2] : ((position >= middleStart) ? parts[1] : parts[0]);
+        return static_cast<unsigned int>(part.offset + (position - part.start) / part.divisor * part.multiplier);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -515,50 +522,109 @@ namespace tgui
 
         if (m_loaded)
         {
+            // The color is only added to the vertices here, so that the positions can be shared with other textures
+            sf::Vertex vertices[priv::TextureGeometry::MaxVertices];
+            for (std::size_t i = 0; i < m_geometry.vertexCount; ++i)
+                vertices[i] = {m_geometry.positions[i], m_vertexColor, m_geometry.texCoords[i]};
+
             if (m_textureRect == sf::FloatRect(0, 0, 0, 0))
             {
-                states.texture = &m_data->texture;
-                target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                states.texture = &m_data->getTexture();
+                target.draw(vertices, m_geometry.vertexCount, sf::PrimitiveType::TrianglesStrip, states);
             }
             else
             {
-                const sf::View& view = target.getView();
-
-                // Calculate the scale factor of the view
-                float scaleViewX = target.getSize().x / view.getSize().x;
-                float scaleViewY = target.getSize().y / view.getSize().y;
-
-                // Get the global position
-                sf::Vector2f topLeftPosition = states.transform.transformPoint(((m_textureRect.left - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width) + (view.getSize().x * view.getViewport().left),
-                                                                               ((m_textureRect.top - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height) + (view.getSize().y * view.getViewport().top));
-                sf::Vector2f bottomRightPosition = states.transform.transformPoint((m_textureRect.left + m_textureRect.width - view.getCenter().x + (view.getSize().x / 2.f)) * view.getViewport().width + (view.getSize().x * view.getViewport().left),
-                                                                                   (m_textureRect.top + m_textureRect.height - view.getCenter().y + (view.getSize().y / 2.f)) * view.getViewport().height + (view.getSize().y * view.getViewport().top));
-
-                // Get the old clipping area
-                GLint scissor[4];
-                glGetIntegerv(GL_SCISSOR_BOX, scissor);
-
-                // Calculate the clipping area
-                GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x * scaleViewX), scissor[0]);
-                GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1] - scissor[3]);
-                GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x * scaleViewX), scissor[0] + scissor[2]);
-                GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y * scaleViewY), static_cast<GLint>(target.getSize().y) - scissor[1]);
-
-                // If the object outside the window then don't draw anything
-                if (scissorRight < scissorLeft)
-                    scissorRight = scissorLeft;
-                else if (scissorBottom < scissorTop)
-                    scissorTop = scissorBottom;
-
-                // Set the clipping area
-                glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-
-                // Draw the texture
-                states.texture = &m_data->texture;
-                target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
-
-                // Reset the old clipping area
-                glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                // Only draw the part of the texture that lies inside the texture rect
+                Clipping clipping{target, states, {m_textureRect.left, m_textureRect.top}, {m_textureRect.width, m_textureRect.height}};
+
+                states.texture = &m_data->getTexture();
+                target.draw(vertices, m_geometry.vertexCount, sf::PrimitiveType::TrianglesStrip, states);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureData::setImage(std::shared_ptr<sf::Image> newImage, const sf::IntRect& partRect)
+    {
+        image = newImage;
+        rect = partRect;
+
+        // The whole image is used when the rect is empty, otherwise only the part of the rect that lies inside the image
+        const sf::Vector2u imageSize = image->getSize();
+        if ((partRect.width == 0) || (partRect.height == 0))
+            size = imageSize;
+        else
+        {
+            const int left = std::max(partRect.left, 0);
+            const int top = std::max(partRect.top, 0);
+            const int right = std::min(partRect.left + partRect.width, static_cast<int>(imageSize.x));
+            const int bottom = std::min(partRect.top + partRect.height, static_cast<int>(imageSize.y));
+            size = {static_cast<unsigned int>(std::max(right - left, 0)), static_cast<unsigned int>(std::max(bottom - top, 0))};
+        }
+
+        return (size.x > 0) && (size.y > 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Texture& TextureData::getTexture() const
+    {
+        std::lock_guard<std::mutex> lock{m_textureMutex};
+        if (!m_textureCreated && image)
+        {
+            m_texture.loadFromImage(*image, rect);
+            m_texture.setSmooth(m_smooth);
+            m_textureCreated = true;
+        }
+
+        return m_texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureData::setTexture(const sf::Texture& texture)
+    {
+        std::lock_guard<std::mutex> lock{m_textureMutex};
+        m_texture = texture;
+        m_smooth = texture.isSmooth();
+        m_textureCreated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureData::setSmooth(bool smooth)
+    {
+        std::lock_guard<std::mutex> lock{m_textureMutex};
+        m_smooth = smooth;
+        if (m_textureCreated)
+            m_texture.setSmooth(smooth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureData::isSmooth() const
+    {
+        std::lock_guard<std::mutex> lock{m_textureMutex};
+        return m_smooth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void priv::createTransparentPixelMask(TextureData& data)
+    {
+        data.transparentPixels.clear();
+        if (!data.image)
+            return;
+
+        const sf::Vector2u textureSize = data.size;
+        data.transparentPixels.resize(textureSize.x * textureSize.y);
+        for (unsigned int pixelY = 0; pixelY < textureSize.y; ++pixelY)
+        {
+            for (unsigned int pixelX = 0; pixelX < textureSize.x; ++pixelX)
+            {
+                data.transparentPixels[pixelY * textureSize.x + pixelX]
+                    = (data.image->getPixel(pixelX + data.rect.left, pixelY + data.rect.top).a == 0);
             }
         }
     }
@@ -26,79 +26,107 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/Context.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-namespace tgui
+namespace
 {
-    std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    // Lets the texture use the data of an image that was already loaded with the exact same part rect
+    bool shareLoadedTexture(std::map<std::string, std::list<tgui::TextureDataHolder>>& imageMap, tgui::Texture& texture,
+                            const std::string& filename, const sf::IntRect& partRect)
+    {
+        auto imageIt = imageMap.find(filename);
+        if (imageIt == imageMap.end())
+            return false;
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        for (auto& dataHolder : imageIt->second)
+        {
+            if (dataHolder.data->rect == partRect)
+            {
+                // The texture is now used at multiple places
+                ++dataHolder.users;
+
+                texture.getData() = dataHolder.data;
+
+                // Let the texture alert the texture manager when it is being copied or destroyed
+                texture.setCopyCallback(&tgui::TextureManager::copyTexture);
+                texture.setDestructCallback(&tgui::TextureManager::removeTexture);
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
     bool TextureManager::getTexture(Texture& texture, const std::string& filename, const sf::IntRect& partRect)
     {
-        // Look if we already had this image
-        auto imageIt = m_imageMap.find(filename);
-        if (imageIt != m_imageMap.end())
+        Context& context = Context::getGlobal();
+
+        std::shared_ptr<sf::Image> image;
         {
-            // Loop all our textures to find the one containing the image
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
-            {
-                // Only reuse the texture when the exact same part of the image is used
-                if (dataIt->data->rect == partRect)
-                {
-                    // The texture is now used at multiple places
-                    ++(dataIt->users);
+            std::lock_guard<std::mutex> lock{context.m_textureMutex};
 
-                    texture.getData() = dataIt->data;
+            // Look if we already had this image
+            if (shareLoadedTexture(context.m_imageMap, texture, filename, partRect))
+                return true;
 
-                    // Let the texture alert the texture manager when it is being copied or destroyed
-                    texture.setCopyCallback(&TextureManager::copyTexture);
-                    texture.setDestructCallback(&TextureManager::removeTexture);
-                    return true;
-                }
-            }
+            auto preloadedIt = context.m_preloadedImages.find(filename);
+            if (preloadedIt != context.m_preloadedImages.end())
+                image = preloadedIt->second.first;
         }
-        else // The image doesn't exist yet
+
+        // The file is read and the texture is created without holding the lock, so that other threads can keep using
+        // the texture manager in the meantime
+        if (!image)
         {
-            auto it = m_imageMap.insert({filename, {}});
-            imageIt = it.first;
+            image = texture.getImageLoader()(filename);
+            if (!image)
+                return false;
         }
 
-        // Add new data to the list
-        TextureDataHolder data;
-        data.filename = filename;
-        data.users = 1;
-        data.data = texture.getData();
-        data.data->rect = partRect;
-        imageIt->second.push_back(std::move(data));
+        // Only the image is needed until the texture is drawn with OpenGL for the first time
+        auto data = std::make_shared<TextureData>();
+        if (!data->setImage(image, partRect))
+            return false;
+
+        priv::createTransparentPixelMask(*data);
+
+        std::lock_guard<std::mutex> lock{context.m_textureMutex};
+
+        // Another thread may have loaded the same image while the lock was released, the texture is shared in that case
+        if (shareLoadedTexture(context.m_imageMap, texture, filename, partRect))
+            return true;
+
+        TextureDataHolder dataHolder;
+        dataHolder.filename = filename;
+        dataHolder.users = 1;
+        dataHolder.data = data;
+        context.m_imageMap[filename].push_back(std::move(dataHolder));
+
+        texture.getData() = data;
 
         // Let the texture alert the texture manager when it is being copied or destroyed
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
-
-        // Load the image
-        texture.getData()->image = texture.getImageLoader()(filename);
-        if (texture.getData()->image != nullptr)
-        {
-            // Create a texture from the image
-            if (partRect == sf::IntRect{})
-                return texture.getData()->texture.loadFromImage(*texture.getData()->image);
-            else
-                return texture.getData()->texture.loadFromImage(*texture.getData()->image, partRect);
-        }
-
-        // The image could not be loaded
-        m_imageMap.erase(imageIt);
-        return false;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_textureMutex};
+        auto& imageMap = context.m_imageMap;
+
         // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        for (auto& dataHolder : imageMap)
         {
             for (auto& data : dataHolder.second)
             {
@@ -119,8 +147,12 @@ namespace tgui
 
     void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
     {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_textureMutex};
+        auto& imageMap = context.m_imageMap;
+
         // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        for (auto imageIt = imageMap.begin(); imageIt != imageMap.end(); ++imageIt)
         {
             for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
             {
@@ -132,7 +164,7 @@ namespace tgui
                     {
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
+                            imageMap.erase(imageIt);
                     }
 
                     return;
@@ -144,6 +176,30 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::addPreloadedImage(const std::string& filename, std::shared_ptr<sf::Image> image)
+    {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_textureMutex};
+
+        auto& preloadedImage = context.m_preloadedImages[filename];
+        preloadedImage.first = image;
+        preloadedImage.second++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removePreloadedImage(const std::string& filename)
+    {
+        Context& context = Context::getGlobal();
+        std::lock_guard<std::mutex> lock{context.m_textureMutex};
+
+        auto it = context.m_preloadedImages.find(filename);
+        if ((it != context.m_preloadedImages.end()) && (--it->second.second == 0))
+            context.m_preloadedImages.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,14 +37,14 @@ namespace tgui
         Layout2d position = {other.getPosition()};
         Layout2d size = {other.getSize()};
 
-        if (other.m_position.x.getImpl()->operation == LayoutImpl::Operation::String)
+        if (other.m_position.x.isStringExpression())
             position.x = other.m_position.x.getImpl()->stringExpression;
-        if (other.m_position.y.getImpl()->operation == LayoutImpl::Operation::String)
+        if (other.m_position.y.isStringExpression())
             position.y = other.m_position.y.getImpl()->stringExpression;
 
-        if (other.m_size.x.getImpl()->operation == LayoutImpl::Operation::String)
+        if (other.m_size.x.isStringExpression())
             size.x = other.m_size.x.getImpl()->stringExpression;
-        if (other.m_size.y.getImpl()->operation == LayoutImpl::Operation::String)
+        if (other.m_size.y.isStringExpression())
             size.y = other.m_size.y.getImpl()->stringExpression;
 
         setPosition(position);
@@ -75,8 +75,8 @@ namespace tgui
         m_position = position;
         m_prevPosition = m_position.getValue();
 
-        m_position.x.connectUpdateCallback(std::bind(&Transformable::updatePosition, this, false));
-        m_position.y.connectUpdateCallback(std::bind(&Transformable::updatePosition, this, false));
+        m_position.x.connectUpdateCallback([this]{ updatePosition(false); });
+        m_position.y.connectUpdateCallback([this]{ updatePosition(false); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,8 +100,8 @@ namespace tgui
         m_size = size;
         m_prevSize = m_size.getValue();
 
-        m_size.x.connectUpdateCallback(std::bind(&Transformable::updateSize, this, false));
-        m_size.y.connectUpdateCallback(std::bind(&Transformable::updateSize, this, false));
+        m_size.x.connectUpdateCallback([this]{ updateSize(false); });
+        m_size.y.connectUpdateCallback([this]{ updateSize(false); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/UpdatePool.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+namespace priv
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    UpdatePool::UpdatePool(unsigned int threadCount) :
+        m_nextTask(0)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        // The calling thread also executes tasks, so one thread less has to be created
+        for (unsigned int i = 1; i < threadCount; ++i)
+            m_threads.emplace_back(&UpdatePool::workerLoop, this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    UpdatePool::~UpdatePool()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stopping = true;
+        }
+
+        m_startCondition.notify_all();
+        for (auto& thread : m_threads)
+            thread.join();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int UpdatePool::getThreadCount() const
+    {
+        return static_cast<unsigned int>(m_threads.size() + 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void UpdatePool::run(std::size_t taskCount, const std::function<void(std::size_t)>& task)
+    {
+        if (taskCount == 0)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_task = &task;
+            m_taskCount = taskCount;
+            m_nextTask = 0;
+            m_busyWorkers = static_cast<unsigned int>(m_threads.size());
+            m_exception = nullptr;
+            m_generation++;
+        }
+
+        m_startCondition.notify_all();
+
+        executeTasks();
+
+        std::exception_ptr exception;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_finishedCondition.wait(lock, [this]{ return m_busyWorkers == 0; });
+
+            m_task = nullptr;
+            exception = m_exception;
+            m_exception = nullptr;
+        }
+
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void UpdatePool::workerLoop()
+    {
+        unsigned int generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                m_startCondition.wait(lock, [this,generation]{ return m_stopping || (m_generation != generation); });
+
+                if (m_stopping)
+                    return;
+
+                generation = m_generation;
+            }
+
+            executeTasks();
+
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                m_busyWorkers--;
+            }
+
+            m_finishedCondition.notify_one();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void UpdatePool::executeTasks()
+    {
+        std::size_t index;
+        while ((index = m_nextTask++) < m_taskCount)
+        {
+            try
+            {
+                (*m_task)(index);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                if (!m_exception)
+                    m_exception = std::current_exception();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,13 +27,40 @@
 #include <TGUI/Widgets/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 #include <cassert>
+#include <mutex>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace
 {
+    // Names of the widget types, in the same order as the WidgetType enum
+    const std::string& getWidgetTypeName(tgui::WidgetType type)
+    {
+        static const std::string names[] = {
+            "Unknown", "Button", "Canvas", "ChatBox", "CheckBox", "ChildWindow", "ClickableWidget", "ComboBox", "EditBox",
+            "FlexLayout", "Grid", "GuiContainer", "HorizontalLayout", "Knob", "Label", "ListBox", "MenuBar", "MessageBox",
+            "Panel", "Picture", "ProgressBar", "RadioButton", "RichTextLabel", "Scrollbar", "Slider", "SpinButton", "Tab",
+            "Table", "TableItem", "TableRow", "TextBox", "VerticalLayout"
+        };
+
+        assert(static_cast<std::size_t>(type) < sizeof(names) / sizeof(names[0]));
+        return names[static_cast<std::size_t>(type)];
+    }
+
+    // Custom widget types are stored only once, no matter how many widgets of that type exist
+    const std::string& getCustomWidgetTypeName(const std::string& type)
+    {
+        static std::mutex mutex;
+        static std::set<std::string> names;
+
+        std::lock_guard<std::mutex> lock{mutex};
+        return *names.insert(type).first;
+    }
+
     void addAnimation(std::vector<std::shared_ptr<tgui::priv::Animation>>& existingAnimations, std::shared_ptr<tgui::priv::Animation> newAnimation)
     {
         auto type = newAnimation->getType();
@@ -61,9 +88,9 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Widget::Widget()
+    Widget::Widget() :
+        m_widgetType{&getWidgetTypeName(WidgetType::Unknown)}
     {
-        m_callback.widget = this;
 
         addSignal<sf::Vector2f>("PositionChanged");
         addSignal<sf::Vector2f>("SizeChanged");
@@ -79,14 +106,10 @@ namespace tgui
     {
         detachTheme();
 
-        if (m_position.x.getImpl()->parentWidget == this)
-            m_position.x.getImpl()->parentWidget = nullptr;
-        if (m_position.y.getImpl()->parentWidget == this)
-            m_position.y.getImpl()->parentWidget = nullptr;
-        if (m_size.x.getImpl()->parentWidget == this)
-            m_size.x.getImpl()->parentWidget = nullptr;
-        if (m_size.y.getImpl()->parentWidget == this)
-            m_size.y.getImpl()->parentWidget = nullptr;
+        m_position.x.detachFromWidget(this);
+        m_position.y.detachFromWidget(this);
+        m_size.x.detachFromWidget(this);
+        m_size.y.detachFromWidget(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,6 +122,8 @@ namespace tgui
         m_disabledBlockingMouseEvents  {copy.m_disabledBlockingMouseEvents},
         m_enabled        {copy.m_enabled},
         m_visible        {copy.m_visible},
+        m_widgetTypeId   {copy.m_widgetTypeId},
+        m_widgetType     {copy.m_widgetType},
         m_parent         {nullptr},
         m_opacity        {copy.m_opacity},
         m_mouseHover     {false},
@@ -109,8 +134,8 @@ namespace tgui
         m_containerWidget{copy.m_containerWidget},
         m_font           {copy.m_font}
     {
-        m_callback.widget = this;
-        m_callback.widgetType = copy.m_callback.widgetType;
+        if (m_callback)
+            m_callback->widget = this;
 
         if (copy.m_toolTip != nullptr)
             m_toolTip = copy.m_toolTip->clone();
@@ -118,17 +143,10 @@ namespace tgui
         if (copy.m_renderer != nullptr)
             m_renderer = copy.m_renderer->clone(this);
 
-        m_position.x.getImpl()->parentWidget = this;
-        m_position.x.getImpl()->recalculate();
-
-        m_position.y.getImpl()->parentWidget = this;
-        m_position.y.getImpl()->recalculate();
-
-        m_size.x.getImpl()->parentWidget = this;
-        m_size.x.getImpl()->recalculate();
-
-        m_size.y.getImpl()->parentWidget = this;
-        m_size.y.getImpl()->recalculate();
+        m_position.x.attachToWidget(this);
+        m_position.y.attachToWidget(this);
+        m_size.x.attachToWidget(this);
+        m_size.y.attachToWidget(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,6 +163,8 @@ namespace tgui
             m_disabledBlockingMouseEvents = right.m_disabledBlockingMouseEvents;
             m_enabled             = right.m_enabled;
             m_visible             = right.m_visible;
+            m_widgetTypeId        = right.m_widgetTypeId;
+            m_widgetType          = right.m_widgetType;
             m_parent              = nullptr;
             m_opacity             = right.m_opacity;
             m_mouseHover          = false;
@@ -154,8 +174,9 @@ namespace tgui
             m_draggableWidget     = right.m_draggableWidget;
             m_containerWidget     = right.m_containerWidget;
             m_font                = right.m_font;
-            m_callback.widget     = this;
-            m_callback.widgetType = right.m_callback.widgetType;
+
+            if (m_callback)
+                m_callback->widget = this;
 
             if (right.m_toolTip != nullptr)
                 m_toolTip = right.m_toolTip->clone();
@@ -170,17 +191,10 @@ namespace tgui
             // Animations can't be copied
             m_showAnimations = {};
 
-            m_position.x.getImpl()->parentWidget = this;
-            m_position.x.getImpl()->recalculate();
-
-            m_position.y.getImpl()->parentWidget = this;
-            m_position.y.getImpl()->recalculate();
-
-            m_size.x.getImpl()->parentWidget = this;
-            m_size.x.getImpl()->recalculate();
-
-            m_size.y.getImpl()->parentWidget = this;
-            m_size.y.getImpl()->recalculate();
+            m_position.x.attachToWidget(this);
+            m_position.y.attachToWidget(this);
+            m_size.x.attachToWidget(this);
+            m_size.y.attachToWidget(this);
         }
 
         return *this;
@@ -190,20 +204,14 @@ namespace tgui
 
     void Widget::setPosition(const Layout2d& position)
     {
-        if (position.x.getImpl()->parentWidget != this)
-        {
-            position.x.getImpl()->parentWidget = this;
-            position.x.getImpl()->recalculate();
-        }
-        if (position.y.getImpl()->parentWidget != this)
-        {
-            position.y.getImpl()->parentWidget = this;
-            position.y.getImpl()->recalculate();
-        }
+        position.x.attachToWidget(this);
+        position.y.attachToWidget(this);
 
         Transformable::setPosition(position);
 
-        m_callback.position = getPosition();
+        if (m_callback)
+            m_callback->position = getPosition();
+
         sendSignal("PositionChanged", getPosition());
     }
 
@@ -211,20 +219,14 @@ namespace tgui
 
     void Widget::setSize(const Layout2d& size)
     {
-        if (size.x.getImpl()->parentWidget != this)
-        {
-            size.x.getImpl()->parentWidget = this;
-            size.x.getImpl()->recalculate();
-        }
-        if (size.y.getImpl()->parentWidget != this)
-        {
-            size.y.getImpl()->parentWidget = this;
-            size.y.getImpl()->recalculate();
-        }
+        size.x.attachToWidget(this);
+        size.y.attachToWidget(this);
 
         Transformable::setSize(size);
 
-        m_callback.size = getSize();
+        if (m_callback)
+            m_callback->size = getSize();
+
         sendSignal("SizeChanged", getSize());
     }
 
@@ -481,10 +483,10 @@ namespace tgui
         m_parent = parent;
         if (m_parent)
         {
-            m_position.x.getImpl()->recalculate();
-            m_position.y.getImpl()->recalculate();
-            m_size.x.getImpl()->recalculate();
-            m_size.y.getImpl()->recalculate();
+            m_position.x.recalculate();
+            m_position.y.recalculate();
+            m_size.x.recalculate();
+            m_size.y.recalculate();
         }
     }
 
@@ -586,6 +588,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        commands.addWidget(transform, *this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::drawRenderCommands(sf::RenderTarget& target, const sf::RenderStates& states) const
+    {
+        RenderCommandList::ScratchList commands;
+        emitRenderCommands(commands.get(), states.transform);
+        SfmlRenderBackend{target}.render(commands.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::attachTheme(std::shared_ptr<BaseTheme> theme)
     {
         detachTheme();
@@ -626,6 +644,44 @@ namespace tgui
         return m_disabledBlockingMouseEvents;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::setWidgetType(WidgetType type)
+    {
+        m_widgetTypeId = type;
+        m_widgetType = &getWidgetTypeName(type);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::setWidgetType(const std::string& type)
+    {
+        m_widgetTypeId = WidgetType::Unknown;
+        m_widgetType = &getCustomWidgetTypeName(type);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::createCallback()
+    {
+        SignalWidgetBase::createCallback();
+
+        m_callback->widget = this;
+        m_callback->widgetType = *m_widgetType;
+        m_callback->position = getPosition();
+        m_callback->size = getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<priv::DelayedSignalQueue> Widget::getDelayedSignalQueue() const
+    {
+        if (m_parent)
+            return m_parent->getDelayedSignalQueue();
+        else
+            return SignalWidgetBase::getDelayedSignalQueue();
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -26,6 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -35,7 +36,7 @@ namespace tgui
 
     Button::Button()
     {
-        m_callback.widgetType = "Button";
+        setWidgetType(WidgetType::Button);
 
         addSignal<sf::String>("Pressed");
 
@@ -124,7 +125,8 @@ namespace tgui
     void Button::setText(const sf::String& text)
     {
         m_string = text;
-        m_callback.text = text;
+        if (m_callback)
+            m_callback->text = text;
 
         // Set the text size when the text has a fixed size
         if (m_textSize != 0)
@@ -288,6 +290,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Button::createCallback()
+    {
+        ClickableWidget::createCallback();
+        m_callback->text = m_string;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Button::mouseEnteredWidget()
     {
         Widget::mouseEnteredWidget();
@@ -309,13 +319,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Button::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void Button::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Draw the background of the button
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
         // If the button has a text then also draw the text
-        target.draw(m_text, states);
+        m_text.emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Button::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -609,7 +626,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ButtonRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ButtonRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         // Check if there is a background texture
         if (m_textureNormal.isLoaded())
@@ -617,18 +634,18 @@ namespace tgui
             if (m_button->m_mouseHover)
             {
                 if (m_button->m_mouseDown && m_textureDown.isLoaded())
-                    target.draw(m_textureDown, states);
+                    commands.addTexture(transform, m_textureDown);
                 else if (m_textureHover.isLoaded())
-                    target.draw(m_textureHover, states);
+                    commands.addTexture(transform, m_textureHover);
                 else
-                    target.draw(m_textureNormal, states);
+                    commands.addTexture(transform, m_textureNormal);
             }
             else
-                target.draw(m_textureNormal, states);
+                commands.addTexture(transform, m_textureNormal);
 
             // When the edit box is focused then draw an extra image
             if (m_button->m_focused && m_textureFocused.isLoaded())
-                target.draw(m_textureFocused, states);
+                commands.addTexture(transform, m_textureFocused);
         }
         else // There is no background texture
         {
@@ -645,7 +662,7 @@ namespace tgui
             else
                 button.setFillColor(calcColorOpacity(m_backgroundColorNormal, m_button->getOpacity()));
 
-            target.draw(button, states);
+            commands.addShape(transform, button);
         }
 
         // Draw the borders around the button
@@ -658,22 +675,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_button->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
     }
 
@@ -33,7 +33,7 @@ namespace tgui
 
     Canvas::Canvas(const Layout2d& size)
     {
-        m_callback.widgetType = "Canvas";
+        setWidgetType(WidgetType::Canvas);
 
         setSize(size);
     }
@@ -27,7 +27,8 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Loading/Theme.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 #include <cassert>
 #include <cmath>
@@ -40,7 +41,7 @@ namespace tgui
 
     ChatBox::ChatBox()
     {
-        m_callback.widgetType = "ChatBox";
+        setWidgetType(WidgetType::ChatBox);
         m_draggableWidget = true;
 
         m_renderer = std::make_shared<ChatBoxRenderer>(this);
@@ -60,8 +61,11 @@ namespace tgui
         m_linesStartFromTop  {chatBoxToCopy.m_linesStartFromTop},
         m_newLinesBelowOthers{chatBoxToCopy.m_newLinesBelowOthers},
         m_scroll             {Scrollbar::copy(chatBoxToCopy.m_scroll)},
-        m_lines              (chatBoxToCopy.m_lines) // Did not compile in VS2013 when using braces
+        m_lines              (chatBoxToCopy.m_lines), // Did not compile in VS2013 when using braces
+        m_firstMaterializedLine{chatBoxToCopy.m_firstMaterializedLine}
     {
+        if (chatBoxToCopy.m_scrollback)
+            m_scrollback = std::unique_ptr<priv::ScrollbackBuffer>(new priv::ScrollbackBuffer{*chatBoxToCopy.m_scrollback});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +85,8 @@ namespace tgui
             std::swap(m_newLinesBelowOthers, temp.m_newLinesBelowOthers);
             std::swap(m_scroll,              temp.m_scroll);
             std::swap(m_lines,               temp.m_lines);
+            std::swap(m_scrollback,          temp.m_scrollback);
+            std::swap(m_firstMaterializedLine, temp.m_firstMaterializedLine);
         }
 
         return *this;
@@ -148,9 +154,9 @@ namespace tgui
     void ChatBox::addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font)
     {
         // Remove the oldest line if you exceed the maximum
-        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
+        if ((m_maxLines > 0) && (m_maxLines == getLineAmount()))
         {
-            if (m_newLinesBelowOthers)
+            if (m_newLinesBelowOthers || m_scrollback)
                 removeLine(0);
             else
                 removeLine(m_maxLines-1);
@@ -175,7 +181,10 @@ namespace tgui
 
         recalculateLineText(line);
 
-        if (m_newLinesBelowOthers)
+        // With the scrollback buffer the line is only kept in its compact form, it is recreated when it becomes visible
+        if (m_scrollback)
+            m_scrollback->append(text, color, textSize, line.font, getLineHeight(line));
+        else if (m_newLinesBelowOthers)
             m_lines.push_back(std::move(line));
         else
             m_lines.push_front(std::move(line));
@@ -188,6 +197,9 @@ namespace tgui
 
     sf::String ChatBox::getLine(std::size_t lineIndex) const
     {
+        if (m_scrollback)
+            return (lineIndex < m_scrollback->getLineCount()) ? m_scrollback->getText(lineIndex) : "";
+
         if (lineIndex < m_lines.size())
         {
             return m_lines[lineIndex].string;
@@ -200,6 +212,9 @@ namespace tgui
 
     sf::Color ChatBox::getLineColor(std::size_t lineIndex) const
     {
+        if (m_scrollback)
+            return (lineIndex < m_scrollback->getLineCount()) ? m_scrollback->getColor(lineIndex) : m_textColor;
+
         if (lineIndex < m_lines.size())
         {
             return m_lines[lineIndex].text.getColor();
@@ -212,6 +227,9 @@ namespace tgui
 
     unsigned int ChatBox::getLineTextSize(std::size_t lineIndex) const
     {
+        if (m_scrollback)
+            return (lineIndex < m_scrollback->getLineCount()) ? m_scrollback->getTextSize(lineIndex) : m_textSize;
+
         if (lineIndex < m_lines.size())
         {
             return m_lines[lineIndex].text.getCharacterSize();
@@ -224,6 +242,9 @@ namespace tgui
 
     std::shared_ptr<sf::Font> ChatBox::getLineFont(std::size_t lineIndex) const
     {
+        if (m_scrollback)
+            return (lineIndex < m_scrollback->getLineCount()) ? m_scrollback->getFont(lineIndex) : getFont();
+
         if (lineIndex < m_lines.size())
         {
             return m_lines[lineIndex].font;
@@ -236,9 +257,20 @@ namespace tgui
 
     bool ChatBox::removeLine(std::size_t lineIndex)
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < getLineAmount())
         {
-            m_lines.erase(m_lines.begin() + lineIndex);
+            if (m_scrollback)
+            {
+                m_scrollback->remove(lineIndex);
+
+                // The lines that were already created remain valid, only their indices change
+                if (lineIndex < m_firstMaterializedLine)
+                    m_firstMaterializedLine--;
+                else if (lineIndex < m_firstMaterializedLine + m_lines.size())
+                    m_lines.erase(m_lines.begin() + (lineIndex - m_firstMaterializedLine));
+            }
+            else
+                m_lines.erase(m_lines.begin() + lineIndex);
 
             recalculateFullTextHeight();
             updateDisplayedText();
@@ -253,6 +285,8 @@ namespace tgui
     void ChatBox::removeAllLines()
     {
         m_lines.clear();
+        if (m_scrollback)
+            m_scrollback->clear();
 
         recalculateFullTextHeight();
         updateDisplayedText();
@@ -262,7 +296,10 @@ namespace tgui
 
     std::size_t ChatBox::getLineAmount()
     {
-        return m_lines.size();
+        if (m_scrollback)
+            return m_scrollback->getLineCount();
+        else
+            return m_lines.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -272,9 +309,14 @@ namespace tgui
         m_maxLines = maxLines;
 
         // Remove the oldest lines if there are too many lines
-        if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
+        if ((m_maxLines > 0) && (m_maxLines < getLineAmount()))
         {
-            if (m_newLinesBelowOthers)
+            if (m_scrollback)
+            {
+                m_scrollback->remove(0, m_scrollback->getLineCount() - m_maxLines);
+                m_lines.clear();
+            }
+            else if (m_newLinesBelowOthers)
                 m_lines.erase(m_lines.begin(), m_lines.begin() + m_lines.size() - m_maxLines);
             else
                 m_lines.erase(m_lines.begin() + m_maxLines, m_lines.end());
@@ -293,11 +335,62 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::setScrollbackEnabled(bool enabled, bool spillToDisk)
+    {
+        if (enabled)
+        {
+            auto scrollback = std::unique_ptr<priv::ScrollbackBuffer>(new priv::ScrollbackBuffer{spillToDisk});
+            if (m_scrollback)
+            {
+                for (std::size_t i = 0; i < m_scrollback->getLineCount(); ++i)
+                {
+                    scrollback->append(m_scrollback->getText(i), m_scrollback->getColor(i), m_scrollback->getTextSize(i),
+                                       m_scrollback->getFont(i), m_scrollback->getHeight(i));
+                }
+            }
+            else
+            {
+                for (const auto& line : m_lines)
+                    scrollback->append(line.string, line.text.getColor(), line.text.getCharacterSize(), line.font, getLineHeight(line));
+            }
+
+            m_scrollback = std::move(scrollback);
+            m_lines.clear();
+        }
+        else if (m_scrollback)
+        {
+            auto scrollback = std::move(m_scrollback);
+
+            m_lines.clear();
+            for (std::size_t i = 0; i < scrollback->getLineCount(); ++i)
+                m_lines.push_back(materializeLine(*scrollback, i));
+        }
+
+        m_firstMaterializedLine = 0;
+
+        recalculateFullTextHeight();
+        updateDisplayedText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ChatBox::isScrollbackEnabled() const
+    {
+        return m_scrollback != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::setFont(const Font& font)
     {
         Widget::setFont(font);
 
-        if (font.getFont() != nullptr)
+        if ((font.getFont() != nullptr) && m_scrollback)
+        {
+            m_scrollback->replaceMissingFont(font.getFont());
+            recalculateAllLines();
+        }
+        else if (font.getFont() != nullptr)
         {
             // Look for lines that did not have a font yet and give them this font
             bool lineChanged = false;
@@ -477,6 +570,8 @@ namespace tgui
                 // If the value of the scrollbar has changed then update the text
                 if (oldValue != m_scroll->getValue())
                 {
+                    const float lineSpacing = priv::TextMetrics{getFont(), m_textSize}.getLineSpacing();
+
                     // Check if the scrollbar value was incremented (you have pressed on the down arrow)
                     if (m_scroll->getValue() == oldValue + 1)
                     {
@@ -484,7 +579,7 @@ namespace tgui
                         m_scroll->setValue(m_scroll->getValue()-1);
 
                         // Scroll down with the whole item height instead of with a single pixel
-                        m_scroll->setValue(static_cast<unsigned int>(m_scroll->getValue() + getFont()->getLineSpacing(m_textSize) - (std::fmod(m_scroll->getValue(), getFont()->getLineSpacing(m_textSize)))));
+                        m_scroll->setValue(static_cast<unsigned int>(m_scroll->getValue() + lineSpacing - (std::fmod(m_scroll->getValue(), lineSpacing))));
                     }
                     else if (m_scroll->getValue() == oldValue - 1) // Check if the scrollbar value was decremented (you have pressed on the up arrow)
                     {
@@ -492,10 +587,10 @@ namespace tgui
                         m_scroll->setValue(m_scroll->getValue()+1);
 
                         // Scroll up with the whole item height instead of with a single pixel
-                        if (std::fmod(m_scroll->getValue(), getFont()->getLineSpacing(m_textSize)) > 0)
-                            m_scroll->setValue(static_cast<unsigned int>(m_scroll->getValue() - std::fmod(m_scroll->getValue(), getFont()->getLineSpacing(m_textSize))));
+                        if (std::fmod(m_scroll->getValue(), lineSpacing) > 0)
+                            m_scroll->setValue(static_cast<unsigned int>(m_scroll->getValue() - std::fmod(m_scroll->getValue(), lineSpacing)));
                         else
-                            m_scroll->setValue(static_cast<unsigned int>(m_scroll->getValue() - getFont()->getLineSpacing(m_textSize)));
+                            m_scroll->setValue(static_cast<unsigned int>(m_scroll->getValue() - lineSpacing));
                     }
 
                     updateDisplayedText();
@@ -571,15 +666,17 @@ namespace tgui
         {
             if (m_scroll->getLowValue() < m_scroll->getMaximum())
             {
+                const float lineSpacing = priv::TextMetrics{getFont(), m_textSize}.getLineSpacing();
+
                 // Check if you are scrolling down
                 if (delta < 0)
                 {
                     // Scroll down
-                    m_scroll->setValue(static_cast<unsigned int>(m_scroll->getValue() + ((-delta) * getFont()->getLineSpacing(m_textSize))));
+                    m_scroll->setValue(static_cast<unsigned int>(m_scroll->getValue() + ((-delta) * lineSpacing)));
                 }
                 else // You are scrolling up
                 {
-                    unsigned int change = static_cast<unsigned int>(delta * getFont()->getLineSpacing(m_textSize));
+                    unsigned int change = static_cast<unsigned int>(delta * lineSpacing);
 
                     // Scroll up
                     if (change < m_scroll->getValue())
@@ -612,6 +709,7 @@ namespace tgui
         if (maxWidth < 0)
             return;
 
+        priv::TextMetrics metrics{line.font, line.text.getCharacterSize()};
         unsigned int index = 0;
         while (index < line.string.getSize())
         {
@@ -630,17 +728,17 @@ namespace tgui
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = static_cast<float>(line.font->getGlyph(' ', line.text.getCharacterSize(), false).textureRect.width) * 4;
+                    charWidth = metrics.getWidth(' ') * 4;
                 else
-                    charWidth = static_cast<float>(line.font->getGlyph(curChar, line.text.getCharacterSize(), false).textureRect.width);
+                    charWidth = metrics.getWidth(curChar);
 
-                float kerning = static_cast<float>(line.font->getKerning(prevChar, curChar, line.text.getCharacterSize()));
+                float kerning = metrics.getKerning(prevChar, curChar);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
                 {
                     if (curChar == '\t')
-                        width += (static_cast<float>(line.font->getGlyph(' ', line.text.getCharacterSize(), false).advance) * 4) + kerning;
+                        width += (metrics.getAdvance(' ') * 4) + kerning;
                     else
-                        width += static_cast<float>(line.font->getGlyph(curChar, line.text.getCharacterSize(), false).advance) + kerning;
+                        width += metrics.getAdvance(curChar) + kerning;
 
                     index++;
                 }
@@ -696,10 +794,88 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float ChatBox::getLineHeight(const Line& line) const
+    {
+        if (line.font)
+            return line.sublines * priv::TextMetrics{line.font, line.text.getCharacterSize()}.getLineSpacing();
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ChatBox::Line ChatBox::materializeLine(const priv::ScrollbackBuffer& scrollback, std::size_t lineIndex)
+    {
+        Line line;
+        line.string = scrollback.getText(lineIndex);
+        line.font = scrollback.getFont(lineIndex);
+        if (line.font == nullptr)
+            line.font = getFont();
+
+        sf::Color color = scrollback.getColor(lineIndex);
+        if (m_opacity < 1)
+            color.a = static_cast<sf::Uint8>(m_opacity * 255);
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        line.text.setFillColor(color);
+#else
+        line.text.setColor(color);
+#endif
+        line.text.setCharacterSize(scrollback.getTextSize(lineIndex));
+        if (line.font != nullptr)
+            line.text.setFont(*line.font);
+
+        recalculateLineText(line);
+        return line;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::materializeLines(std::size_t first, std::size_t end)
+    {
+        // Keep the lines that remain visible and only create the new ones
+        if ((end <= m_firstMaterializedLine) || (first >= m_firstMaterializedLine + m_lines.size()))
+        {
+            m_lines.clear();
+            m_firstMaterializedLine = first;
+        }
+
+        while (m_firstMaterializedLine < first)
+        {
+            m_lines.pop_front();
+            m_firstMaterializedLine++;
+        }
+
+        while (m_firstMaterializedLine + m_lines.size() > end)
+            m_lines.pop_back();
+
+        while (m_firstMaterializedLine > first)
+        {
+            m_firstMaterializedLine--;
+            m_lines.push_front(materializeLine(*m_scrollback, m_firstMaterializedLine));
+        }
+
+        while (m_firstMaterializedLine + m_lines.size() < end)
+            m_lines.push_back(materializeLine(*m_scrollback, m_firstMaterializedLine + m_lines.size()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::recalculateAllLines()
     {
-        for (auto& line : m_lines)
-            recalculateLineText(line);
+        if (m_scrollback)
+        {
+            // The heights of all lines have to be calculated again, but only the visible lines are kept
+            for (std::size_t i = 0; i < m_scrollback->getLineCount(); ++i)
+                m_scrollback->setHeight(i, getLineHeight(materializeLine(*m_scrollback, i)));
+
+            m_lines.clear();
+        }
+        else
+        {
+            for (auto& line : m_lines)
+                recalculateLineText(line);
+        }
 
         recalculateFullTextHeight();
         updateDisplayedText();
@@ -710,10 +886,12 @@ namespace tgui
     void ChatBox::recalculateFullTextHeight()
     {
         m_fullTextHeight = 0;
-        for (auto& line : m_lines)
+        if (m_scrollback)
+            m_fullTextHeight = m_scrollback->getTotalHeight();
+        else
         {
-            if (line.font)
-                m_fullTextHeight += line.sublines * line.font->getLineSpacing(line.text.getCharacterSize());
+            for (auto& line : m_lines)
+                m_fullTextHeight += getLineHeight(line);
         }
 
         // Set the maximum of the scrollbar when there is one
@@ -738,7 +916,7 @@ namespace tgui
 
     void ChatBox::updateDisplayedText()
     {
-        if (!m_lines.empty())
+        if (!m_lines.empty() || (m_scrollback && m_scrollback->getLineCount()))
         {
             Padding padding = getRenderer()->getScaledPadding();
 
@@ -757,13 +935,24 @@ namespace tgui
             if (!m_linesStartFromTop && (m_fullTextHeight < getSize().y - padding.top - padding.bottom))
                 pos.y += getSize().y - padding.top - padding.bottom - m_fullTextHeight;
 
+            // Only create the text of the lines that are visible when using the scrollback buffer
+            if (m_scrollback)
+            {
+                const float visibleHeight = getSize().y - padding.top - padding.bottom;
+                const std::size_t first = m_scrollback->findLine(padding.top - pos.y);
+                const std::size_t last = m_scrollback->findLine(padding.top + visibleHeight - pos.y);
+                materializeLines(first, std::min(last + 1, m_scrollback->getLineCount()));
+
+                pos.y += m_scrollback->getTopPosition(m_firstMaterializedLine);
+            }
+
             // Actually set the position for all the lines
             for (auto& line : m_lines)
             {
                 if (line.font)
                 {
                     line.text.setPosition(std::round(pos.x), std::floor(pos.y - getTextVerticalCorrection(line.font, line.text.getCharacterSize())));
-                    pos.y += line.sublines * line.font->getLineSpacing(line.text.getCharacterSize());
+                    pos.y += getLineHeight(line);
                 }
             }
         }
@@ -814,26 +1003,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ChatBox::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
-        states.transform.translate(getPosition());
+        transform.translate(getPosition());
 
         // Draw the background
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
         {
-            // Set the clipping for all draw calls that happen until this clipping object goes out of scope
+            // Clip the commands that follow to the inside of the padding
             Padding padding = getRenderer()->getScaledPadding();
-            Clipping clipping{target, states, {padding.left, padding.top}, {getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom}};
+            commands.pushClip(transform, {padding.left, padding.top, getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom});
 
             // Draw the text
             for (auto& line : m_lines)
-                target.draw(line.text, states);
+                commands.addText(transform, line.text, line.font);
+
+            commands.popClip();
         }
 
         // Draw the scrollbar if there is one
         if (m_scroll != nullptr)
-            target.draw(*m_scroll, states);
+            m_scroll->emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -994,15 +1192,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBoxRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ChatBoxRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         if (m_backgroundTexture.isLoaded())
-            target.draw(m_backgroundTexture, states);
+            commands.addTexture(transform, m_backgroundTexture);
         else
         {
             sf::RectangleShape background(m_chatBox->getSize());
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_chatBox->getOpacity()));
-            target.draw(background, states);
+            commands.addShape(transform, background);
         }
 
         if (m_borders != Borders{0, 0, 0, 0})
@@ -1014,22 +1212,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition({position.x - m_borders.left, position.y - m_borders.top});
             border.setFillColor(calcColorOpacity(m_borderColor, m_chatBox->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition({position.x, position.y - m_borders.top});
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition({position.x + size.x, position.y});
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition({position.x - m_borders.left, position.y + size.y});
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
     }
 
@@ -25,7 +25,7 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/CheckBox.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 #include <cmath>
 
@@ -37,7 +37,7 @@ namespace tgui
 
     CheckBox::CheckBox()
     {
-        m_callback.widgetType = "CheckBox";
+        setWidgetType(WidgetType::CheckBox);
 
         m_renderer = std::make_shared<CheckBoxRenderer>(this);
         reload();
@@ -75,7 +75,9 @@ namespace tgui
         {
             m_checked = true;
 
-            m_callback.checked = true;
+            if (m_callback)
+                m_callback->checked = true;
+
             sendSignal("Checked", m_checked);
         }
     }
@@ -88,7 +90,9 @@ namespace tgui
         {
             m_checked = false;
 
-            m_callback.checked = false;
+            if (m_callback)
+                m_callback->checked = false;
+
             sendSignal("Unchecked", m_checked);
         }
     }
@@ -129,28 +133,28 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CheckBoxRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void CheckBoxRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
         {
             if (m_radioButton->m_checked)
             {
                 if (m_radioButton->m_mouseHover && m_textureCheckedHover.isLoaded())
-                    target.draw(m_textureCheckedHover, states);
+                    commands.addTexture(transform, m_textureCheckedHover);
                 else
-                    target.draw(m_textureChecked, states);
+                    commands.addTexture(transform, m_textureChecked);
             }
             else
             {
                 if (m_radioButton->m_mouseHover && m_textureUncheckedHover.isLoaded())
-                    target.draw(m_textureUncheckedHover, states);
+                    commands.addTexture(transform, m_textureUncheckedHover);
                 else
-                    target.draw(m_textureUnchecked, states);
+                    commands.addTexture(transform, m_textureUnchecked);
             }
 
             // When the radio button is focused then draw an extra image
             if (m_radioButton->m_focused && m_textureFocused.isLoaded())
-                target.draw(m_textureFocused, states);
+                commands.addTexture(transform, m_textureFocused);
         }
         else // There are no images
         {
@@ -175,7 +179,7 @@ namespace tgui
                     rect.setOutlineColor(calcColorOpacity(m_backgroundColorNormal, m_radioButton->getOpacity()));
                 }
 
-                target.draw(rect, states);
+                commands.addShape(transform, rect);
             }
             else // Draw background and foreground separately
             {
@@ -193,19 +197,19 @@ namespace tgui
 
                     border.setSize({m_padding.left, size.y - m_padding.top});
                     border.setPosition(position.x, position.y + m_padding.top);
-                    target.draw(border, states);
+                    commands.addShape(transform, border);
 
                     border.setSize({size.x - m_padding.right, m_padding.top});
                     border.setPosition(position.x, position.y);
-                    target.draw(border, states);
+                    commands.addShape(transform, border);
 
                     border.setSize({m_padding.right, size.y - m_padding.bottom});
                     border.setPosition(position.x + size.x - m_padding.right, position.y);
-                    target.draw(border, states);
+                    commands.addShape(transform, border);
 
                     border.setSize({size.x - m_padding.left, m_padding.bottom});
                     border.setPosition(position.x + m_padding.left, position.y + size.y - m_padding.top);
-                    target.draw(border, states);
+                    commands.addShape(transform, border);
                 }
 
                 // Draw the foreground
@@ -218,7 +222,7 @@ namespace tgui
                     else
                         foreground.setFillColor(calcColorOpacity(m_foregroundColorNormal, m_radioButton->getOpacity()));
 
-                    target.draw(foreground, states);
+                    commands.addShape(transform, foreground);
                 }
             }
 
@@ -228,9 +232,9 @@ namespace tgui
                 sf::Vector2f position = m_radioButton->getPosition();
                 sf::Vector2f size = m_radioButton->getSize();
 
-                // Set the clipping for all draw calls that happen until this clipping object goes out of scope
+                // The check is clipped to the inside of the check box
                 Padding padding{m_padding.left + 1, m_padding.top + 1, m_padding.left + 1, m_padding.top + 1};
-                Clipping clipping{target, states, {position.x + padding.left, position.y + padding.top}, {size.x - padding.left - padding.right, size.y - padding.top - padding.bottom}};
+                commands.pushClip(transform, {position.x + padding.left, position.y + padding.top, size.x - padding.left - padding.right, size.y - padding.top - padding.bottom});
 
                 sf::Vector2f leftPoint = {position.x + padding.left, position.y + (size.y * 5/12)};
                 sf::Vector2f middlePoint = {position.x + (size.x / 2), position.y + size.y - padding.bottom};
@@ -257,8 +261,10 @@ namespace tgui
                     right.setFillColor(calcColorOpacity(m_checkColorNormal, m_radioButton->getOpacity()));
                 }
 
-                target.draw(left, states);
-                target.draw(right, states);
+                commands.addShape(transform, left);
+                commands.addShape(transform, right);
+
+                commands.popClip();
             }
         }
     }
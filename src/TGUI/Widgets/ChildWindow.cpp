@@ -25,7 +25,7 @@
 
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/Loading/Theme.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 #include <limits>
 
@@ -53,7 +53,7 @@ namespace tgui
 
     ChildWindow::ChildWindow()
     {
-        m_callback.widgetType = "ChildWindow";
+        setWidgetType(WidgetType::ChildWindow);
 
         addSignal<sf::Vector2f>("MousePressed");
         addSignal<ChildWindow::Ptr>("Closed");
@@ -451,8 +451,12 @@ namespace tgui
         // Move the child window to the front
         moveToFront();
 
-        m_callback.mouse.x = static_cast<int>(x - getPosition().x);
-        m_callback.mouse.y = static_cast<int>(y - getPosition().y);
+        if (m_callback)
+        {
+            m_callback->mouse.x = static_cast<int>(x - getPosition().x);
+            m_callback->mouse.y = static_cast<int>(y - getPosition().y);
+        }
+
         sendSignal("MousePressed", sf::Vector2f{x - getPosition().x, y - getPosition().y});
 
         // Check if the mouse is on top of the title bar
@@ -794,13 +798,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ChildWindow::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
         // Draw a window icon if one was set
         if (m_iconTexture.isLoaded())
-            target.draw(m_iconTexture, states);
+            commands.addTexture(transform, m_iconTexture);
 
         float buttonOffsetX = 0;
         for (const auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
@@ -822,29 +826,34 @@ namespace tgui
             if (m_iconTexture.isLoaded())
                 clippingTopLeft.x += getRenderer()->m_distanceToSide + m_iconTexture.getSize().x;
 
-            // Set the clipping for all draw calls that happen until this clipping object goes out of scope
-            Clipping clipping{target, states, clippingTopLeft, clippingBottomRight - clippingTopLeft};
-
             // Draw the text in the title bar
-            target.draw(m_titleText, states);
+            commands.pushClip(transform, {clippingTopLeft, clippingBottomRight - clippingTopLeft});
+            m_titleText.emitRenderCommands(commands, transform);
+            commands.popClip();
         }
 
 
-        states.transform.translate(getPosition().x + getRenderer()->m_borders.left, getPosition().y + getRenderer()->m_titleBarHeight + getRenderer()->m_borders.top);
+        transform.translate(getPosition().x + getRenderer()->m_borders.left, getPosition().y + getRenderer()->m_titleBarHeight + getRenderer()->m_borders.top);
 
         // Draw the background
         if (getRenderer()->m_backgroundColor != sf::Color::Transparent)
         {
             sf::RectangleShape background(getSize());
             background.setFillColor(calcColorOpacity(getRenderer()->m_backgroundColor, getOpacity()));
-            target.draw(background, states);
+            commands.addShape(transform, background);
         }
 
-        // Set the clipping for all draw calls that happen until this clipping object goes out of scope
-        Clipping clipping{target, states, {}, getSize()};
-
         // Draw the widgets in the child window
-        drawWidgetContainer(&target, states);
+        commands.pushClip(transform, {{}, getSize()});
+        emitWidgetContainerCommands(commands, transform);
+        commands.popClip();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChildWindow::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1227,28 +1236,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindowRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ChildWindowRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         // Draw the title bar
         if (m_textureTitleBar.isLoaded())
-            target.draw(m_textureTitleBar, states);
+            commands.addTexture(transform, m_textureTitleBar);
         else
         {
             sf::RectangleShape titleBar{{m_childWindow->getSize().x + m_borders.left + m_borders.right, m_titleBarHeight}};
             titleBar.setPosition({m_childWindow->getPosition().x, m_childWindow->getPosition().y});
             titleBar.setFillColor(calcColorOpacity(m_titleBarColor, m_childWindow->getOpacity()));
-            target.draw(titleBar, states);
+            commands.addShape(transform, titleBar);
         }
 
         // Draw the buttons
         if (m_childWindow->m_closeButton->isVisible())
-            target.draw(*m_childWindow->m_closeButton, states);
+            m_childWindow->m_closeButton->emitRenderCommands(commands, transform);
 
         if (m_childWindow->m_minimizeButton->isVisible())
-            target.draw(*m_childWindow->m_minimizeButton, states);
+            m_childWindow->m_minimizeButton->emitRenderCommands(commands, transform);
 
         if (m_childWindow->m_maximizeButton->isVisible())
-            target.draw(*m_childWindow->m_maximizeButton, states);
+            m_childWindow->m_maximizeButton->emitRenderCommands(commands, transform);
 
         // Draw the borders
         if (m_borders != Borders{0, 0, 0, 0})
@@ -1260,22 +1269,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x, position.y);
             border.setFillColor(calcColorOpacity(m_borderColor, m_childWindow->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x + m_borders.left, position.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x + m_borders.left, position.y + m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x, position.y + size.y + m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
     }
 
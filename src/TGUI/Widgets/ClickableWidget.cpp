@@ -33,7 +33,7 @@ namespace tgui
 
     ClickableWidget::ClickableWidget(const Layout2d& size)
     {
-        m_callback.widgetType = "ClickableWidget";
+        setWidgetType(WidgetType::ClickableWidget);
 
         addSignal<sf::Vector2f>("MousePressed");
         addSignal<sf::Vector2f>("MouseReleased");
@@ -81,8 +81,12 @@ namespace tgui
     {
         m_mouseDown = true;
 
-        m_callback.mouse.x = static_cast<int>(x - getPosition().x);
-        m_callback.mouse.y = static_cast<int>(y - getPosition().y);
+        if (m_callback)
+        {
+            m_callback->mouse.x = static_cast<int>(x - getPosition().x);
+            m_callback->mouse.y = static_cast<int>(y - getPosition().y);
+        }
+
         sendSignal("MousePressed", sf::Vector2f{x - getPosition().x, y - getPosition().y});
     }
 
@@ -90,8 +94,12 @@ namespace tgui
 
     void ClickableWidget::leftMouseReleased(float x, float y)
     {
-        m_callback.mouse.x = static_cast<int>(x - getPosition().x);
-        m_callback.mouse.y = static_cast<int>(y - getPosition().y);
+        if (m_callback)
+        {
+            m_callback->mouse.x = static_cast<int>(x - getPosition().x);
+            m_callback->mouse.y = static_cast<int>(y - getPosition().y);
+        }
+
         sendSignal("MouseReleased", sf::Vector2f{x - getPosition().x, y - getPosition().y});
 
         if (m_mouseDown)
@@ -100,6 +108,12 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ClickableWidget::emitRenderCommands(RenderCommandList&, sf::Transform) const
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ClickableWidget::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
@@ -26,7 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,7 +36,7 @@ namespace tgui
 
     ComboBox::ComboBox()
     {
-        m_callback.widgetType = "ComboBox";
+        setWidgetType(WidgetType::ComboBox);
         m_draggableWidget = true;
 
         addSignal<sf::String, TypeSet<sf::String, sf::String>>("ItemSelected");
@@ -599,8 +599,12 @@ namespace tgui
     {
         m_text.setText(m_listBox->getSelectedItem());
 
-        m_callback.text   = m_listBox->getSelectedItem();
-        m_callback.itemId = m_listBox->getSelectedItemId();
+        if (m_callback)
+        {
+            m_callback->text   = m_listBox->getSelectedItem();
+            m_callback->itemId = m_listBox->getSelectedItemId();
+        }
+
         sendSignal("ItemSelected", m_listBox->getSelectedItem(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
     }
 
@@ -614,10 +618,10 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ComboBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ComboBox::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Draw the background
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
         Padding padding = getRenderer()->getScaledPadding();
 
@@ -627,11 +631,20 @@ namespace tgui
         else
             arrowWidth = getSize().y - padding.top - padding.bottom;
 
-        // Set the clipping for all draw calls that happen until this clipping object goes out of scope
-        Clipping clipping{target, states, {getPosition().x + padding.left, getPosition().y + padding.top}, {getSize().x - padding.left - padding.right - arrowWidth, getSize().y - padding.top - padding.bottom}};
+        // Clip the selected item to the space between the padding and the arrow
+        commands.pushClip(transform, {getPosition().x + padding.left, getPosition().y + padding.top, getSize().x - padding.left - padding.right - arrowWidth, getSize().y - padding.top - padding.bottom});
 
         // Draw the selected item
-        target.draw(m_text, states);
+        m_text.emitRenderCommands(commands, transform);
+
+        commands.popClip();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1011,19 +1024,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ComboBoxRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ComboBoxRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         sf::Vector2f position = m_comboBox->getPosition();
         sf::Vector2f size = m_comboBox->getSize();
 
         if (m_backgroundTexture.isLoaded())
-            target.draw(m_backgroundTexture, states);
+            commands.addTexture(transform, m_backgroundTexture);
         else
         {
             sf::RectangleShape front(size);
             front.setPosition(position);
             front.setFillColor(calcColorOpacity(getListBox()->m_backgroundColor, m_comboBox->getOpacity()));
-            target.draw(front, states);
+            commands.addShape(transform, front);
         }
 
         // Draw the borders
@@ -1033,22 +1046,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(getListBox()->m_borderColor, m_comboBox->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
 
         // Check if we have textures for the arrow
@@ -1058,16 +1071,16 @@ namespace tgui
             if (m_comboBox->m_listBox->isVisible())
             {
                 if (m_comboBox->m_mouseHover && m_textureArrowUpHover.isLoaded())
-                    target.draw(m_textureArrowUpHover, states);
+                    commands.addTexture(transform, m_textureArrowUpHover);
                 else
-                    target.draw(m_textureArrowUpNormal, states);
+                    commands.addTexture(transform, m_textureArrowUpNormal);
             }
             else
             {
                 if (m_comboBox->m_mouseHover && m_textureArrowDownHover.isLoaded())
-                    target.draw(m_textureArrowDownHover, states);
+                    commands.addTexture(transform, m_textureArrowDownHover);
                 else
-                    target.draw(m_textureArrowDownNormal, states);
+                    commands.addTexture(transform, m_textureArrowDownNormal);
             }
         }
         else // There are no textures for the arrow
@@ -1103,8 +1116,8 @@ namespace tgui
                 arrowBackground.setFillColor(calcColorOpacity(m_arrowBackgroundColorNormal, m_comboBox->getOpacity()));
             }
 
-            target.draw(arrowBackground, states);
-            target.draw(arrow, states);
+            commands.addShape(transform, arrowBackground);
+            commands.addShape(transform, arrow);
         }
     }
 
@@ -27,9 +27,86 @@
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Clipboard.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/RenderBackend.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <map>
+#include <mutex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const char* const intValidator   = "[+-]?[0-9]*";
+    const char* const uintValidator  = "[0-9]*";
+    const char* const floatValidator = "[+-]?[0-9]*\\.?[0-9]*";
+
+    // Compiled regexes are shared between all edit boxes that use the same validator.
+    // The map only holds weak pointers, so a regex is destroyed when no edit box uses it anymore.
+    // Edit boxes in different guis may be created on different threads, so the map is protected by a mutex.
+    std::mutex compiledValidatorsMutex;
+    std::map<std::string, std::weak_ptr<const std::regex>> compiledValidators;
+
+    std::shared_ptr<const std::regex> getCompiledValidator(const std::string& regex)
+    {
+        std::lock_guard<std::mutex> lock{compiledValidatorsMutex};
+
+        auto it = compiledValidators.find(regex);
+        if (it != compiledValidators.end())
+        {
+            auto compiledRegex = it->second.lock();
+            if (compiledRegex)
+                return compiledRegex;
+        }
+
+        // Forget about the validators that are no longer used before adding a new one
+        for (auto mapIt = compiledValidators.begin(); mapIt != compiledValidators.end();)
+        {
+            if (mapIt->second.expired())
+                mapIt = compiledValidators.erase(mapIt);
+            else
+                ++mapIt;
+        }
+
+        auto compiledRegex = std::make_shared<const std::regex>(regex);
+        compiledValidators[regex] = compiledRegex;
+        return compiledRegex;
+    }
+
+    bool isDigit(sf::Uint32 character)
+    {
+        return (character >= '0') && (character <= '9');
+    }
+
+    bool isSign(sf::Uint32 character)
+    {
+        return (character == '+') || (character == '-');
+    }
+
+    // Checks the entire text against one of the built-in validators without creating a regex or copying the string
+    bool matchNumber(const sf::String& text, bool allowSign, bool allowDecimalPoint)
+    {
+        auto it = text.begin();
+        if (allowSign && (it != text.end()) && isSign(*it))
+            ++it;
+
+        bool decimalPointFound = false;
+        for (; it != text.end(); ++it)
+        {
+            if (isDigit(*it))
+                continue;
+
+            if (allowDecimalPoint && !decimalPointFound && (*it == '.'))
+                decimalPointFound = true;
+            else
+                return false;
+        }
+
+        return true;
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -37,15 +114,15 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::string EditBox::Validator::Int   = "[+-]?[0-9]*";
-    std::string EditBox::Validator::UInt  = "[0-9]*";
-    std::string EditBox::Validator::Float = "[+-]?[0-9]*\\.?[0-9]*";
+    std::string EditBox::Validator::Int   = intValidator;
+    std::string EditBox::Validator::UInt  = uintValidator;
+    std::string EditBox::Validator::Float = floatValidator;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     EditBox::EditBox()
     {
-        m_callback.widgetType = "EditBox";
+        setWidgetType(WidgetType::EditBox);
         m_draggableWidget = true;
         m_allowFocus = true;
 
@@ -164,12 +241,29 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
-            m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
-        else // Clear the text
-            m_text = "";
+        switch (m_validatorType)
+        {
+            case ValidatorType::Any:
+                m_text = text;
+                break;
+            case ValidatorType::Int:
+                m_text = matchNumber(text, true, false) ? text : "";
+                break;
+            case ValidatorType::UInt:
+                m_text = matchNumber(text, false, false) ? text : "";
+                break;
+            case ValidatorType::Float:
+                m_text = matchNumber(text, true, true) ? text : "";
+                break;
+            case ValidatorType::Regex:
+            {
+                if (std::regex_match(text.toAnsiString(), *m_regex))
+                    m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
+                else // Clear the text
+                    m_text = "";
+                break;
+            }
+        }
 
         m_displayedText = m_text;
 
@@ -201,7 +295,7 @@ namespace tgui
         if (m_limitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            while (m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x - m_textBeforeSelection.getPosition().x > width)
+            while (priv::findCharacterPos(m_textBeforeSelection, m_font, m_textBeforeSelection.getString().getSize()).x - m_textBeforeSelection.getPosition().x > width)
             {
                 // The text doesn't fit inside the EditBox, so the last character must be deleted.
                 m_text.erase(m_text.getSize()-1);
@@ -217,7 +311,7 @@ namespace tgui
         else // There is no text cropping
         {
             // Calculate the text width
-            float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+            float textWidth = priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x;
 
             // If the text can be moved to the right then do so
             if (textWidth > width)
@@ -229,6 +323,10 @@ namespace tgui
                 m_textCropPosition = 0;
         }
 
+        m_decimalPointPos = std::find(m_text.begin(), m_text.end(), '.') - m_text.begin();
+        if (m_decimalPointPos == m_text.getSize())
+            m_decimalPointPos = sf::String::InvalidPos;
+
         // Set the caret behind the last character
         setCaretPosition(m_displayedText.getSize());
     }
@@ -287,6 +385,7 @@ namespace tgui
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
             m_displayedText.erase(m_maxChars, sf::String::InvalidPos);
+            charactersErased(m_maxChars, sf::String::InvalidPos);
 
             // If we passed here then the text has changed.
             m_textBeforeSelection.setString(m_displayedText);
@@ -318,12 +417,13 @@ namespace tgui
         {
             // Now check if the text fits into the EditBox
             float width = getVisibleEditBoxWidth();
-            while (m_textBeforeSelection.findCharacterPos(m_displayedText.getSize()).x - m_textBeforeSelection.getPosition().x > width)
+            while (priv::findCharacterPos(m_textBeforeSelection, m_font, m_displayedText.getSize()).x - m_textBeforeSelection.getPosition().x > width)
             {
                 // The text doesn't fit inside the EditBox, so the last character must be deleted.
                 m_text.erase(m_text.getSize()-1);
                 m_displayedText.erase(m_displayedText.getSize()-1);
                 m_textBeforeSelection.setString(m_displayedText);
+                charactersErased(m_text.getSize(), 1);
             }
 
             // The full text might have changed
@@ -361,7 +461,7 @@ namespace tgui
         if (!m_limitTextWidth)
         {
             // Find out the position of the caret
-            float caretPosition = m_textFull.findCharacterPos(m_selEnd).x;
+            float caretPosition = priv::findCharacterPos(m_textFull, m_font, m_selEnd).x;
 
             if (m_selEnd == m_displayedText.getSize())
                 caretPosition += m_textFull.getCharacterSize() / 10.f;
@@ -398,7 +498,21 @@ namespace tgui
     void EditBox::setInputValidator(const std::string& regex)
     {
         m_regexString = regex;
-        m_regex = m_regexString;
+        m_regex = nullptr;
+
+        if (regex == ".*")
+            m_validatorType = ValidatorType::Any;
+        else if (regex == intValidator)
+            m_validatorType = ValidatorType::Int;
+        else if (regex == uintValidator)
+            m_validatorType = ValidatorType::UInt;
+        else if (regex == floatValidator)
+            m_validatorType = ValidatorType::Float;
+        else
+        {
+            m_regex = getCompiledValidator(regex);
+            m_validatorType = ValidatorType::Regex;
+        }
 
         setText(m_text);
     }
@@ -505,8 +619,12 @@ namespace tgui
 
         // Set the mouse down flag
         m_mouseDown = true;
-        m_callback.mouse.x = static_cast<int>(x - getPosition().x);
-        m_callback.mouse.y = static_cast<int>(y - getPosition().y);
+        if (m_callback)
+        {
+            m_callback->mouse.x = static_cast<int>(x - getPosition().x);
+            m_callback->mouse.y = static_cast<int>(y - getPosition().y);
+        }
+
         sendSignal("MousePressed", sf::Vector2f{x - getPosition().x, y - getPosition().y});
 
         recalculateTextPositions();
@@ -557,19 +675,19 @@ namespace tgui
                     }
                 }
                 // Check if the mouse is on the right of the text AND there is a possibility to scroll
-                else if ((x - getPosition().x > getRenderer()->getScaledPadding().left + width) && (m_textFull.findCharacterPos(m_displayedText.getSize()).x > width))
+                else if ((x - getPosition().x > getRenderer()->getScaledPadding().left + width) && (priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x > width))
                 {
                     // Move the text by a few pixels
                     if (m_textFull.getCharacterSize() > 10)
                     {
-                        if (m_textCropPosition + width < m_textFull.findCharacterPos(m_displayedText.getSize()).x + (m_textFull.getCharacterSize() / 10))
+                        if (m_textCropPosition + width < priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x + (m_textFull.getCharacterSize() / 10))
                             m_textCropPosition += static_cast<unsigned int>(std::floor(m_textFull.getCharacterSize() / 10.f + 0.5f));
                         else
-                            m_textCropPosition = static_cast<unsigned int>(m_textFull.findCharacterPos(m_displayedText.getSize()).x + (m_textFull.getCharacterSize() / 10) - width);
+                            m_textCropPosition = static_cast<unsigned int>(priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x + (m_textFull.getCharacterSize() / 10) - width);
                     }
                     else
                     {
-                        if (m_textCropPosition + width < m_textFull.findCharacterPos(m_displayedText.getSize()).x)
+                        if (m_textCropPosition + width < priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x)
                             ++m_textCropPosition;
                     }
                 }
@@ -695,7 +813,9 @@ namespace tgui
         }
         else if (event.code == sf::Keyboard::Return)
         {
-            m_callback.text = m_text;
+            if (m_callback)
+                m_callback->text = m_text;
+
             sendSignal("ReturnKeyPressed", getText());
         }
         else if (event.code == sf::Keyboard::BackSpace)
@@ -710,6 +830,7 @@ namespace tgui
                 // Erase the character
                 m_text.erase(m_selEnd-1, 1);
                 m_displayedText.erase(m_selEnd-1, 1);
+                charactersErased(m_selEnd-1, 1);
 
                 // Set the caret back on the correct position
                 setCaretPosition(m_selEnd - 1);
@@ -717,7 +838,7 @@ namespace tgui
                 float width = getVisibleEditBoxWidth();
 
                 // Calculate the text width
-                float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+                float textWidth = priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x;
 
                 // If the text can be moved to the right then do so
                 if (textWidth > width)
@@ -735,7 +856,9 @@ namespace tgui
             m_caretVisible = true;
             m_animationTimeElapsed = {};
 
-            m_callback.text = m_text;
+            if (m_callback)
+                m_callback->text = m_text;
+
             sendSignal("TextChanged", getText());
         }
         else if (event.code == sf::Keyboard::Delete)
@@ -750,12 +873,13 @@ namespace tgui
                 // Erase the character
                 m_text.erase(m_selEnd, 1);
                 m_displayedText.erase(m_selEnd, 1);
+                charactersErased(m_selEnd, 1);
 
                 // Set the caret back on the correct position
                 setCaretPosition(m_selEnd);
 
                 // Calculate the text width
-                float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+                float textWidth = priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x;
 
                 // If the text can be moved to the right then do so
                 float width = getVisibleEditBoxWidth();
@@ -774,7 +898,9 @@ namespace tgui
             m_caretVisible = true;
             m_animationTimeElapsed = {};
 
-            m_callback.text = m_text;
+            if (m_callback)
+                m_callback->text = m_text;
+
             sendSignal("TextChanged", getText());
         }
         else
@@ -804,7 +930,9 @@ namespace tgui
 
                         setCaretPosition(oldCaretPos + clipboardContents.getSize());
 
-                        m_callback.text = m_text;
+                        if (m_callback)
+                            m_callback->text = m_text;
+
                         sendSignal("TextChanged", getText());
                     }
                 }
@@ -813,7 +941,9 @@ namespace tgui
                     Clipboard::set(m_textSelection.getString());
                     deleteSelectedCharacters();
 
-                    m_callback.text = m_text;
+                    if (m_callback)
+                        m_callback->text = m_text;
+
                     sendSignal("TextChanged", getText());
                 }
                 else if (event.code == sf::Keyboard::A)
@@ -828,16 +958,9 @@ namespace tgui
 
     void EditBox::textEntered(sf::Uint32 key)
     {
-        // Only add the character when the regex matches
-        if (m_regexString != ".*")
-        {
-            sf::String text = m_text;
-            text.insert(m_selEnd, key);
-
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
-        }
+        // Only add the character when the validator accepts it
+        if (!isCharacterAccepted(key))
+            return;
 
         // If there are selected characters then delete them first
         if (m_selChars > 0)
@@ -863,7 +986,7 @@ namespace tgui
         if (m_limitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            if (m_textFull.findCharacterPos(m_displayedText.getSize()).x > getVisibleEditBoxWidth())
+            if (priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x > getVisibleEditBoxWidth())
             {
                 // If the text does not fit in the EditBox then delete the added character
                 m_text.erase(m_selEnd, 1);
@@ -872,6 +995,12 @@ namespace tgui
             }
         }
 
+        // Keep track of where the decimal point is
+        if (key == '.')
+            m_decimalPointPos = m_selEnd;
+        else if ((m_decimalPointPos != sf::String::InvalidPos) && (m_selEnd <= m_decimalPointPos))
+            ++m_decimalPointPos;
+
         // Move our caret forward
         setCaretPosition(m_selEnd + 1);
 
@@ -879,7 +1008,9 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        m_callback.text = m_text;
+        if (m_callback)
+            m_callback->text = m_text;
+
         sendSignal("TextChanged", getText());
     }
 
@@ -974,7 +1105,7 @@ namespace tgui
         if (m_textAlignment != Alignment::Left)
         {
             float editBoxWidth = getVisibleEditBoxWidth();
-            float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+            float textWidth = priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x;
 
             if (textWidth < editBoxWidth)
             {
@@ -988,8 +1119,7 @@ namespace tgui
 
         float width = 0;
         sf::Uint32 prevChar = 0;
-        unsigned int textSize = getTextSize();
-        bool bold = false; /// TODO: (getRenderer()->getTextStyle() & sf::Text::Bold) != 0;
+        priv::TextMetrics metrics{getFont(), getTextSize()}; /// TODO: Pass the bold style of the text
 
         std::size_t index;
         for (index = 0; index < m_text.getSize(); ++index)
@@ -999,11 +1129,11 @@ namespace tgui
             if (curChar == '\n')
                 width = 0; // This should not happen as edit box is for single line text, but lets try the next line anyway since we haven't found the position yet
             else if (curChar == '\t')
-                charWidth = static_cast<float>(getFont()->getGlyph(' ', textSize, bold).advance) * 4;
+                charWidth = metrics.getAdvance(' ') * 4;
             else
-                charWidth = static_cast<float>(getFont()->getGlyph(curChar, textSize, bold).advance);
+                charWidth = metrics.getAdvance(curChar);
 
-            float kerning = static_cast<float>(getFont()->getKerning(prevChar, curChar, textSize));
+            float kerning = metrics.getKerning(prevChar, curChar);
             if (width + charWidth < posX)
                 width += charWidth + kerning;
             else
@@ -1035,6 +1165,7 @@ namespace tgui
             // Erase the characters
             m_text.erase(m_selStart, m_selChars);
             m_displayedText.erase(m_selStart, m_selChars);
+            charactersErased(m_selStart, m_selChars);
 
             // Set the caret back on the correct position
             setCaretPosition(m_selStart);
@@ -1044,13 +1175,14 @@ namespace tgui
             // Erase the characters
             m_text.erase(m_selEnd, m_selChars);
             m_displayedText.erase(m_selEnd, m_selChars);
+            charactersErased(m_selEnd, m_selChars);
 
             // Set the caret back on the correct position
             setCaretPosition(m_selEnd);
         }
 
         // Calculate the text width
-        float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+        float textWidth = priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x;
 
         // If the text can be moved to the right then do so
         float width = getVisibleEditBoxWidth();
@@ -1065,6 +1197,60 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::charactersErased(std::size_t pos, std::size_t count)
+    {
+        if ((m_decimalPointPos == sf::String::InvalidPos) || (pos > m_decimalPointPos))
+            return;
+
+        if ((count == sf::String::InvalidPos) || (pos + count > m_decimalPointPos))
+            m_decimalPointPos = sf::String::InvalidPos;
+        else
+            m_decimalPointPos -= count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::isCharacterAccepted(sf::Uint32 key) const
+    {
+        // The text is always valid before inserting, so only the new character has to be checked
+        switch (m_validatorType)
+        {
+            case ValidatorType::Any:
+                return true;
+
+            case ValidatorType::UInt:
+                return isDigit(key);
+
+            case ValidatorType::Int:
+            case ValidatorType::Float:
+            {
+                // Nothing can be placed in front of the sign
+                if ((m_selEnd == 0) && !m_text.isEmpty() && isSign(m_text[0]))
+                    return false;
+
+                if (isDigit(key))
+                    return true;
+                else if (isSign(key))
+                    return (m_selEnd == 0);
+                else if (key == '.')
+                    return (m_validatorType == ValidatorType::Float) && (m_decimalPointPos == sf::String::InvalidPos);
+                else
+                    return false;
+            }
+
+            case ValidatorType::Regex:
+            {
+                sf::String text = m_text;
+                text.insert(m_selEnd, key);
+                return std::regex_match(text.toAnsiString(), *m_regex);
+            }
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::recalculateTextPositions()
     {
         Padding padding = getRenderer()->getScaledPadding();
@@ -1074,14 +1260,14 @@ namespace tgui
         if (getFont())
         {
             textY = std::round((getPosition().y + padding.top - getTextVerticalCorrection(getFont(), getTextSize()))
-                               + ((getSize().y - padding.bottom - padding.top) - getFont()->getLineSpacing(getTextSize())) / 2.f);
+                               + ((getSize().y - padding.bottom - padding.top) - priv::TextMetrics{getFont(), getTextSize()}.getLineSpacing()) / 2.f);
         }
 
         // Check if the layout wasn't left
         if (m_textAlignment != Alignment::Left)
         {
             // Calculate the text width
-            float textWidth = m_textFull.findCharacterPos(m_displayedText.getSize()).x;
+            float textWidth = priv::findCharacterPos(m_textFull, m_font, m_displayedText.getSize()).x;
 
             // Check if a layout would make sense
             if (textWidth < getVisibleEditBoxWidth())
@@ -1105,12 +1291,12 @@ namespace tgui
         {
             // Watch out for the kerning
             if (m_textBeforeSelection.getString().getSize() > 0)
-                textX += m_font->getKerning(m_displayedText[m_textBeforeSelection.getString().getSize() - 1], m_displayedText[m_textBeforeSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
+                textX += priv::TextMetrics{m_font, m_textBeforeSelection.getCharacterSize()}.getKerning(m_displayedText[m_textBeforeSelection.getString().getSize() - 1], m_displayedText[m_textBeforeSelection.getString().getSize()]);
 
-            textX += m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x - m_textBeforeSelection.getPosition().x;
+            textX += priv::findCharacterPos(m_textBeforeSelection, m_font, m_textBeforeSelection.getString().getSize()).x - m_textBeforeSelection.getPosition().x;
 
             // Set the position and size of the rectangle that gets drawn behind the selected text
-            m_selectedTextBackground.setSize({m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x - m_textSelection.getPosition().x,
+            m_selectedTextBackground.setSize({priv::findCharacterPos(m_textSelection, m_font, m_textSelection.getString().getSize()).x - m_textSelection.getPosition().x,
                                               getSize().y - padding.top - padding.bottom});
             m_selectedTextBackground.setPosition(std::floor(textX + 0.5f), std::floor(getPosition().y + padding.top + 0.5f));
 
@@ -1119,15 +1305,15 @@ namespace tgui
 
             // Watch out for kerning
             if (m_displayedText.getSize() > m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize())
-                textX += m_font->getKerning(m_displayedText[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize() - 1], m_displayedText[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
+                textX += priv::TextMetrics{m_font, m_textBeforeSelection.getCharacterSize()}.getKerning(m_displayedText[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize() - 1], m_displayedText[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize()]);
 
             // Set the text selected text on the correct position
-            textX += m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x  - m_textSelection.getPosition().x;
+            textX += priv::findCharacterPos(m_textSelection, m_font, m_textSelection.getString().getSize()).x  - m_textSelection.getPosition().x;
             m_textAfterSelection.setPosition(std::floor(textX + 0.5f), textY);
         }
 
         // Set the position of the caret
-        caretLeft += m_textFull.findCharacterPos(m_selEnd).x - (m_caret.getSize().x * 0.5f);
+        caretLeft += priv::findCharacterPos(m_textFull, m_font, m_selEnd).x - (m_caret.getSize().x * 0.5f);
         m_caret.setPosition(std::floor(caretLeft + 0.5f), std::floor(padding.top + getPosition().y + 0.5f));
     }
 
@@ -1153,35 +1339,44 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void EditBox::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Draw the background
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
-        // Set the clipping for all draw calls that happen until this clipping object goes out of scope
+        // Clip the commands that follow to the inside of the padding
         Padding padding = getRenderer()->getScaledPadding();
-        Clipping clipping{target, states, {getPosition().x + padding.left, getPosition().y + padding.top}, {getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom}};
+        commands.pushClip(transform, {getPosition().x + padding.left, getPosition().y + padding.top, getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom});
 
         if ((m_textBeforeSelection.getString() != "") || (m_textSelection.getString() != ""))
         {
-            target.draw(m_textBeforeSelection, states);
+            commands.addText(transform, m_textBeforeSelection, m_font);
 
             if (m_textSelection.getString() != "")
             {
-                target.draw(m_selectedTextBackground, states);
+                commands.addShape(transform, m_selectedTextBackground);
 
-                target.draw(m_textSelection, states);
-                target.draw(m_textAfterSelection, states);
+                commands.addText(transform, m_textSelection, m_font);
+                commands.addText(transform, m_textAfterSelection, m_font);
             }
         }
         else if (m_defaultText.getString() != "")
         {
-            target.draw(m_defaultText, states);
+            commands.addText(transform, m_defaultText, m_font);
         }
 
         // Draw the caret
         if ((m_focused) && (m_caretVisible))
-            target.draw(m_caret, states);
+            commands.addShape(transform, m_caret);
+
+        commands.popClip();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1507,19 +1702,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void EditBoxRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void EditBoxRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         // Check if there is a background texture
         if (m_textureNormal.isLoaded())
         {
             if (m_editBox->m_mouseHover && m_textureHover.isLoaded())
-                target.draw(m_textureHover, states);
+                commands.addTexture(transform, m_textureHover);
             else
-                target.draw(m_textureNormal, states);
+                commands.addTexture(transform, m_textureNormal);
 
             // When the edit box is focused then draw an extra image
             if (m_editBox->m_focused && m_textureFocused.isLoaded())
-                target.draw(m_textureFocused, states);
+                commands.addTexture(transform, m_textureFocused);
         }
         else // There is no background texture
         {
@@ -1531,7 +1726,7 @@ namespace tgui
             else
                 editBox.setFillColor(calcColorOpacity(m_backgroundColorNormal, m_editBox->getOpacity()));
 
-            target.draw(editBox, states);
+            commands.addShape(transform, editBox);
         }
 
         // Draw the borders around the edit box
@@ -1544,22 +1739,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_editBox->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
     }
 
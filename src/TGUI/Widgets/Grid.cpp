@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Grid.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -33,7 +34,7 @@ namespace tgui
 
     Grid::Grid()
     {
-        m_callback.widgetType = "Grid";
+        setWidgetType(WidgetType::Grid);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -510,9 +511,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Grid::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void Grid::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
-        states.transform.translate(getPosition());
+        transform.translate(getPosition());
 
         // Draw all widgets
         for (unsigned int row = 0; row < m_gridWidgets.size(); ++row)
@@ -522,13 +523,20 @@ namespace tgui
                 if (m_gridWidgets[row][col].get() != nullptr)
                 {
                     if (m_gridWidgets[row][col]->isVisible())
-                        target.draw(*m_gridWidgets[row][col], states);
+                        m_gridWidgets[row][col]->emitRenderCommands(commands, transform);
                 }
             }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/Knob.hpp>
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 #include <cmath>
 
@@ -37,7 +38,7 @@ namespace tgui
 
     Knob::Knob()
     {
-        m_callback.widgetType = "Knob";
+        setWidgetType(WidgetType::Knob);
         m_draggableWidget = true;
 
         addSignal<int>("ValueChanged");
@@ -196,7 +197,9 @@ namespace tgui
             // The knob might have to point in a different direction
             recalculateRotation();
 
-            m_callback.value = m_value;
+            if (m_callback)
+                m_callback->value = m_value;
+
             sendSignal("ValueChanged", m_value);
         }
     }
@@ -243,10 +246,11 @@ namespace tgui
             }
             else // There is no texture, the widget has a circle shape
             {
-                sf::Vector2f centerPoint = getPosition() + (getSize() / 2.0f);
-                sf::Vector2f mousePoint = {x, y};
-                float distance = std::sqrt(std::pow(centerPoint.x - mousePoint.x, 2) + std::pow(centerPoint.y - mousePoint.y, 2));
-                return (distance <= std::min(getSize().x, getSize().y));
+                // Compare the squared distance to the center, so that no square root is needed
+                const sf::Vector2f centerPoint = getPosition() + (getSize() / 2.0f);
+                const sf::Vector2f diff = {centerPoint.x - x, centerPoint.y - y};
+                const float maxDistance = std::min(getSize().x, getSize().y);
+                return ((diff.x * diff.x) + (diff.y * diff.y) <= maxDistance * maxDistance);
             }
         }
 
@@ -467,9 +471,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Knob::createCallback()
+    {
+        Widget::createCallback();
+        m_callback->value = m_value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Knob::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        getRenderer()->emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Knob::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        getRenderer()->draw(target, states);
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -649,12 +668,12 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void KnobRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void KnobRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         if (m_backgroundTexture.isLoaded() && m_foregroundTexture.isLoaded())
         {
-            target.draw(m_backgroundTexture, states);
-            target.draw(m_foregroundTexture, states);
+            commands.addTexture(transform, m_backgroundTexture);
+            commands.addTexture(transform, m_foregroundTexture);
         }
         else
         {
@@ -665,13 +684,13 @@ namespace tgui
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_knob->getOpacity()));
             background.setOutlineColor(calcColorOpacity(m_borderColor, m_knob->getOpacity()));
             background.setOutlineThickness(std::min({m_borders.left, m_borders.top, m_borders.right, m_borders.bottom}));
-            target.draw(background, states);
+            commands.addShape(transform, background);
 
             sf::CircleShape thumb{size / 10.0f};
             thumb.setFillColor(calcColorOpacity(m_thumbColor, m_knob->getOpacity()));
             thumb.setPosition({m_knob->getPosition().x + (size / 2.0f) - thumb.getRadius() + (std::cos(m_knob->m_angle / 180 * pi) * background.getRadius() * 3/5),
                                m_knob->getPosition().y + (size / 2.0f) - thumb.getRadius() + (-std::sin(m_knob->m_angle / 180 * pi) * background.getRadius() * 3/5)});
-            target.draw(thumb, states);
+            commands.addShape(transform, thumb);
         }
     }
 
@@ -26,7 +26,8 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Loading/Theme.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBackend.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
 
 #include <cmath>
 
@@ -38,7 +39,7 @@ namespace tgui
 
     Label::Label()
     {
-        m_callback.widgetType = "Label";
+        setWidgetType(WidgetType::Label);
 
         addSignal<sf::String>("DoubleClicked");
 
@@ -80,13 +81,14 @@ namespace tgui
 
         if (getFont())
         {
+            const float lineSpacing = priv::TextMetrics{getFont(), m_textSize}.getLineSpacing();
             sf::Vector2f pos{std::round(getPosition().x + getRenderer()->getPadding().left),
                              getPosition().y + getRenderer()->getPadding().top - getTextVerticalCorrection(getFont(), m_textSize, m_textStyle)};
 
             if (m_verticalAlignment != VerticalAlignment::Top)
             {
                 float totalHeight = getSize().y - getRenderer()->getPadding().top - getRenderer()->getPadding().bottom;
-                float totalTextHeight = m_lines.size() * getFont()->getLineSpacing(m_textSize);
+                float totalTextHeight = m_lines.size() * lineSpacing;
 
                 if (m_verticalAlignment == VerticalAlignment::Center)
                     pos.y += (totalHeight - totalTextHeight) / 2.f;
@@ -99,7 +101,7 @@ namespace tgui
                 for (auto& line : m_lines)
                 {
                     line.setPosition(pos.x, std::floor(pos.y));
-                    pos.y += getFont()->getLineSpacing(m_textSize);
+                    pos.y += lineSpacing;
                 }
             }
             else // Center or Right alignment
@@ -114,14 +116,14 @@ namespace tgui
                     while (lastChar > 0 && isWhitespace(line.getString()[lastChar-1]))
                         lastChar--;
 
-                    float textWidth = line.findCharacterPos(lastChar).x;
+                    float textWidth = priv::findCharacterPos(line, getFont(), lastChar).x;
 
                     if (m_horizontalAlignment == HorizontalAlignment::Center)
                         line.setPosition(std::round(pos.x + (totalWidth - textWidth) / 2.f), std::floor(pos.y));
                     else if (m_horizontalAlignment == HorizontalAlignment::Right)
                         line.setPosition(std::round(pos.x + totalWidth - textWidth), std::floor(pos.y));
 
-                    pos.y += getFont()->getLineSpacing(m_textSize);
+                    pos.y += lineSpacing;
                 }
             }
         }
@@ -322,7 +324,9 @@ namespace tgui
             {
                 m_possibleDoubleClick = false;
 
-                m_callback.text = m_string;
+                if (m_callback)
+                    m_callback->text = m_string;
+
                 sendSignal("DoubleClicked", m_string);
             }
             else // This is the first click
@@ -377,7 +381,7 @@ namespace tgui
         unsigned int index = 0;
         unsigned int lineCount = 0;
         float calculatedLabelWidth = 0;
-        bool bold = (m_textStyle & sf::Text::Bold) != 0;
+        priv::TextMetrics metrics{getFont(), m_textSize, (m_textStyle & sf::Text::Bold) != 0};
         while (index < m_string.getSize())
         {
             lineCount++;
@@ -395,17 +399,17 @@ namespace tgui
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = static_cast<float>(getFont()->getGlyph(' ', m_textSize, bold).textureRect.width) * 4;
+                    charWidth = metrics.getWidth(' ') * 4;
                 else
-                    charWidth = static_cast<float>(getFont()->getGlyph(curChar, m_textSize, bold).textureRect.width);
+                    charWidth = metrics.getWidth(curChar);
 
-                float kerning = static_cast<float>(getFont()->getKerning(prevChar, curChar, m_textSize));
+                float kerning = metrics.getKerning(prevChar, curChar);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
                 {
                     if (curChar == '\t')
-                        width += (static_cast<float>(getFont()->getGlyph(' ', m_textSize, bold).advance) * 4) + kerning;
+                        width += (metrics.getAdvance(' ') * 4) + kerning;
                     else
-                        width += static_cast<float>(getFont()->getGlyph(curChar, m_textSize, bold).advance) + kerning;
+                        width += metrics.getAdvance(curChar) + kerning;
 
                     index++;
                 }
@@ -475,7 +479,7 @@ namespace tgui
         if (m_autoSize)
         {
             m_size = {std::max(calculatedLabelWidth, maxWidth) + getRenderer()->getPadding().left + getRenderer()->getPadding().right,
-                      (lineCount * getFont()->getLineSpacing(m_textSize)) + getRenderer()->getPadding().top + getRenderer()->getPadding().bottom};
+                      (lineCount * metrics.getLineSpacing()) + getRenderer()->getPadding().top + getRenderer()->getPadding().bottom};
 
             m_background.setSize(getSize());
         }
@@ -485,34 +489,43 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Label::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void Label::createCallback()
     {
-        if (m_autoSize)
-        {
-            // Draw the background
-            if (m_background.getFillColor() != sf::Color::Transparent)
-                target.draw(m_background, states);
+        ClickableWidget::createCallback();
+        m_callback->text = m_string;
+    }
 
-            // Draw the text
-            for (auto& line : m_lines)
-                target.draw(line, states);
-        }
-        else
-        {
-            // Draw the background
-            if (m_background.getFillColor() != sf::Color::Transparent)
-                target.draw(m_background, states);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Set the clipping for all draw calls that happen until this clipping object goes out of scope
-            Padding padding = getRenderer()->getPadding();
-            Clipping clipping{target, states, {getPosition().x + padding.left, getPosition().y + padding.top}, {getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom}};
+    void Label::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        // Draw the background
+        if (m_background.getFillColor() != sf::Color::Transparent)
+            commands.addQuad(transform, {m_background.getPosition(), m_background.getSize()}, m_background.getFillColor());
 
-            // Draw the text
-            for (auto& line : m_lines)
-                target.draw(line, states);
+        // When a manual size is set, the text is clipped to the area inside the padding
+        if (!m_autoSize)
+        {
+            Padding padding = getRenderer()->getPadding();
+            commands.pushClip(transform, {getPosition().x + padding.left, getPosition().y + padding.top,
+                                          getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom});
         }
 
-        getRenderer()->draw(target, states);
+        // Draw the text
+        for (auto& line : m_lines)
+            commands.addText(transform, line, m_font);
+
+        if (!m_autoSize)
+            commands.popClip();
+
+        getRenderer()->emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Label::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -641,34 +654,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void LabelRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void LabelRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
-        // Draw the borders around the button
+        // Draw the borders around the label
         if (m_borders != Borders{0, 0, 0, 0})
         {
             sf::Vector2f position = m_label->getPosition();
             sf::Vector2f size = m_label->getSize();
+            sf::Color color = calcColorOpacity(m_borderColor, m_label->getOpacity());
 
             // Draw left border
-            sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
-            border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
-            border.setFillColor(calcColorOpacity(m_borderColor, m_label->getOpacity()));
-            target.draw(border, states);
+            commands.addQuad(transform, {position.x - m_borders.left, position.y - m_borders.top, m_borders.left, size.y + m_borders.top}, color);
 
             // Draw top border
-            border.setSize({size.x + m_borders.right, m_borders.top});
-            border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            commands.addQuad(transform, {position.x, position.y - m_borders.top, size.x + m_borders.right, m_borders.top}, color);
 
             // Draw right border
-            border.setSize({m_borders.right, size.y + m_borders.bottom});
-            border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            commands.addQuad(transform, {position.x + size.x, position.y, m_borders.right, size.y + m_borders.bottom}, color);
 
             // Draw bottom border
-            border.setSize({size.x + m_borders.left, m_borders.bottom});
-            border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            commands.addQuad(transform, {position.x - m_borders.left, position.y + size.y, size.x + m_borders.left, m_borders.bottom}, color);
         }
     }
 
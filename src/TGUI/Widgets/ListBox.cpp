@@ -27,7 +27,7 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Widgets/Label.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -37,7 +37,7 @@ namespace tgui
 
     ListBox::ListBox()
     {
-        m_callback.widgetType = "ListBox";
+        setWidgetType(WidgetType::ListBox);
         m_draggableWidget = true;
 
         addSignal<sf::String, TypeSet<sf::String, sf::String>>("ItemSelected");
@@ -58,6 +58,7 @@ namespace tgui
         Widget               {listBoxToCopy},
         m_items              (listBoxToCopy.m_items), // Did not compile in VS2013 when using braces
         m_itemIds            (listBoxToCopy.m_itemIds), // Did not compile in VS2013 when using braces
+        m_internedItemIds    (listBoxToCopy.m_internedItemIds), // Did not compile in VS2013 when using braces
         m_selectedItem       {listBoxToCopy.m_selectedItem},
         m_hoveringItem       {listBoxToCopy.m_hoveringItem},
         m_itemHeight         {listBoxToCopy.m_itemHeight},
@@ -80,6 +81,7 @@ namespace tgui
 
             std::swap(m_items,               temp.m_items);
             std::swap(m_itemIds,             temp.m_itemIds);
+            std::swap(m_internedItemIds,     temp.m_internedItemIds);
             std::swap(m_selectedItem,        temp.m_selectedItem);
             std::swap(m_hoveringItem,        temp.m_hoveringItem);
             std::swap(m_itemHeight,          temp.m_itemHeight);
@@ -219,6 +221,7 @@ namespace tgui
             // Add the new item to the list
             m_items.push_back(std::move(newItem));
             m_itemIds.push_back(id);
+            m_internedItemIds.push_back(id);
 
             updatePosition();
             return true;
@@ -246,11 +249,9 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return setSelectedItemByIndex(i);
-        }
+        const int index = getItemIndexById(id);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -316,11 +317,9 @@ namespace tgui
 
     bool ListBox::removeItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return removeItemByIndex(i);
-        }
+        const int index = getItemIndexById(id);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -335,6 +334,7 @@ namespace tgui
         // Remove the item
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
+        m_internedItemIds.erase(m_internedItemIds.begin() + index);
 
         // If there is a scrollbar then tell it that an item was removed
         if (m_scroll != nullptr)
@@ -369,6 +369,7 @@ namespace tgui
         // Clear the list, remove all items
         m_items.clear();
         m_itemIds.clear();
+        m_internedItemIds.clear();
 
         // Unselect any selected item
         m_selectedItem = -1;
@@ -383,11 +384,9 @@ namespace tgui
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return m_items[i].getText();
-        }
+        const int index = getItemIndexById(id);
+        if (index >= 0)
+            return m_items[index].getText();
 
         return "";
     }
@@ -430,11 +429,9 @@ namespace tgui
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return changeItemByIndex(i, newValue);
-        }
+        const int index = getItemIndexById(id);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -493,6 +490,7 @@ namespace tgui
                 // Remove the items that did not fit inside the list box
                 m_items.erase(m_items.begin() + m_maxItems, m_items.end());
                 m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+                m_internedItemIds.erase(m_internedItemIds.begin() + m_maxItems, m_internedItemIds.end());
             }
         }
 
@@ -531,6 +529,7 @@ namespace tgui
                 // Remove the items that did not fit inside the list box
                 m_items.erase(m_items.begin() + m_maxItems, m_items.end());
                 m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+                m_internedItemIds.erase(m_internedItemIds.begin() + m_maxItems, m_internedItemIds.end());
             }
         }
         else // There is a scrollbar
@@ -586,6 +585,7 @@ namespace tgui
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
             m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+            m_internedItemIds.erase(m_internedItemIds.begin() + m_maxItems, m_internedItemIds.end());
 
             // If there is a scrollbar then tell it that the number of items was changed
             if (m_scroll != nullptr)
@@ -654,8 +654,12 @@ namespace tgui
 
             if (m_hoveringItem >= 0)
             {
-                m_callback.text = m_items[m_hoveringItem].getText();
-                m_callback.itemId = m_itemIds[m_hoveringItem];
+                if (m_callback)
+                {
+                    m_callback->text = m_items[m_hoveringItem].getText();
+                    m_callback->itemId = m_itemIds[m_hoveringItem];
+                }
+
                 sendSignal("MousePressed", m_items[m_hoveringItem].getText(), m_items[m_hoveringItem].getText(), m_itemIds[m_hoveringItem]);
             }
 
@@ -672,14 +676,22 @@ namespace tgui
                 {
                     m_items[m_selectedItem].setTextColor(getRenderer()->m_selectedTextColor);
 
-                    m_callback.text  = m_items[m_selectedItem].getText();
-                    m_callback.itemId = m_itemIds[m_selectedItem];
+                    if (m_callback)
+                    {
+                        m_callback->text  = m_items[m_selectedItem].getText();
+                        m_callback->itemId = m_itemIds[m_selectedItem];
+                    }
+
                     sendSignal("ItemSelected", m_items[m_selectedItem].getText(), m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
                 }
                 else
                 {
-                    m_callback.text  = "";
-                    m_callback.itemId = "";
+                    if (m_callback)
+                    {
+                        m_callback->text  = "";
+                        m_callback->itemId = "";
+                    }
+
                     sendSignal("ItemSelected", "", "", "");
                 }
             }
@@ -727,8 +739,12 @@ namespace tgui
         {
             if (m_selectedItem >= 0)
             {
-                m_callback.text  = m_items[m_selectedItem].getText();
-                m_callback.itemId = m_itemIds[m_selectedItem];
+                if (m_callback)
+                {
+                    m_callback->text  = m_items[m_selectedItem].getText();
+                    m_callback->itemId = m_itemIds[m_selectedItem];
+                }
+
                 sendSignal("MouseReleased", m_items[m_selectedItem].getText(), m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
             }
 
@@ -840,14 +856,22 @@ namespace tgui
                     {
                         m_items[m_selectedItem].setTextColor(getRenderer()->m_selectedTextColor);
 
-                        m_callback.text = m_items[m_selectedItem].getText();
-                        m_callback.itemId = m_itemIds[m_selectedItem];
+                        if (m_callback)
+                        {
+                            m_callback->text = m_items[m_selectedItem].getText();
+                            m_callback->itemId = m_itemIds[m_selectedItem];
+                        }
+
                         sendSignal("ItemSelected", m_items[m_selectedItem].getText(), m_items[m_selectedItem].getText(), m_itemIds[m_selectedItem]);
                     }
                     else
                     {
-                        m_callback.text = "";
-                        m_callback.itemId = "";
+                        if (m_callback)
+                        {
+                            m_callback->text = "";
+                            m_callback->itemId = "";
+                        }
+
                         sendSignal("ItemSelected", "", "", "");
                     }
                 }
@@ -922,6 +946,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    int ListBox::getItemIndexById(const sf::String& id) const
+    {
+        // When no interned string with this id exists, then no item can have the id
+        const InternedString internedId = InternedString::find(id);
+        if (internedId.isEmpty() && !id.isEmpty())
+            return -1;
+
+        for (std::size_t i = 0; i < m_internedItemIds.size(); ++i)
+        {
+            if (m_internedItemIds[i] == internedId)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::updateItemColors()
     {
         for (auto& item : m_items)
@@ -981,15 +1023,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ListBox::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Draw the background
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
         {
-            // Set the clipping for all draw calls that happen until this clipping object goes out of scope
+            // Clip the commands that follow to the inside of the padding
             Padding padding = getRenderer()->getScaledPadding();
-            Clipping clipping{target, states, {getPosition().x + padding.left, getPosition().y + padding.top}, {getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom}};
+            commands.pushClip(transform, {getPosition().x + padding.left, getPosition().y + padding.top, getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom});
 
             // Find out which items are visible
             std::size_t firstItem = 0;
@@ -1014,7 +1056,7 @@ namespace tgui
                 if ((m_scroll != nullptr) && (m_scroll->getLowValue() < m_scroll->getMaximum()))
                     back.setPosition({back.getPosition().x, back.getPosition().y - m_scroll->getValue()});
 
-                target.draw(back, states);
+                commands.addShape(transform, back);
             }
 
             // Draw the background of the item on which the mouse is standing
@@ -1027,17 +1069,26 @@ namespace tgui
                 if ((m_scroll != nullptr) && (m_scroll->getLowValue() < m_scroll->getMaximum()))
                     back.setPosition({back.getPosition().x, back.getPosition().y - m_scroll->getValue()});
 
-                target.draw(back, states);
+                commands.addShape(transform, back);
             }
 
             // Draw the items
             for (std::size_t i = firstItem; i < lastItem; ++i)
-                target.draw(m_items[i], states);
+                m_items[i].emitRenderCommands(commands, transform);
+
+            commands.popClip();
         }
 
         // Draw the scrollbar
         if (m_scroll != nullptr)
-            target.draw(*m_scroll, states);
+            m_scroll->emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1286,17 +1337,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBoxRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ListBoxRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         // Draw the background
         if (m_backgroundTexture.isLoaded())
-            target.draw(m_backgroundTexture, states);
+            commands.addTexture(transform, m_backgroundTexture);
         else
         {
             sf::RectangleShape background(m_listBox->getSize());
             background.setPosition(m_listBox->getPosition());
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_listBox->getOpacity()));
-            target.draw(background, states);
+            commands.addShape(transform, background);
         }
 
         // Draw the borders
@@ -1309,22 +1360,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_listBox->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
     }
 
@@ -26,6 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/MenuBar.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -35,7 +36,7 @@ namespace tgui
 
     MenuBar::MenuBar()
     {
-        m_callback.widgetType = "MenuBar";
+        setWidgetType(WidgetType::MenuBar);
 
         addSignal<std::vector<sf::String>, sf::String>("MenuItemClicked");
 
@@ -386,8 +387,11 @@ namespace tgui
 
                 if (selectedMenuItem < m_menus[m_visibleMenu].menuItems.size())
                 {
-                    m_callback.index = m_visibleMenu;
-                    m_callback.text = m_menus[m_visibleMenu].menuItems[selectedMenuItem].getText();
+                    if (m_callback)
+                    {
+                        m_callback->index = m_visibleMenu;
+                        m_callback->text = m_menus[m_visibleMenu].menuItems[selectedMenuItem].getText();
+                    }
 
                     sendSignal("MenuItemClicked",
                                std::vector<sf::String>{m_menus[m_visibleMenu].text.getText(), m_menus[m_visibleMenu].menuItems[selectedMenuItem].getText()},
@@ -529,25 +533,32 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MenuBar::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void MenuBar::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Draw the background
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
         // Draw the texts of the menus
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
-            target.draw(m_menus[i].text, states);
+            m_menus[i].text.emitRenderCommands(commands, transform);
 
             // Draw the menu items when the menu is open
             if (m_visibleMenu == static_cast<int>(i))
             {
                 for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    target.draw(m_menus[i].menuItems[j], states);
+                    m_menus[i].menuItems[j].emitRenderCommands(commands, transform);
             }
         }
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MenuBar::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -754,7 +765,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MenuBarRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void MenuBarRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         // Draw the background
         if (m_backgroundTexture.isLoaded())
@@ -762,14 +773,14 @@ namespace tgui
             Texture background = m_backgroundTexture;
             background.setPosition(m_menuBar->getPosition());
             background.setSize(m_menuBar->getSize());
-            target.draw(background, states);
+            commands.addTexture(transform, background);
         }
         else
         {
             sf::RectangleShape background{m_menuBar->getSize()};
             background.setPosition({m_menuBar->getPosition()});
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_menuBar->getOpacity()));
-            target.draw(background, states);
+            commands.addShape(transform, background);
         }
 
         // Draw the menu backgrounds
@@ -790,7 +801,7 @@ namespace tgui
                     Texture selectedBackgroundTexture = m_selectedItemBackgroundTexture;
                     selectedBackgroundTexture.setPosition({positionX, m_menuBar->getPosition().y});
                     selectedBackgroundTexture.setSize({m_menuBar->m_menus[i].text.getSize().x + 2*m_distanceToSide, m_menuBar->getSize().y});
-                    target.draw(selectedBackgroundTexture, states);
+                    commands.addTexture(transform, selectedBackgroundTexture);
 
                     backgroundTexture.setSize({menuWidth, m_menuBar->getSize().y});
                     selectedBackgroundTexture.setSize({menuWidth, m_menuBar->getSize().y});
@@ -799,12 +810,12 @@ namespace tgui
                         if (m_menuBar->m_menus[i].selectedMenuItem == static_cast<int>(j))
                         {
                             selectedBackgroundTexture.setPosition({positionX, m_menuBar->getPosition().y + (j+1)*m_menuBar->getSize().y});
-                            target.draw(selectedBackgroundTexture, states);
+                            commands.addTexture(transform, selectedBackgroundTexture);
                         }
                         else
                         {
                             backgroundTexture.setPosition({positionX, m_menuBar->getPosition().y + (j+1)*m_menuBar->getSize().y});
-                            target.draw(backgroundTexture, states);
+                            commands.addTexture(transform, backgroundTexture);
                         }
                     }
                 }
@@ -812,13 +823,13 @@ namespace tgui
                 {
                     backgroundTexture.setPosition({positionX, m_menuBar->getPosition().y});
                     backgroundTexture.setSize({m_menuBar->m_menus[i].text.getSize().x + 2*m_distanceToSide, m_menuBar->getSize().y});
-                    target.draw(backgroundTexture, states);
+                    commands.addTexture(transform, backgroundTexture);
 
                     backgroundTexture.setSize({menuWidth, m_menuBar->getSize().y});
                     for (unsigned int j = 0; j < m_menuBar->m_menus[i].menuItems.size(); ++j)
                     {
                         backgroundTexture.setPosition({positionX, m_menuBar->getPosition().y + (j+1)*m_menuBar->getSize().y});
-                        target.draw(backgroundTexture, states);
+                        commands.addTexture(transform, backgroundTexture);
                     }
                 }
                 else
@@ -826,7 +837,7 @@ namespace tgui
                     sf::RectangleShape background{{m_menuBar->m_menus[i].text.getSize().x + 2*m_distanceToSide, m_menuBar->getSize().y}};
                     background.setPosition({positionX, m_menuBar->getPosition().y});
                     background.setFillColor(calcColorOpacity(m_selectedBackgroundColor, m_menuBar->getOpacity()));
-                    target.draw(background, states);
+                    commands.addShape(transform, background);
 
                     background.setSize({menuWidth, m_menuBar->getSize().y});
                     for (unsigned int j = 0; j < m_menuBar->m_menus[i].menuItems.size(); ++j)
@@ -838,7 +849,7 @@ namespace tgui
                         else
                             background.setFillColor(calcColorOpacity(m_backgroundColor, m_menuBar->getOpacity()));
 
-                        target.draw(background, states);
+                        commands.addShape(transform, background);
                     }
                 }
             }
@@ -848,7 +859,7 @@ namespace tgui
                 {
                     backgroundTexture.setPosition({positionX, m_menuBar->getPosition().y});
                     backgroundTexture.setSize({m_menuBar->m_menus[i].text.getSize().x + 2*m_distanceToSide, m_menuBar->getSize().y});
-                    target.draw(backgroundTexture, states);
+                    commands.addTexture(transform, backgroundTexture);
                 }
             }
 
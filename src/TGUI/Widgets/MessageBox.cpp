@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/MessageBox.hpp>
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,7 +35,7 @@ namespace tgui
 
     MessageBox::MessageBox()
     {
-        m_callback.widgetType = "MessageBox";
+        setWidgetType(WidgetType::MessageBox);
 
         addSignal<sf::String>("ButtonPressed");
 
@@ -62,7 +63,7 @@ namespace tgui
         {
             Button::Ptr button = Button::copy(*it);
             button->disconnectAll();
-            button->connect("Pressed", [=]() { m_callback.text = button->getText(); sendSignal("ButtonPressed", button->getText()); });
+            button->connect("Pressed", [=]() { if (m_callback) m_callback->text = button->getText(); sendSignal("ButtonPressed", button->getText()); });
 
             m_buttons.push_back(button);
         }
@@ -152,7 +153,7 @@ namespace tgui
 
         button->setTextSize(m_textSize);
         button->setText(caption);
-        button->connect("Pressed", [=](){ m_callback.text = caption; sendSignal("ButtonPressed", caption); });
+        button->connect("Pressed", [=](){ if (m_callback) m_callback->text = caption; sendSignal("ButtonPressed", caption); });
 
         add(button, "#TGUI_INTERNAL$MessageBoxButton$" + caption + "#");
         m_buttons.push_back(button);
@@ -170,12 +171,13 @@ namespace tgui
         // Calculate the button size
         if (getFont())
         {
-            buttonWidth = 5.0f * getFont()->getLineSpacing(m_textSize);
-            buttonHeight = getFont()->getLineSpacing(m_textSize) / 0.85f;
+            const float lineSpacing = priv::TextMetrics{getFont(), m_textSize}.getLineSpacing();
+            buttonWidth = 5.0f * lineSpacing;
+            buttonHeight = lineSpacing / 0.85f;
 
             for (unsigned int i = 0; i < m_buttons.size(); ++i)
             {
-                float width = sf::Text(m_buttons[i]->getText(), *getFont(), m_textSize).getLocalBounds().width;
+                float width = priv::getTextBounds(sf::Text(m_buttons[i]->getText(), *getFont(), m_textSize), getFont()).width;
                 if (buttonWidth < width * 10.0f / 9.0f)
                     buttonWidth = width * 10.0f / 9.0f;
             }
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/RenderBackend.hpp>
 #include <TGUI/Clipping.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,7 +35,7 @@ namespace tgui
 
     Panel::Panel(const Layout2d& size)
     {
-        m_callback.widgetType = "Panel";
+        setWidgetType(WidgetType::Panel);
 
         addSignal<sf::Vector2f>("MousePressed");
         addSignal<sf::Vector2f>("MouseReleased");
@@ -85,8 +86,12 @@ namespace tgui
         {
             m_mouseDown = true;
 
-            m_callback.mouse.x = static_cast<int>(x - getPosition().x);
-            m_callback.mouse.y = static_cast<int>(y - getPosition().y);
+            if (m_callback)
+            {
+                m_callback->mouse.x = static_cast<int>(x - getPosition().x);
+                m_callback->mouse.y = static_cast<int>(y - getPosition().y);
+            }
+
             sendSignal("MousePressed", sf::Vector2f{x - getPosition().x, y - getPosition().y});
         }
 
@@ -99,8 +104,12 @@ namespace tgui
     {
         if (mouseOnWidget(x, y))
         {
-            m_callback.mouse.x = static_cast<int>(x - getPosition().x);
-            m_callback.mouse.y = static_cast<int>(y - getPosition().y);
+            if (m_callback)
+            {
+                m_callback->mouse.x = static_cast<int>(x - getPosition().x);
+                m_callback->mouse.y = static_cast<int>(y - getPosition().y);
+            }
+
             sendSignal("MouseReleased", sf::Vector2f{x - getPosition().x, y - getPosition().y});
 
             if (m_mouseDown)
@@ -114,53 +123,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Panel::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        transform.translate(getPosition());
+
+        emitBackgroundCommands(commands, transform);
+
+        commands.pushClip(transform, {{}, getSize()});
+        emitWidgetContainerCommands(commands, transform);
+        commands.popClip();
+
+        emitBorderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Panel::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        // Set the position
-        states.transform.translate(getPosition());
+        drawRenderCommands(target, states);
+    }
 
-        // Draw the background
-        if (m_backgroundColor != sf::Color::Transparent)
-        {
-            sf::RectangleShape background(getSize());
-            background.setFillColor(calcColorOpacity(m_backgroundColor, getOpacity()));
-            target.draw(background, states);
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Draw the widgets
-        {
-            Clipping clipping{target, states, {}, getSize()};
+    void Panel::emitBackgroundCommands(RenderCommandList& commands, const sf::Transform& transform) const
+    {
+        if (m_backgroundColor != sf::Color::Transparent)
+            commands.addQuad(transform, {{}, getSize()}, calcColorOpacity(m_backgroundColor, getOpacity()));
+    }
 
-            drawWidgetContainer(&target, states);
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Draw the borders around the panel
-        if (getRenderer()->m_borders != Borders{0, 0, 0, 0})
-        {
-            Borders& borders = getRenderer()->m_borders;
-            sf::Vector2f size = getSize();
-
-            // Draw left border
-            sf::RectangleShape border({borders.left, size.y + borders.top});
-            border.setPosition(-borders.left, -borders.top);
-            border.setFillColor(calcColorOpacity(getRenderer()->m_borderColor, getOpacity()));
-            target.draw(border, states);
-
-            // Draw top border
-            border.setSize({size.x + borders.right, borders.top});
-            border.setPosition(0, -borders.top);
-            target.draw(border, states);
-
-            // Draw right border
-            border.setSize({borders.right, size.y + borders.bottom});
-            border.setPosition(size.x, 0);
-            target.draw(border, states);
-
-            // Draw bottom border
-            border.setSize({size.x + borders.left, borders.bottom});
-            border.setPosition(-borders.left, size.y);
-            target.draw(border, states);
-        }
+    void Panel::emitBorderCommands(RenderCommandList& commands, const sf::Transform& transform) const
+    {
+        const Borders& borders = getRenderer()->m_borders;
+        if (borders == Borders{0, 0, 0, 0})
+            return;
+
+        const sf::Vector2f size = getSize();
+        const sf::Color color = calcColorOpacity(getRenderer()->m_borderColor, getOpacity());
+        commands.addQuad(transform, {-borders.left, -borders.top, borders.left, size.y + borders.top}, color);
+        commands.addQuad(transform, {0, -borders.top, size.x + borders.right, borders.top}, color);
+        commands.addQuad(transform, {size.x, 0, borders.right, size.y + borders.bottom}, color);
+        commands.addQuad(transform, {-borders.left, size.y, size.x + borders.left, borders.bottom}, color);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -33,7 +34,7 @@ namespace tgui
 
     Picture::Picture()
     {
-        m_callback.widgetType = "Picture";
+        setWidgetType(WidgetType::Picture);
 
         addSignal("DoubleClicked");
     }
@@ -168,8 +169,12 @@ namespace tgui
             {
                 m_possibleDoubleClick = false;
 
-                m_callback.mouse.x = static_cast<int>(x - getPosition().x);
-                m_callback.mouse.y = static_cast<int>(y - getPosition().y);
+                if (m_callback)
+                {
+                    m_callback->mouse.x = static_cast<int>(x - getPosition().x);
+                    m_callback->mouse.y = static_cast<int>(y - getPosition().y);
+                }
+
                 sendSignal("DoubleClicked", sf::Vector2f{x - getPosition().x, y - getPosition().y});
             }
             else // This is the first click
@@ -196,9 +201,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Picture::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        commands.addTexture(transform, m_texture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        target.draw(m_texture, states);
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,7 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ProgressBar.hpp>
 #include <TGUI/Loading/Theme.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,7 +36,7 @@ namespace tgui
 
     ProgressBar::ProgressBar()
     {
-        m_callback.widgetType = "ProgressBar";
+        setWidgetType(WidgetType::ProgressBar);
 
         addSignal<int>("ValueChanged");
         addSignal<int>("Full");
@@ -196,7 +196,9 @@ namespace tgui
         {
             m_value = value;
 
-            m_callback.value = static_cast<int>(m_value);
+            if (m_callback)
+                m_callback->value = static_cast<int>(m_value);
+
             sendSignal("ValueChanged", m_value);
 
             if (m_value == m_maximum)
@@ -296,6 +298,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ProgressBar::createCallback()
+    {
+        ClickableWidget::createCallback();
+        m_callback->value = static_cast<int>(m_value);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ProgressBar::recalculateSize()
     {
         sf::Vector2f size;
@@ -366,9 +376,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ProgressBar::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        getRenderer()->emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ProgressBar::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        getRenderer()->draw(target, states);
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,20 +595,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ProgressBarRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ProgressBarRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         // Check if there are textures
         if (m_textureBack.isLoaded() && m_textureFront.isLoaded())
         {
-            target.draw(m_textureBack, states);
-            target.draw(m_textureFront, states);
+            commands.addTexture(transform, m_textureBack);
+            commands.addTexture(transform, m_textureFront);
         }
         else // There is no background texture
         {
             sf::RectangleShape back(m_progressBar->getSize());
             back.setPosition(m_progressBar->getPosition());
             back.setFillColor(calcColorOpacity(m_backgroundColor, m_progressBar->getOpacity()));
-            target.draw(back, states);
+            commands.addShape(transform, back);
 
             sf::Vector2f frontPosition = m_progressBar->getPosition();
             if (m_progressBar->getFillDirection() == ProgressBar::FillDirection::RightToLeft)
@@ -602,14 +619,14 @@ namespace tgui
             sf::RectangleShape front({m_progressBar->m_frontRect.width, m_progressBar->m_frontRect.height});
             front.setPosition(frontPosition);
             front.setFillColor(calcColorOpacity(m_foregroundColor, m_progressBar->getOpacity()));
-            target.draw(front, states);
+            commands.addShape(transform, front);
         }
 
         // Draw the text
         if (m_progressBar->m_textBack.getText() != "")
         {
             if (m_progressBar->m_textBack.getTextColor() == m_progressBar->m_textFront.getTextColor())
-                target.draw(m_progressBar->m_textBack, states);
+                m_progressBar->m_textBack.emitRenderCommands(commands, transform);
             else
             {
                 sf::FloatRect backRect;
@@ -713,16 +730,14 @@ namespace tgui
                 }
 
                 // Draw the back text
-                {
-                    Clipping clipping{target, states, {backRect.left, backRect.top}, {backRect.width, backRect.height}};
-                    target.draw(m_progressBar->m_textBack, states);
-                }
+                commands.pushClip(transform, {backRect.left, backRect.top, backRect.width, backRect.height});
+                m_progressBar->m_textBack.emitRenderCommands(commands, transform);
+                commands.popClip();
 
                 // Draw the front text
-                {
-                    Clipping clipping{target, states, {frontRect.left, frontRect.top}, {frontRect.width, frontRect.height}};
-                    target.draw(m_progressBar->m_textFront, states);
-                }
+                commands.pushClip(transform, {frontRect.left, frontRect.top, frontRect.width, frontRect.height});
+                m_progressBar->m_textFront.emitRenderCommands(commands, transform);
+                commands.popClip();
             }
         }
 
@@ -736,22 +751,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_progressBar->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
     }
 
@@ -26,6 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -40,7 +41,7 @@ namespace tgui
 
     RadioButton::RadioButton()
     {
-        m_callback.widgetType = "RadioButton";
+        setWidgetType(WidgetType::RadioButton);
 
         addSignal<int>("Checked");
         addSignal<int>("Unchecked");
@@ -53,6 +54,44 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RadioButton::RadioButton(const RadioButton& copy) :
+        ClickableWidget {copy},
+        m_checked       {copy.m_checked},
+        m_allowTextClick{copy.m_allowTextClick},
+        m_text          {copy.m_text},
+        m_textSize      {copy.m_textSize},
+        m_group         {copy.m_group}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButton::~RadioButton()
+    {
+        leaveActiveGroup();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RadioButton& RadioButton::operator= (const RadioButton& right)
+    {
+        if (this != &right)
+        {
+            leaveActiveGroup();
+            ClickableWidget::operator=(right);
+
+            m_checked        = right.m_checked;
+            m_allowTextClick = right.m_allowTextClick;
+            m_text           = right.m_text;
+            m_textSize       = right.m_textSize;
+            m_group          = right.m_group;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     RadioButton::Ptr RadioButton::create()
     {
         return std::make_shared<RadioButton>();
@@ -139,14 +178,15 @@ namespace tgui
     {
         if (!m_checked)
         {
-            // Tell our parent that all the radio buttons should be unchecked
-            if (m_parent)
-                m_parent->uncheckRadioButtons();
+            // Uncheck the radio button that was checked before
+            joinActiveGroup();
 
             // Check this radio button
             m_checked = true;
 
-            m_callback.checked = true;
+            if (m_callback)
+                m_callback->checked = true;
+
             sendSignal("Checked", m_checked);
         }
     }
@@ -157,15 +197,32 @@ namespace tgui
     {
         if (m_checked)
         {
+            leaveActiveGroup();
             m_checked = false;
 
-            m_callback.checked = false;
+            if (m_callback)
+                m_callback->checked = false;
+
             sendSignal("Unchecked", m_checked);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void RadioButton::setGroup(const RadioButtonGroup::Ptr& group)
+    {
+        if (m_checked)
+        {
+            leaveActiveGroup();
+            m_group = group;
+            joinActiveGroup();
+        }
+        else
+            m_group = group;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButton::setText(const sf::String& text)
     {
         // Set the new text
@@ -275,6 +332,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void RadioButton::setParent(Container* parent)
+    {
+        // A checked radio button that moves to another container has to switch to the group of its new parent.
+        // A copy of a checked radio button also only registers itself in its group once it is added to a container.
+        if (m_checked && (!m_group || !m_checkedGroup))
+        {
+            leaveActiveGroup();
+            ClickableWidget::setParent(parent);
+            joinActiveGroup();
+        }
+        else
+            ClickableWidget::setParent(parent);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButton::reload(const std::string& primary, const std::string& secondary, bool force)
     {
         getRenderer()->setPadding({3, 3, 3, 3});
@@ -310,6 +383,50 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RadioButtonGroup::Ptr RadioButton::getActiveGroup() const
+    {
+        // Check boxes inherit from RadioButton but they are never part of a group
+        if (m_widgetTypeId == WidgetType::CheckBox)
+            return nullptr;
+
+        if (m_group)
+            return m_group;
+        else if (m_parent)
+            return m_parent->getRadioButtonGroup();
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::joinActiveGroup()
+    {
+        m_checkedGroup = getActiveGroup();
+        if (m_checkedGroup)
+            m_checkedGroup->radioButtonChecked(std::static_pointer_cast<RadioButton>(shared_from_this()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::leaveActiveGroup()
+    {
+        if (m_checkedGroup)
+        {
+            m_checkedGroup->radioButtonUnchecked(this);
+            m_checkedGroup = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::createCallback()
+    {
+        ClickableWidget::createCallback();
+        m_callback->checked = m_checked;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RadioButton::mouseEnteredWidget()
     {
         Widget::mouseEnteredWidget();
@@ -328,12 +445,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RadioButton::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void RadioButton::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
         // Draw the text
-        target.draw(m_text, states);
+        m_text.emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -686,28 +810,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RadioButtonRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void RadioButtonRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         if (m_textureUnchecked.isLoaded() && m_textureChecked.isLoaded())
         {
             if (m_radioButton->m_checked)
             {
                 if (m_radioButton->m_mouseHover && m_textureCheckedHover.isLoaded())
-                    target.draw(m_textureCheckedHover, states);
+                    commands.addTexture(transform, m_textureCheckedHover);
                 else
-                    target.draw(m_textureChecked, states);
+                    commands.addTexture(transform, m_textureChecked);
             }
             else
             {
                 if (m_radioButton->m_mouseHover && m_textureUncheckedHover.isLoaded())
-                    target.draw(m_textureUncheckedHover, states);
+                    commands.addTexture(transform, m_textureUncheckedHover);
                 else
-                    target.draw(m_textureUnchecked, states);
+                    commands.addTexture(transform, m_textureUnchecked);
             }
 
             // When the radio button is focused then draw an extra image
             if (m_radioButton->m_focused && m_textureFocused.isLoaded())
-                target.draw(m_textureFocused, states);
+                commands.addTexture(transform, m_textureFocused);
         }
         else // There are no images
         {
@@ -729,7 +853,7 @@ namespace tgui
                 circle.setOutlineColor(calcColorOpacity(m_backgroundColorNormal, m_radioButton->getOpacity()));
             }
 
-            target.draw(circle, states);
+            commands.addShape(transform, circle);
 
             // Draw the check if the radio button is checked
             if (m_radioButton->m_checked)
@@ -743,7 +867,7 @@ namespace tgui
                 else
                     check.setFillColor(calcColorOpacity(m_checkColorNormal, m_radioButton->getOpacity()));
 
-                target.draw(check, states);
+                commands.addShape(transform, check);
             }
         }
     }
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,7 +35,7 @@ namespace tgui
 
     Scrollbar::Scrollbar()
     {
-        m_callback.widgetType = "Scrollbar";
+        setWidgetType(WidgetType::Scrollbar);
         m_draggableWidget = true;
 
         addSignal<int>("ValueChanged");
@@ -265,7 +266,9 @@ namespace tgui
         {
             m_value = value;
 
-            m_callback.value = static_cast<int>(m_value);
+            if (m_callback)
+                m_callback->value = static_cast<int>(m_value);
+
             sendSignal("ValueChanged", static_cast<int>(m_value));
 
             // Recalculate the size and position of the thumb image
@@ -719,14 +722,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Scrollbar::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void Scrollbar::createCallback()
+    {
+        Widget::createCallback();
+        m_callback->value = static_cast<int>(m_value);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Scrollbar::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Don't draw the scrollbar when it is not needed
         if (m_autoHide && (m_maximum <= m_lowValue))
             return;
 
         // Draw the scrollbar
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Scrollbar::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1128,29 +1146,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollbarRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void ScrollbarRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded() && m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
         {
             if (m_scrollbar->m_mouseHover && m_textureTrackHover.isLoaded() && (m_scrollbar->m_mouseHoverOverPart == Scrollbar::Part::Track))
-                target.draw(m_textureTrackHover, states);
+                commands.addTexture(transform, m_textureTrackHover);
             else
-                target.draw(m_textureTrackNormal, states);
+                commands.addTexture(transform, m_textureTrackNormal);
 
             if (m_scrollbar->m_mouseHover && m_textureThumbHover.isLoaded() && (m_scrollbar->m_mouseHoverOverPart == Scrollbar::Part::Thumb))
-                target.draw(m_textureThumbHover, states);
+                commands.addTexture(transform, m_textureThumbHover);
             else
-                target.draw(m_textureThumbNormal, states);
+                commands.addTexture(transform, m_textureThumbNormal);
 
             if (m_scrollbar->m_mouseHover && m_textureArrowUpHover.isLoaded() && (m_scrollbar->m_mouseHoverOverPart == Scrollbar::Part::ArrowUp))
-                target.draw(m_textureArrowUpHover, states);
+                commands.addTexture(transform, m_textureArrowUpHover);
             else
-                target.draw(m_textureArrowUpNormal, states);
+                commands.addTexture(transform, m_textureArrowUpNormal);
 
             if (m_scrollbar->m_mouseHover && m_textureArrowDownHover.isLoaded() && (m_scrollbar->m_mouseHoverOverPart == Scrollbar::Part::ArrowDown))
-                target.draw(m_textureArrowDownHover, states);
+                commands.addTexture(transform, m_textureArrowDownHover);
             else
-                target.draw(m_textureArrowDownNormal, states);
+                commands.addTexture(transform, m_textureArrowDownNormal);
         }
         else // There are no textures
         {
@@ -1166,7 +1184,7 @@ namespace tgui
                 else
                     track.setFillColor(calcColorOpacity(m_trackColorNormal, m_scrollbar->getOpacity()));
 
-                target.draw(track, states);
+                commands.addShape(transform, track);
             }
 
             // Draw the thumb
@@ -1179,7 +1197,7 @@ namespace tgui
                 else
                     thumb.setFillColor(calcColorOpacity(m_thumbColorNormal, m_scrollbar->getOpacity()));
 
-                target.draw(thumb, states);
+                commands.addShape(transform, thumb);
             }
 
             // Draw the up arrow
@@ -1211,8 +1229,8 @@ namespace tgui
                     arrow.setPoint(2, {arrowBack.getPosition().x + (arrowBack.getSize().x * 4/5), arrowBack.getPosition().y + (arrowBack.getSize().y * 4/5)});
                 }
 
-                target.draw(arrowBack, states);
-                target.draw(arrow, states);
+                commands.addShape(transform, arrowBack);
+                commands.addShape(transform, arrow);
             }
 
             // Draw the down arrow
@@ -1244,8 +1262,8 @@ namespace tgui
                     arrow.setPoint(2, {arrowBack.getPosition().x + (arrowBack.getSize().x / 5), arrowBack.getPosition().y + (arrowBack.getSize().y * 4/5)});
                 }
 
-                target.draw(arrowBack, states);
-                target.draw(arrow, states);
+                commands.addShape(transform, arrowBack);
+                commands.addShape(transform, arrow);
             }
         }
     }
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/Slider.hpp>
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,7 +35,7 @@ namespace tgui
 
     Slider::Slider()
     {
-        m_callback.widgetType = "Slider";
+        setWidgetType(WidgetType::Slider);
         m_draggableWidget = true;
 
         addSignal<int>("ValueChanged");
@@ -240,7 +241,9 @@ namespace tgui
         {
             m_value = value;
 
-            m_callback.value = m_value;
+            if (m_callback)
+                m_callback->value = m_value;
+
             sendSignal("ValueChanged", m_value);
 
             // Recalculate the position of the thumb image
@@ -446,9 +449,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Slider::createCallback()
+    {
+        Widget::createCallback();
+        m_callback->value = m_value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Slider::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        getRenderer()->emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Slider::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        getRenderer()->draw(target, states);
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -711,15 +729,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SliderRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void SliderRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         // Draw the track
         if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
         {
             if (m_slider->m_mouseHover && m_textureTrackHover.isLoaded())
-                target.draw(m_textureTrackHover, states);
+                commands.addTexture(transform, m_textureTrackHover);
             else
-                target.draw(m_textureTrackNormal, states);
+                commands.addTexture(transform, m_textureTrackNormal);
         }
         else // There are no textures
         {
@@ -731,7 +749,7 @@ namespace tgui
             else
                 track.setFillColor(calcColorOpacity(m_trackColorNormal, m_slider->getOpacity()));
 
-            target.draw(track, states);
+            commands.addShape(transform, track);
         }
 
         // Draw the borders around the track and thumb
@@ -746,22 +764,22 @@ namespace tgui
                 sf::RectangleShape border({m_borders.left, size[i].y + m_borders.top});
                 border.setPosition(position[i].x - m_borders.left, position[i].y - m_borders.top);
                 border.setFillColor(calcColorOpacity(m_borderColor, m_slider->getOpacity()));
-                target.draw(border, states);
+                commands.addShape(transform, border);
 
                 // Draw top border
                 border.setSize({size[i].x + m_borders.right, m_borders.top});
                 border.setPosition(position[i].x, position[i].y - m_borders.top);
-                target.draw(border, states);
+                commands.addShape(transform, border);
 
                 // Draw right border
                 border.setSize({m_borders.right, size[i].y + m_borders.bottom});
                 border.setPosition(position[i].x + size[i].x, position[i].y);
-                target.draw(border, states);
+                commands.addShape(transform, border);
 
                 // Draw bottom border
                 border.setSize({size[i].x + m_borders.left, m_borders.bottom});
                 border.setPosition(position[i].x - m_borders.left, position[i].y + size[i].y);
-                target.draw(border, states);
+                commands.addShape(transform, border);
             }
         }
 
@@ -769,9 +787,9 @@ namespace tgui
         if (m_textureTrackNormal.isLoaded() && m_textureThumbNormal.isLoaded())
         {
             if (m_slider->m_mouseHover && m_textureThumbHover.isLoaded())
-                target.draw(m_textureThumbHover, states);
+                commands.addTexture(transform, m_textureThumbHover);
             else
-                target.draw(m_textureThumbNormal, states);
+                commands.addTexture(transform, m_textureThumbNormal);
         }
         else // There are no textures
         {
@@ -783,7 +801,7 @@ namespace tgui
             else
                 thumb.setFillColor(calcColorOpacity(m_thumbColorNormal, m_slider->getOpacity()));
 
-            target.draw(thumb, states);
+            commands.addShape(transform, thumb);
         }
     }
 
@@ -26,6 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/SpinButton.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -35,7 +36,7 @@ namespace tgui
 
     SpinButton::SpinButton()
     {
-        m_callback.widgetType = "SpinButton";
+        setWidgetType(WidgetType::SpinButton);
 
         addSignal<int>("ValueChanged");
 
@@ -161,7 +162,9 @@ namespace tgui
         {
             m_value = value;
 
-            m_callback.value = m_value;
+            if (m_callback)
+                m_callback->value = m_value;
+
             sendSignal("ValueChanged", value);
         }
     }
@@ -343,9 +346,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void SpinButton::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
+    {
+        getRenderer()->emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void SpinButton::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
-        getRenderer()->draw(target, states);
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -622,7 +632,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SpinButtonRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void SpinButtonRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         sf::Vector2f position = m_spinButton->getPosition();
         sf::Vector2f size = m_spinButton->getSize();
@@ -631,14 +641,14 @@ namespace tgui
         if (m_textureArrowUpNormal.isLoaded() && m_textureArrowDownNormal.isLoaded())
         {
             if (m_spinButton->m_mouseHover && m_spinButton->m_mouseHoverOnTopArrow && m_textureArrowUpHover.isLoaded())
-                target.draw(m_textureArrowUpHover, states);
+                commands.addTexture(transform, m_textureArrowUpHover);
             else
-                target.draw(m_textureArrowUpNormal, states);
+                commands.addTexture(transform, m_textureArrowUpNormal);
 
             if (m_spinButton->m_mouseHover && !m_spinButton->m_mouseHoverOnTopArrow && m_textureArrowDownHover.isLoaded())
-                target.draw(m_textureArrowDownHover, states);
+                commands.addTexture(transform, m_textureArrowDownHover);
             else
-                target.draw(m_textureArrowDownNormal, states);
+                commands.addTexture(transform, m_textureArrowDownNormal);
         }
         else // There are no images
         {
@@ -674,8 +684,8 @@ namespace tgui
                 arrow.setPoint(2, {arrowBack.getPosition().x + (arrowBack.getSize().x * 4/5), arrowBack.getPosition().y + (arrowBack.getSize().y * 4/5)});
             }
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            commands.addShape(transform, arrowBack);
+            commands.addShape(transform, arrow);
 
             if (m_spinButton->m_mouseHover && !m_spinButton->m_mouseHoverOnTopArrow)
             {
@@ -705,8 +715,8 @@ namespace tgui
                 arrow.setPoint(2, {arrowBack.getPosition().x + (arrowBack.getSize().x / 5), arrowBack.getPosition().y + (arrowBack.getSize().y * 4/5)});
             }
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            commands.addShape(transform, arrowBack);
+            commands.addShape(transform, arrow);
         }
 
         // Draw the space between the arrows if needed
@@ -725,7 +735,7 @@ namespace tgui
             }
 
             space.setFillColor(calcColorOpacity(m_borderColor, m_spinButton->getOpacity()));
-            target.draw(space, states);
+            commands.addShape(transform, space);
         }
 
         // Draw the borders around the spin button
@@ -735,22 +745,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_spinButton->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
     }
 
@@ -26,7 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Tab.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 #include <cmath>
 
@@ -38,7 +38,7 @@ namespace tgui
 
     Tab::Tab()
     {
-        m_callback.widgetType = "Tab";
+        setWidgetType(WidgetType::Tab);
 
         addSignal<sf::String>("TabSelected");
 
@@ -258,7 +258,9 @@ namespace tgui
         m_tabTexts[m_selectedTab].setTextColor(calcColorOpacity(getRenderer()->m_selectedTextColor, getOpacity()));
 
         // Send the callback
-        m_callback.text = m_tabTexts[index].getText();
+        if (m_callback)
+            m_callback->text = m_tabTexts[index].getText();
+
         sendSignal("TabSelected", m_tabTexts[index].getText());
     }
 
@@ -523,10 +525,10 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Tab::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void Tab::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Draw the background
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
         // Draw the text
         float accumulatedTabWidth = 0;
@@ -535,16 +537,24 @@ namespace tgui
             // Only apply clipping if required for this tab
             if (m_tabTexts[i].getSize().x > m_tabWidth[i] - 2 * getRenderer()->m_distanceToSide)
             {
-                Clipping clipping{target, states, {getPosition().x + accumulatedTabWidth + getRenderer()->m_distanceToSide, getPosition().y}, {m_tabWidth[i] - (2 * getRenderer()->m_distanceToSide), m_tabHeight}};
-                target.draw(m_tabTexts[i], states);
+                commands.pushClip(transform, {getPosition().x + accumulatedTabWidth + getRenderer()->m_distanceToSide, getPosition().y, m_tabWidth[i] - (2 * getRenderer()->m_distanceToSide), m_tabHeight});
+                m_tabTexts[i].emitRenderCommands(commands, transform);
+                commands.popClip();
             }
             else // Draw text without clipping
-                target.draw(m_tabTexts[i], states);
+                m_tabTexts[i].emitRenderCommands(commands, transform);
 
             accumulatedTabWidth += m_tabWidth[i] + ((getRenderer()->getBorders().left + getRenderer()->getBorders().right) / 2.0f);
         }
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tab::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -778,7 +788,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TabRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void TabRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         float positionX = m_tab->getPosition().x;
         auto textureNormalIt = m_texturesNormal.cbegin();
@@ -788,9 +798,9 @@ namespace tgui
             if (m_textureNormal.isLoaded() && m_textureSelected.isLoaded())
             {
                 if (m_tab->m_selectedTab == static_cast<int>(i))
-                    target.draw(*textureSelectedIt, states);
+                    commands.addTexture(transform, *textureSelectedIt);
                 else
-                    target.draw(*textureNormalIt, states);
+                    commands.addTexture(transform, *textureNormalIt);
 
                 textureNormalIt++;
                 textureSelectedIt++;
@@ -805,7 +815,7 @@ namespace tgui
                 else
                     background.setFillColor(calcColorOpacity(m_backgroundColor, m_tab->getOpacity()));
 
-                target.draw(background, states);
+                commands.addShape(transform, background);
             }
 
             // If there are borders then also draw them between the tabs
@@ -814,7 +824,7 @@ namespace tgui
                 sf::RectangleShape border({(m_borders.left + m_borders.right / 2.0f), m_tab->m_tabHeight});
                 border.setPosition(positionX + m_tab->m_tabWidth[i], m_tab->getPosition().y);
                 border.setFillColor(calcColorOpacity(m_borderColor, m_tab->getOpacity()));
-                target.draw(border, states);
+                commands.addShape(transform, border);
             }
 
             // Position the next tab
@@ -831,22 +841,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_tab->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
     }
 
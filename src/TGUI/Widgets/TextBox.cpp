@@ -28,23 +28,149 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
-#include <TGUI/Clipping.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 #include <cassert>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads a UTF-8 encoded stream in chunks, either when asked for the next chunk or ahead of time on a worker thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TextStreamLoader
+        {
+        public:
+
+            TextStreamLoader(std::unique_ptr<std::istream> stream, bool useWorkerThread) :
+                m_stream{std::move(stream)}
+            {
+                if (useWorkerThread)
+                    m_thread = std::thread{&TextStreamLoader::readAhead, this};
+            }
+
+            ~TextStreamLoader()
+            {
+                if (m_thread.joinable())
+                {
+                    {
+                        std::lock_guard<std::mutex> lock{m_mutex};
+                        m_stopRequested = true;
+                    }
+
+                    m_chunkTaken.notify_one();
+                    m_thread.join();
+                }
+            }
+
+            // Gets the next chunk of text, which is left empty when the worker thread has nothing ready yet.
+            // Returns false when the stream has been read completely and there are no more chunks to come.
+            bool read(sf::String& text)
+            {
+                if (!m_thread.joinable())
+                {
+                    text = readChunk(m_finished);
+                    return !m_finished;
+                }
+
+                std::lock_guard<std::mutex> lock{m_mutex};
+                if (!m_chunks.empty())
+                {
+                    text = std::move(m_chunks.front());
+                    m_chunks.pop_front();
+                    m_chunkTaken.notify_one();
+                }
+
+                return !m_finished || !m_chunks.empty();
+            }
+
+        private:
+
+            sf::String readChunk(bool& finished)
+            {
+                std::string bytes = std::move(m_incompleteCharacter);
+                const std::size_t oldSize = bytes.size();
+
+                bytes.resize(oldSize + ChunkSize);
+                m_stream->read(&bytes[oldSize], ChunkSize);
+                bytes.resize(oldSize + static_cast<std::size_t>(m_stream->gcount()));
+                finished = !*m_stream;
+
+                // A character may be split over two chunks, its first bytes are kept until the rest has been read
+                std::size_t end = bytes.size();
+                if (!finished)
+                {
+                    for (std::size_t i = 1; i <= std::min<std::size_t>(3, bytes.size()); ++i)
+                    {
+                        const unsigned char byte = static_cast<unsigned char>(bytes[bytes.size() - i]);
+                        if ((byte & 0xC0) == 0x80)
+                            continue;
+
+                        const std::size_t characterLength = (byte >= 0xF0) ? 4 : ((byte >= 0xE0) ? 3 : ((byte >= 0xC0) ? 2 : 1));
+                        if (characterLength > i)
+                            end = bytes.size() - i;
+
+                        break;
+                    }
+                }
+
+                m_incompleteCharacter = bytes.substr(end);
+                return sf::String::fromUtf8(bytes.begin(), bytes.begin() + end);
+            }
+
+            void readAhead()
+            {
+                bool finished = false;
+                while (!finished)
+                {
+                    sf::String text = readChunk(finished);
+
+                    std::unique_lock<std::mutex> lock{m_mutex};
+                    m_chunkTaken.wait(lock, [this]{ return m_stopRequested || (m_chunks.size() < MaxQueuedChunks); });
+                    if (m_stopRequested)
+                        return;
+
+                    m_chunks.push_back(std::move(text));
+                    m_finished = finished;
+                }
+            }
+
+        private:
+
+            static const std::size_t ChunkSize = 64 * 1024;
+            static const std::size_t MaxQueuedChunks = 16;
+
+            std::unique_ptr<std::istream> m_stream;
+            std::string m_incompleteCharacter;
+
+            std::thread m_thread;
+            std::mutex m_mutex;
+            std::condition_variable m_chunkTaken;
+            std::deque<sf::String> m_chunks;
+            bool m_stopRequested = false;
+            bool m_finished = false;
+        };
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     TextBox::TextBox()
     {
-        m_callback.widgetType = "TextBox";
+        setWidgetType(WidgetType::TextBox);
         m_draggableWidget = true;
 
         addSignal<sf::String>("TextChanged");
+        addSignal("TextLoaded");
 
         m_renderer = std::make_shared<TextBoxRenderer>(this);
         reload();
@@ -63,6 +189,9 @@ namespace tgui
         m_maxChars           {scrollbarToCopy.m_maxChars},
         m_topLine            {scrollbarToCopy.m_topLine},
         m_visibleLines       {scrollbarToCopy.m_visibleLines},
+        m_firstDisplayedLine {scrollbarToCopy.m_firstDisplayedLine},
+        m_endDisplayedLine   {scrollbarToCopy.m_endDisplayedLine},
+        m_displayedTextOutdated{scrollbarToCopy.m_displayedTextOutdated},
         m_selStart           {scrollbarToCopy.m_selStart},
         m_selEnd             {scrollbarToCopy.m_selEnd},
         m_caretPosition      {scrollbarToCopy.m_caretPosition},
@@ -92,9 +221,13 @@ namespace tgui
             std::swap(m_textSize,            temp.m_textSize);
             std::swap(m_lineHeight,          temp.m_lineHeight);
             std::swap(m_lines,               temp.m_lines);
+            std::swap(m_textLoader,          temp.m_textLoader);
             std::swap(m_maxChars,            temp.m_maxChars);
             std::swap(m_topLine,             temp.m_topLine);
             std::swap(m_visibleLines,        temp.m_visibleLines);
+            std::swap(m_firstDisplayedLine,  temp.m_firstDisplayedLine);
+            std::swap(m_endDisplayedLine,    temp.m_endDisplayedLine);
+            std::swap(m_displayedTextOutdated, temp.m_displayedTextOutdated);
             std::swap(m_selStart,            temp.m_selStart);
             std::swap(m_selEnd,              temp.m_selEnd);
             std::swap(m_caretPosition,       temp.m_caretPosition);
@@ -166,55 +299,74 @@ namespace tgui
             float textShiftY = getTextVerticalCorrection(getFont(), getTextSize());
             Padding padding = getRenderer()->getScaledPadding();
 
+            m_visibleLines = std::min(static_cast<std::size_t>((getSize().y - padding.top - padding.bottom) / m_lineHeight), m_lines.size());
+
+            // Store which area is visible
+            if (m_scroll != nullptr)
+            {
+                m_topLine = m_scroll->getValue() / m_lineHeight;
+
+                // The scrollbar may be standing between lines in which case one more line is visible
+                if (((static_cast<unsigned int>(getSize().y - padding.top - padding.bottom) % m_lineHeight) != 0) || ((m_scroll->getValue() % m_lineHeight) != 0))
+                    m_visibleLines++;
+            }
+            else // There is no scrollbar
+            {
+                m_topLine = 0;
+                m_visibleLines = std::min(static_cast<std::size_t>((getSize().y - padding.top - padding.bottom) / m_lineHeight), m_lines.size());
+            }
+
+            // The text objects only contain the lines around the visible ones
+            if (m_displayedTextOutdated || (m_topLine < m_firstDisplayedLine) || (std::min(m_topLine + m_visibleLines, m_lines.size()) > m_endDisplayedLine))
+                updateDisplayedText();
+
             // Position the caret
             {
-                tempText.setString(m_lines[m_selEnd.y].substring(0, m_selEnd.x));
+                tempText.setString(getLine(m_selEnd.y).substring(0, m_selEnd.x));
 
                 float kerning = 0;
-                if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
-                    kerning = m_font->getKerning(m_lines[m_selEnd.y][m_selEnd.x-1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
+                if ((m_selEnd.x > 0) && (m_selEnd.x < getLine(m_selEnd.y).getSize()))
+                    kerning = priv::TextMetrics{m_font, m_textSize}.getKerning(getLine(m_selEnd.y)[m_selEnd.x-1], getLine(m_selEnd.y)[m_selEnd.x]);
 
-                m_caretPosition = {getPosition().x + padding.left + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning,
+                m_caretPosition = {getPosition().x + padding.left + priv::findCharacterPos(tempText, m_font, tempText.getString().getSize()).x + kerning,
                                    getPosition().y + padding.top + (m_selEnd.y * m_lineHeight)};
 
             }
 
             // Calculate the position of the text objects
             m_selectionRects.clear();
-            m_textBeforeSelection.setPosition({getPosition().x + padding.left, getPosition().y + padding.top - textShiftY});
-            if (m_selStart != m_selEnd)
-            {
-                auto selectionStart = m_selStart;
-                auto selectionEnd = m_selEnd;
-
-                if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                    std::swap(selectionStart, selectionEnd);
+            m_textBeforeSelection.setPosition({getPosition().x + padding.left, getPosition().y + padding.top + (m_firstDisplayedLine * m_lineHeight) - textShiftY});
 
+            sf::Vector2<std::size_t> selectionStart;
+            sf::Vector2<std::size_t> selectionEnd;
+            getDisplayedSelection(selectionStart, selectionEnd);
+            if (selectionStart != selectionEnd)
+            {
                 float kerningSelectionStart = 0;
-                if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
-                    kerningSelectionStart = m_font->getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSize);
+                if ((selectionStart.x > 0) && (selectionStart.x < getLine(selectionStart.y).getSize()))
+                    kerningSelectionStart = priv::TextMetrics{m_font, m_textSize}.getKerning(getLine(selectionStart.y)[selectionStart.x-1], getLine(selectionStart.y)[selectionStart.x]);
 
                 float kerningSelectionEnd = 0;
-                if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
-                    kerningSelectionEnd = m_font->getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
+                if ((selectionEnd.x > 0) && (selectionEnd.x < getLine(selectionEnd.y).getSize()))
+                    kerningSelectionEnd = priv::TextMetrics{m_font, m_textSize}.getKerning(getLine(selectionEnd.y)[selectionEnd.x-1], getLine(selectionEnd.y)[selectionEnd.x]);
 
                 if (selectionStart.x > 0)
                 {
-                    m_textSelection1.setPosition({m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                                  m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                    m_textSelection1.setPosition({priv::findCharacterPos(m_textBeforeSelection, m_font, m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
+                                                  m_textBeforeSelection.getPosition().y + ((selectionStart.y - m_firstDisplayedLine) * m_lineHeight)});
                 }
                 else
-                    m_textSelection1.setPosition({getPosition().x + padding.left, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                    m_textSelection1.setPosition({getPosition().x + padding.left, m_textBeforeSelection.getPosition().y + ((selectionStart.y - m_firstDisplayedLine) * m_lineHeight)});
 
                 m_textSelection2.setPosition({getPosition().x + padding.left, getPosition().y + padding.top + ((selectionStart.y + 1) * m_lineHeight) - textShiftY});
 
                 if ((m_textSelection2.getString() != "") || (m_textSelection1.getString()[m_textSelection1.getString().getSize()-1] == '\n'))
                 {
-                    m_textAfterSelection1.setPosition({m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
+                    m_textAfterSelection1.setPosition({priv::findCharacterPos(m_textSelection2, m_font, m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
                                                        m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
                 }
                 else
-                    m_textAfterSelection1.setPosition({m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd, m_textSelection1.getPosition().y});
+                    m_textAfterSelection1.setPosition({priv::findCharacterPos(m_textSelection1, m_font, m_textSelection1.getString().getSize()).x + kerningSelectionEnd, m_textSelection1.getPosition().y});
 
                 m_textAfterSelection2.setPosition({getPosition().x + padding.left, getPosition().y + padding.top + ((selectionEnd.y + 1) * m_lineHeight) - textShiftY});
 
@@ -222,12 +374,12 @@ namespace tgui
                 {
                     m_selectionRects.push_back({m_textSelection1.getPosition().x, getPosition().y + padding.top + (selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
 
-                    if ((!m_lines[selectionStart.y].isEmpty()) && (m_lines[selectionStart.y] != "\n"))
+                    if ((!getLine(selectionStart.y).isEmpty()) && ((getLine(selectionStart.y).getSize() > 1) || !getLine(selectionStart.y).endsWithNewline()))
                     {
                         if (m_textSelection1.getString()[m_textSelection1.getString().getSize()-1] == '\n')
-                            m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()-1).x - m_textSelection1.getPosition().x;
+                            m_selectionRects.back().width = priv::findCharacterPos(m_textSelection1, m_font, m_textSelection1.getString().getSize()-1).x - m_textSelection1.getPosition().x;
                         else
-                            m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x - m_textSelection1.getPosition().x;
+                            m_selectionRects.back().width = priv::findCharacterPos(m_textSelection1, m_font, m_textSelection1.getString().getSize()).x - m_textSelection1.getPosition().x;
 
                         // There is kerning when the selection is on just this line
                         if (selectionStart.y == selectionEnd.y)
@@ -242,14 +394,14 @@ namespace tgui
                     {
                         m_selectionRects.push_back({m_textSelection2.getPosition().x, getPosition().y + padding.top + (i * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
 
-                        if ((!m_lines[i].isEmpty()) && (m_lines[i] != "\n"))
+                        if ((!getLine(i).isEmpty()) && ((getLine(i).getSize() > 1) || !getLine(i).endsWithNewline()))
                         {
-                            tempText.setString(m_lines[i]);
+                            tempText.setString(getLine(i));
 
                             if (tempText.getString()[tempText.getString().getSize()-1] == '\n')
-                                m_selectionRects.back().width = tempText.findCharacterPos(tempText.getString().getSize()-1).x;
+                                m_selectionRects.back().width = priv::findCharacterPos(tempText, m_font, tempText.getString().getSize()-1).x;
                             else
-                                m_selectionRects.back().width = tempText.findCharacterPos(tempText.getString().getSize()).x;
+                                m_selectionRects.back().width = priv::findCharacterPos(tempText, m_font, tempText.getString().getSize()).x;
                         }
                         else
                             m_selectionRects.back().width = 2;
@@ -257,9 +409,9 @@ namespace tgui
 
                     if (m_textSelection2.getString() != "")
                     {
-                        tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
+                        tempText.setString(getLine(selectionEnd.y).substring(0, selectionEnd.x));
                         m_selectionRects.push_back({m_textSelection2.getPosition().x, getPosition().y + padding.top + (selectionEnd.y * m_lineHeight),
-                                                    tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
+                                                    priv::findCharacterPos(tempText, m_font, tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
                     }
                 }
             }
@@ -280,23 +432,6 @@ namespace tgui
 
                 m_caretPosition = {m_caretPosition.x, m_caretPosition.y - m_scroll->getValue()};
             }
-
-            m_visibleLines = std::min(static_cast<std::size_t>((getSize().y - padding.top - padding.bottom) / m_lineHeight), m_lines.size());
-
-            // Store which area is visible
-            if (m_scroll != nullptr)
-            {
-                m_topLine = m_scroll->getValue() / m_lineHeight;
-
-                // The scrollbar may be standing between lines in which case one more line is visible
-                if (((static_cast<unsigned int>(getSize().y - padding.top - padding.bottom) % m_lineHeight) != 0) || ((m_scroll->getValue() % m_lineHeight) != 0))
-                    m_visibleLines++;
-            }
-            else // There is no scrollbar
-            {
-                m_topLine = 0;
-                m_visibleLines = std::min(static_cast<std::size_t>((getSize().y - padding.top - padding.bottom) / m_lineHeight), m_lines.size());
-            }
         }
         else // There is no font, so there can't be calculations
         {
@@ -359,6 +494,7 @@ namespace tgui
 
     void TextBox::setText(const sf::String& text)
     {
+        m_textLoader = nullptr;
         m_text = text;
 
         rearrangeText(false);
@@ -368,14 +504,60 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        appendText(text, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::loadTextFromFile(const std::string& filename, bool useWorkerThread)
+    {
+        std::unique_ptr<std::istream> file{new std::ifstream{filename, std::ios::in | std::ios::binary}};
+        if (!*file)
+            throw Exception{"Failed to open '" + filename + "' to load the text of the TextBox."};
+
+        loadTextFromStream(std::move(file), useWorkerThread);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::loadTextFromStream(std::unique_ptr<std::istream> stream, bool useWorkerThread)
+    {
+        setText("");
+        m_textLoader = std::make_shared<priv::TextStreamLoader>(std::move(stream), useWorkerThread);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBox::isLoadingText() const
+    {
+        return m_textLoader != nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String TextBox::getSelectedText() const
     {
-        return m_textSelection1.getString() + m_textSelection2.getString();
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        if (selectionStart.y == selectionEnd.y)
+            return getLine(selectionStart.y).substring(selectionStart.x, selectionEnd.x - selectionStart.x);
+
+        // Lines that were split by the word-wrap are separated by a newline as well
+        sf::String text = getLine(selectionStart.y).substring(selectionStart.x);
+        if (!getLine(selectionStart.y).endsWithNewline() && !getLine(selectionStart.y).isEmpty())
+            text += '\n';
+
+        for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
+        {
+            text += getLine(i);
+            if (!getLine(i).endsWithNewline())
+                text += '\n';
+        }
+
+        return text + getLine(selectionEnd.y).substring(0, selectionEnd.x);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -396,7 +578,7 @@ namespace tgui
 
         // Calculate the height of one line
         if (m_font)
-            m_lineHeight = static_cast<unsigned int>(m_font->getLineSpacing(m_textSize));
+            m_lineHeight = static_cast<unsigned int>(priv::TextMetrics{m_font, m_textSize}.getLineSpacing());
         else
             m_lineHeight = 0;
 
@@ -528,14 +710,14 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 // If the click was to the right of the end of line then make sure to select the word on the left
-                if (m_lines[m_selStart.y].getSize() > 1 && (m_selStart.x == (m_lines[m_selStart.y].getSize()-1) || m_selStart.x == m_lines[m_selStart.y].getSize()))
+                if (getLine(m_selStart.y).getSize() > 1 && (m_selStart.x == (getLine(m_selStart.y).getSize()-1) || m_selStart.x == getLine(m_selStart.y).getSize()))
                 {
                     m_selStart.x--;
                     m_selEnd.x = m_selStart.x;
                 }
 
                 bool selectingWhitespace;
-                if (isWhitespace(m_lines[m_selStart.y][m_selStart.x]))
+                if (isWhitespace(getLine(m_selStart.y)[m_selStart.x]))
                     selectingWhitespace = true;
                 else
                     selectingWhitespace = false;
@@ -546,7 +728,7 @@ namespace tgui
                 {
                     for (std::size_t i = m_selStart.x; i > 0; --i)
                     {
-                        if (selectingWhitespace != isWhitespace(m_lines[m_selStart.y][i-1]))
+                        if (selectingWhitespace != isWhitespace(getLine(m_selStart.y)[i-1]))
                         {
                             m_selStart.x = i;
                             done = true;
@@ -563,7 +745,7 @@ namespace tgui
                             if (m_selStart.y > 0)
                             {
                                 m_selStart.y--;
-                                m_selStart.x = m_lines[m_selStart.y].getSize();
+                                m_selStart.x = getLine(m_selStart.y).getSize();
                             }
                             else
                                 break;
@@ -571,7 +753,7 @@ namespace tgui
                     }
                     else
                     {
-                        if (m_selStart.x == m_lines[m_selStart.y].getSize())
+                        if (m_selStart.x == getLine(m_selStart.y).getSize())
                         {
                             m_selStart.y++;
                             m_selStart.x = 0;
@@ -584,21 +766,21 @@ namespace tgui
                 done = false;
                 for (std::size_t j = m_selEnd.y; j < m_lines.size(); ++j)
                 {
-                    for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].getSize(); ++i)
+                    for (std::size_t i = m_selEnd.x; i < getLine(m_selEnd.y).getSize(); ++i)
                     {
-                        if (selectingWhitespace != isWhitespace(m_lines[m_selEnd.y][i]))
+                        if (selectingWhitespace != isWhitespace(getLine(m_selEnd.y)[i]))
                         {
                             m_selEnd.x = i;
                             done = true;
                             break;
                         }
                         else
-                            m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                            m_selEnd.x = getLine(m_selEnd.y).getSize();
                     }
 
                     if (!done)
                     {
-                        if (!selectingWhitespace && m_selEnd.x == m_lines[m_selEnd.y].getSize())
+                        if (!selectingWhitespace && m_selEnd.x == getLine(m_selEnd.y).getSize())
                         {
                             if (m_selEnd.y + 1 < m_lines.size())
                             {
@@ -611,10 +793,10 @@ namespace tgui
                     }
                     else
                     {
-                        if (m_selEnd.x == m_lines[m_selEnd.y].getSize())
+                        if (m_selEnd.x == getLine(m_selEnd.y).getSize())
                         {
                             m_selEnd.y--;
-                            m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                            m_selEnd.x = getLine(m_selEnd.y).getSize();
                         }
                         break;
                     }
@@ -797,7 +979,7 @@ namespace tgui
                 if (m_selEnd.y < m_lines.size()-1)
                     m_selEnd = findCaretPosition({m_caretPosition.x, m_caretPosition.y + m_lineHeight});
                 else
-                    m_selEnd = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+                    m_selEnd = sf::Vector2<std::size_t>(getLine(m_lines.size()-1).getSize(), m_lines.size()-1);
 
                 if (!event.shift)
                     m_selStart = m_selEnd;
@@ -819,7 +1001,7 @@ namespace tgui
                         {
                             if (skippedWhitespace)
                             {
-                                if (isWhitespace(m_lines[m_selEnd.y][i-1]))
+                                if (isWhitespace(getLine(m_selEnd.y)[i-1]))
                                 {
                                     m_selEnd.x = i;
                                     done = true;
@@ -828,7 +1010,7 @@ namespace tgui
                             }
                             else
                             {
-                                if (!isWhitespace(m_lines[m_selEnd.y][i-1]))
+                                if (!isWhitespace(getLine(m_selEnd.y)[i-1]))
                                     skippedWhitespace = true;
                             }
                         }
@@ -838,10 +1020,10 @@ namespace tgui
                             if (m_selEnd.y > 0)
                             {
                                 m_selEnd.y--;
-                                if (!m_lines[m_selEnd.y].isEmpty() && m_lines[m_selEnd.y][m_lines[m_selEnd.y].getSize()-1] == '\n')
+                                if (getLine(m_selEnd.y).endsWithNewline())
                                 {
                                     if (!skippedWhitespace)
-                                        m_selEnd.x = m_lines[m_selEnd.y].getSize()-1;
+                                        m_selEnd.x = getLine(m_selEnd.y).getSize()-1;
                                     else
                                     {
                                         m_selEnd.x = 0;
@@ -850,7 +1032,7 @@ namespace tgui
                                     }
                                 }
                                 else
-                                    m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                                    m_selEnd.x = getLine(m_selEnd.y).getSize();
                             }
                             else
                             {
@@ -872,7 +1054,7 @@ namespace tgui
                         if (m_selEnd.y > 0)
                         {
                             m_selEnd.y--;
-                            m_selEnd.x = m_lines[m_selEnd.y].getSize() - 1;
+                            m_selEnd.x = getLine(m_selEnd.y).getSize() - 1;
                         }
                     }
                 }
@@ -894,11 +1076,11 @@ namespace tgui
                     bool done = false;
                     for (std::size_t j = m_selEnd.y; j < m_lines.size(); ++j)
                     {
-                        for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].getSize(); ++i)
+                        for (std::size_t i = m_selEnd.x; i < getLine(m_selEnd.y).getSize(); ++i)
                         {
                             if (skippedWhitespace)
                             {
-                                if (isWhitespace(m_lines[m_selEnd.y][i]))
+                                if (isWhitespace(getLine(m_selEnd.y)[i]))
                                 {
                                     m_selEnd.x = i;
                                     done = true;
@@ -907,7 +1089,7 @@ namespace tgui
                             }
                             else
                             {
-                                if (!isWhitespace(m_lines[m_selEnd.y][i]))
+                                if (!isWhitespace(getLine(m_selEnd.y)[i]))
                                     skippedWhitespace = true;
                             }
                         }
@@ -924,10 +1106,10 @@ namespace tgui
                             }
                             else
                             {
-                                if (!m_lines[m_selEnd.y].isEmpty() && (m_lines[m_selEnd.y][m_lines[m_selEnd.y].getSize()-1] == '\n'))
-                                    m_selEnd.x = m_lines[m_selEnd.y].getSize() - 1;
+                                if (getLine(m_selEnd.y).endsWithNewline())
+                                    m_selEnd.x = getLine(m_selEnd.y).getSize() - 1;
                                 else
-                                    m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                                    m_selEnd.x = getLine(m_selEnd.y).getSize();
                             }
                         }
                         else
@@ -937,7 +1119,7 @@ namespace tgui
                 else
                 {
                     // Move to the next line if you are at the end of the line
-                    if ((m_selEnd.x == m_lines[m_selEnd.y].getSize()) || ((m_selEnd.x+1 == m_lines[m_selEnd.y].getSize()) && (m_lines[m_selEnd.y][m_selEnd.x] == '\n')))
+                    if ((m_selEnd.x == getLine(m_selEnd.y).getSize()) || ((m_selEnd.x+1 == getLine(m_selEnd.y).getSize()) && (getLine(m_selEnd.y)[m_selEnd.x] == '\n')))
                     {
                         if (m_selEnd.y < m_lines.size()-1)
                         {
@@ -973,13 +1155,13 @@ namespace tgui
             case sf::Keyboard::End:
             {
                 if (event.control)
-                    m_selEnd = {m_lines[m_lines.size()-1].getSize(), m_lines.size()-1};
+                    m_selEnd = {getLine(m_lines.size()-1).getSize(), m_lines.size()-1};
                 else
                 {
-                    if (!m_lines[m_selEnd.y].isEmpty() && (m_lines[m_selEnd.y][m_lines[m_selEnd.y].getSize()-1] == '\n'))
-                        m_selEnd.x = m_lines[m_selEnd.y].getSize() - 1;
+                    if (getLine(m_selEnd.y).endsWithNewline())
+                        m_selEnd.x = getLine(m_selEnd.y).getSize() - 1;
                     else
-                        m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                        m_selEnd.x = getLine(m_selEnd.y).getSize();
                 }
 
                 if (!event.shift)
@@ -1032,10 +1214,10 @@ namespace tgui
                         m_selEnd.y = m_selEnd.y + visibleLines - 2;
                 }
 
-                if (!m_lines[m_selEnd.y].isEmpty() && (m_lines[m_selEnd.y][m_lines[m_selEnd.y].getSize()-1] == '\n'))
-                    m_selEnd.x = m_lines[m_selEnd.y].getSize() - 1;
+                if (getLine(m_selEnd.y).endsWithNewline())
+                    m_selEnd.x = getLine(m_selEnd.y).getSize() - 1;
                 else
-                    m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                    m_selEnd.x = getLine(m_selEnd.y).getSize();
 
                 if (!event.shift)
                     m_selStart = m_selEnd;
@@ -1069,7 +1251,7 @@ namespace tgui
                         if (m_selEnd.y > 0)
                         {
                             m_selEnd.y--;
-                            m_selEnd.x = m_lines[m_selEnd.y].getSize() - 1;
+                            m_selEnd.x = getLine(m_selEnd.y).getSize() - 1;
                         }
                         else // You are at the beginning of the text
                             break;
@@ -1086,7 +1268,9 @@ namespace tgui
                 m_caretVisible = true;
                 m_animationTimeElapsed = {};
 
-                m_callback.text = m_text;
+                if (m_callback)
+                    m_callback->text = m_text;
+
                 sendSignal("TextChanged", m_text);
                 break;
             }
@@ -1100,7 +1284,7 @@ namespace tgui
                 if (m_selStart == m_selEnd)
                 {
                     // Delete the next character on this line
-                    if (m_selEnd.x == m_lines[m_selEnd.y].getSize())
+                    if (m_selEnd.x == getLine(m_selEnd.y).getSize())
                     {
                         // Delete a character from the line below you
                         if (m_selEnd.y < m_lines.size()-1)
@@ -1120,7 +1304,9 @@ namespace tgui
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
 
-                m_callback.text = m_text;
+                if (m_callback)
+                    m_callback->text = m_text;
+
                 sendSignal("TextChanged", m_text);
                 break;
             }
@@ -1130,7 +1316,7 @@ namespace tgui
                 if (event.control && !event.alt && !event.shift && !event.system)
                 {
                     m_selStart = {0, 0};
-                    m_selEnd = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+                    m_selEnd = sf::Vector2<std::size_t>(getLine(m_lines.size()-1).getSize(), m_lines.size()-1);
                     updateSelectionTexts();
                 }
 
@@ -1140,7 +1326,7 @@ namespace tgui
             case sf::Keyboard::C:
             {
                 if (event.control && !event.alt && !event.shift && !event.system)
-                    Clipboard::set(m_textSelection1.getString() + m_textSelection2.getString());
+                    Clipboard::set(getSelectedText());
 
                 break;
             }
@@ -1149,7 +1335,7 @@ namespace tgui
             {
                 if (event.control && !event.alt && !event.shift && !event.system && !m_readOnly)
                 {
-                    Clipboard::set(m_textSelection1.getString() + m_textSelection2.getString());
+                    Clipboard::set(getSelectedText());
                     deleteSelectedCharacters();
                 }
 
@@ -1168,13 +1354,15 @@ namespace tgui
                         deleteSelectedCharacters();
 
                         m_text.insert(findTextCaretPosition().first, clipboardContents);
-                        m_lines[m_selStart.y].insert(m_selStart.x, clipboardContents);
+                        m_lines[m_selStart.y].length += clipboardContents.getSize();
 
                         m_selStart.x += clipboardContents.getSize();
                         m_selEnd = m_selStart;
                         rearrangeText(true);
 
-                        m_callback.text = m_text;
+                        if (m_callback)
+                            m_callback->text = m_text;
+
                         sendSignal("TextChanged", m_text);
                     }
                 }
@@ -1209,7 +1397,7 @@ namespace tgui
             std::size_t caretPosition = findTextCaretPosition().first;
 
             m_text.insert(caretPosition, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, key);
+            m_lines[m_selEnd.y].length++;
 
             m_selStart.x++;
             m_selEnd.x++;
@@ -1247,7 +1435,9 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        m_callback.text = m_text;
+        if (m_callback)
+            m_callback->text = m_text;
+
         sendSignal("TextChanged", m_text);
     }
 
@@ -1322,7 +1512,7 @@ namespace tgui
 
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_font == nullptr))
-            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+            return sf::Vector2<std::size_t>(getLine(m_lines.size()-1).getSize(), m_lines.size()-1);
 
         // Find on which line the mouse is
         std::size_t lineNumber;
@@ -1343,23 +1533,24 @@ namespace tgui
 
         // Check if you clicked behind everything
         if (lineNumber + 1 > m_lines.size())
-            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+            return sf::Vector2<std::size_t>(getLine(m_lines.size()-1).getSize(), m_lines.size()-1);
 
         // Find between which character the mouse is standing
+        priv::TextMetrics metrics{m_font, getTextSize()};
         float width = 0;
         sf::Uint32 prevChar = 0;
-        for (std::size_t i = 0; i < m_lines[lineNumber].getSize(); ++i)
+        for (std::size_t i = 0; i < getLine(lineNumber).getSize(); ++i)
         {
             float charWidth;
-            sf::Uint32 curChar = m_lines[lineNumber][i];
+            sf::Uint32 curChar = getLine(lineNumber)[i];
             if (curChar == '\n')
-                return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber);
+                return sf::Vector2<std::size_t>(getLine(lineNumber).getSize() - 1, lineNumber);
             else if (curChar == '\t')
-                charWidth = static_cast<float>(m_font->getGlyph(' ', getTextSize(), false).advance) * 4;
+                charWidth = metrics.getAdvance(' ') * 4;
             else
-                charWidth = static_cast<float>(m_font->getGlyph(curChar, getTextSize(), false).advance);
+                charWidth = metrics.getAdvance(curChar);
 
-            float kerning = static_cast<float>(m_font->getKerning(prevChar, curChar, getTextSize()));
+            float kerning = metrics.getKerning(prevChar, curChar);
             if (width + charWidth + kerning <= position.x)
                 width += charWidth + kerning;
             else
@@ -1374,45 +1565,15 @@ namespace tgui
         }
 
         // You clicked behind the last character
-        return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize(), lineNumber);
+        return sf::Vector2<std::size_t>(getLine(lineNumber).getSize(), lineNumber);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::pair<std::size_t, std::size_t> TextBox::findTextCaretPosition()
     {
-        // This function is used to count the amount of characters spread over several lines
-        auto count = [this](std::size_t low, std::size_t high)
-        {
-            std::size_t counter = 0;
-            for (std::size_t i = low; i < high; ++i)
-            {
-                counter += m_lines[i].getSize();
-/*
-                // THIS CODE SHOULD ONLY BE UNCOMMENTED TOGETHER WITH THE CODE IN rearrangeText
-                // If the next line starts with just a space, then the space need not be visible
-                if ((counter + 1 < m_text.getSize()) && (m_text[counter] == ' ') && (!isWhitespace(m_text[counter + 1])))
-                {
-                    if ((counter == 0) || (!isWhitespace(m_text[counter-1])))
-                        counter++;
-                }
-*/
-            }
-            return counter;
-        };
-
-        std::pair<std::size_t, std::size_t> textCaretPosition{0, 0};
-
-        // Find the location in the text where the selection starts
-        textCaretPosition.first = count(0, m_selStart.y) + m_selStart.x;
-
-        // Find the location in the text where the selection ends
-        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-            textCaretPosition.second = textCaretPosition.first - count(m_selEnd.y, m_selStart.y) + m_selEnd.x - m_selStart.x;
-        else
-            textCaretPosition.second = textCaretPosition.first + count(m_selStart.y, m_selEnd.y) + m_selEnd.x - m_selStart.x;
-
-        return textCaretPosition;
+        // The lines know where they start in the text, so there is no need to count the characters on the lines above
+        return {m_lines[m_selStart.y].start + m_selStart.x, m_lines[m_selEnd.y].start + m_selEnd.x};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1446,21 +1607,84 @@ namespace tgui
         if ((m_lineHeight == 0) || (m_font == nullptr))
             return;
 
-        sf::Vector2<std::size_t> newSelStart;
-        sf::Vector2<std::size_t> newSelEnd;
-        bool newSelStartFound = false;
-        bool newSelEndFound = false;
         auto textCaretPosition = findTextCaretPosition();
-        Padding padding = getRenderer()->getScaledPadding();
-
-        // Find the maximum width of one line
-        float maxLineWidth = std::max(0.f, getSize().x - padding.left - padding.right);
-        if (m_scroll && (!m_scroll->getAutoHide() || (m_scroll->getMaximum() > m_scroll->getLowValue())))
-            maxLineWidth = std::max(0.f, maxLineWidth - m_scroll->getSize().x);
 
         // Split the text over multiple lines
         m_lines.clear();
+        splitLines(0, getMaximumLineWidth());
+
+        restoreSelection(textCaretPosition, keepSelection);
+
+        // We may have to recalculate what we just calculated if the scrollbar just appeared or disappeared
+        if (!updateScrollbarMaximum())
+        {
+            rearrangeText(true);
+            return;
+        }
+
+        updateSelectionTexts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::appendText(const sf::String& text, bool keepSelection)
+    {
+        // The text will be split over the lines once there is a font
+        if ((m_lineHeight == 0) || (m_font == nullptr))
+        {
+            m_text += text;
+            return;
+        }
+
+        auto textCaretPosition = findTextCaretPosition();
+        m_text += text;
+
+        // The lines above the last one can't change by adding text behind them, only the last line has to be split again
+        if (m_lines.back().length == 0)
+            m_lines.pop_back();
+
         std::size_t index = 0;
+        if (!m_lines.empty())
+        {
+            index = m_lines.back().start + m_lines.back().length;
+            if (!getLine(m_lines.size()-1).endsWithNewline())
+            {
+                index = m_lines.back().start;
+                m_lines.pop_back();
+            }
+        }
+
+        splitLines(index, getMaximumLineWidth());
+        restoreSelection(textCaretPosition, keepSelection);
+
+        // All lines have to be split again when the scrollbar appeared
+        if (!updateScrollbarMaximum())
+        {
+            rearrangeText(true);
+            return;
+        }
+
+        // Adding text should not scroll back to the caret when it is kept where it was
+        if (keepSelection && m_scroll)
+        {
+            const unsigned int scrollbarValue = m_scroll->getValue();
+            updateSelectionTexts();
+
+            if (m_scroll->getValue() != scrollbarValue)
+            {
+                m_scroll->setValue(scrollbarValue);
+                updatePosition();
+            }
+        }
+        else
+            updateSelectionTexts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::splitLines(std::size_t index, float maxLineWidth)
+    {
+        priv::TextMetrics metrics{m_font, getTextSize()};
         while (index < m_text.getSize())
         {
             std::size_t oldIndex = index;
@@ -1477,11 +1701,11 @@ namespace tgui
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = static_cast<float>(m_font->getGlyph(' ', getTextSize(), false).advance) * 4;
+                    charWidth = metrics.getAdvance(' ') * 4;
                 else
-                    charWidth = static_cast<float>(m_font->getGlyph(curChar, getTextSize(), false).advance);
+                    charWidth = metrics.getAdvance(curChar);
 
-                float kerning = static_cast<float>(m_font->getKerning(prevChar, curChar, getTextSize()));
+                float kerning = metrics.getKerning(prevChar, curChar);
                 if (width + charWidth + kerning <= maxLineWidth)
                 {
                     width += charWidth + kerning;
@@ -1517,59 +1741,50 @@ namespace tgui
                 }
             }
 
-            if (!newSelStartFound && (index >= textCaretPosition.first))
-            {
-                newSelStartFound = true;
+            m_lines.push_back({oldIndex, index - oldIndex});
+        }
+    }
 
-                // When standing behind a newline, you should be at the line below this one
-                if ((textCaretPosition.first > 0) && (m_text[textCaretPosition.first-1] == '\n'))
-                    newSelStart = sf::Vector2<std::size_t>(0, m_lines.size() + 1);
-                else
-                {
-                    // The text caret position is the same when the caret is at the beginning or at the end of a line
-                    if ((index == textCaretPosition.first) && (index < m_text.getSize()) && (m_selStart.x == 0))
-                        newSelStart = sf::Vector2<std::size_t>(0, m_lines.size() + 1);
-                    else
-                        newSelStart = sf::Vector2<std::size_t>(textCaretPosition.first - oldIndex, m_lines.size());
-                }
-            }
-            if (!newSelEndFound && (index >= textCaretPosition.second))
-            {
-                newSelEndFound = true;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                // When standing behind a newline, you should be at the line below this one
-                if ((textCaretPosition.second > 0) && (m_text[textCaretPosition.second-1] == '\n'))
-                    newSelEnd = sf::Vector2<std::size_t>(0, m_lines.size() + 1);
-                else
-                {
-                    // The text caret position is the same when the caret is at the beginning or at the end of a line
-                    if ((index == textCaretPosition.second) && (index < m_text.getSize()) && (m_selEnd.x == 0))
-                        newSelEnd = sf::Vector2<std::size_t>(0, m_lines.size() + 1);
-                    else
-                        newSelEnd = sf::Vector2<std::size_t>(textCaretPosition.second - oldIndex, m_lines.size());
-                }
-            }
+    void TextBox::restoreSelection(const std::pair<std::size_t, std::size_t>& textCaretPosition, bool keepSelection)
+    {
+        // Finds the line on which a position in the text ends up, based on the lines that were just split
+        auto findPosition = [this](std::size_t textPosition, std::size_t oldX, sf::Vector2<std::size_t>& newPosition)
+        {
+            auto it = std::lower_bound(m_lines.begin(), m_lines.end(), textPosition,
+                                       [](const Line& line, std::size_t position){ return line.start + line.length < position; });
+            if (it == m_lines.end())
+                return false;
 
-            m_lines.push_back(m_text.substring(oldIndex, index - oldIndex));
-/*
-            // THIS CODE MESSES UP newSelStart AND newSelEnd
-            // THIS CODE SHOULD ONLY BE UNCOMMENTED TOGETHER WITH THE CODE IN findTextCaretPosition
-            // If the next line starts with just a space, then the space need not be visible
-            if ((index + 1 < m_text.getSize()) && (m_text[index] == ' ') && (!isWhitespace(m_text[index + 1])))
-            {
-                if ((index == 0) || (!isWhitespace(m_text[index-1])))
-                    index++;
-            }
-*/
-        }
+            const std::size_t lineNumber = it - m_lines.begin();
+            const std::size_t lineEnd = it->start + it->length;
+
+            // When standing behind a newline, you should be at the line below this one
+            if ((textPosition > 0) && (m_text[textPosition-1] == '\n'))
+                newPosition = {0, lineNumber + 1};
+
+            // The text caret position is the same when the caret is at the beginning or at the end of a line
+            else if ((lineEnd == textPosition) && (lineEnd < m_text.getSize()) && (oldX == 0))
+                newPosition = {0, lineNumber + 1};
+            else
+                newPosition = {textPosition - it->start, lineNumber};
+
+            return true;
+        };
+
+        sf::Vector2<std::size_t> newSelStart;
+        sf::Vector2<std::size_t> newSelEnd;
+        bool newSelStartFound = findPosition(textCaretPosition.first, m_selStart.x, newSelStart);
+        bool newSelEndFound = findPosition(textCaretPosition.second, m_selEnd.x, newSelEnd);
 
         // There is always one line, even if it is empty
         if (m_lines.empty())
-            m_lines.push_back("");
+            m_lines.push_back({0, 0});
 
         // If the last line ends with a newline, then add an extra line
-        if ((!m_lines.back().isEmpty()) && (m_lines.back()[m_lines.back().getSize()-1] == '\n'))
-            m_lines.push_back("");
+        if (getLine(m_lines.size()-1).endsWithNewline())
+            m_lines.push_back({m_text.getSize(), 0});
 
         // Correct the caret positions
         if (keepSelection && newSelStartFound && newSelEndFound)
@@ -1579,10 +1794,28 @@ namespace tgui
         }
         else // The text has changed too much, the selection can't be kept
         {
-            m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+            m_selStart = sf::Vector2<std::size_t>(getLine(m_lines.size()-1).getSize(), m_lines.size()-1);
             m_selEnd = m_selStart;
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float TextBox::getMaximumLineWidth() const
+    {
+        Padding padding = getRenderer()->getScaledPadding();
+
+        float maxLineWidth = std::max(0.f, getSize().x - padding.left - padding.right);
+        if (m_scroll && (!m_scroll->getAutoHide() || (m_scroll->getMaximum() > m_scroll->getLowValue())))
+            maxLineWidth = std::max(0.f, maxLineWidth - m_scroll->getSize().x);
+
+        return maxLineWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBox::updateScrollbarMaximum()
+    {
         // Tell the scrollbar how many pixels the text contains
         if (m_scroll != nullptr)
         {
@@ -1590,34 +1823,88 @@ namespace tgui
 
             m_scroll->setMaximum(static_cast<unsigned int>(m_lines.size() * m_lineHeight));
 
-            // We may have to recalculate what we just calculated if the scrollbar just appeared or disappeared
+            // The available width for the lines changes when the scrollbar appears or disappears
             if (m_scroll->getAutoHide())
-            {
-                if (invisibleScrollbar != (m_scroll->getMaximum() <= m_scroll->getLowValue()))
-                {
-                    rearrangeText(true);
-                    return;
-                }
-            }
+                return invisibleScrollbar == (m_scroll->getMaximum() <= m_scroll->getLowValue());
         }
 
-        updateSelectionTexts();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::updateSelectionTexts()
     {
+        // The text objects are filled again by updatePosition
+        m_displayedTextOutdated = true;
+
+        // Check if the caret is located above or below the view
+        if (m_scroll != nullptr)
+        {
+            if (m_selEnd.y <= m_topLine)
+                m_scroll->setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
+            else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
+                m_scroll->setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight) - m_scroll->getLowValue()));
+        }
+
+        updatePosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::getDisplayedSelection(sf::Vector2<std::size_t>& selectionStart, sf::Vector2<std::size_t>& selectionEnd) const
+    {
+        selectionStart = m_selStart;
+        selectionEnd = m_selEnd;
+
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        // The parts of the selection outside the displayed lines are left out
+        auto limitPosition = [this](sf::Vector2<std::size_t>& position)
+        {
+            if (position.y < m_firstDisplayedLine)
+                position = {0, m_firstDisplayedLine};
+            else if (position.y >= m_endDisplayedLine)
+            {
+                const auto lastLine = getLine(m_endDisplayedLine - 1);
+                position = {lastLine.getSize() - (lastLine.endsWithNewline() ? 1 : 0), m_endDisplayedLine - 1};
+            }
+        };
+
+        limitPosition(selectionStart);
+        limitPosition(selectionEnd);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateDisplayedText()
+    {
+        m_displayedTextOutdated = false;
+
+        // One page above and below the visible lines is also added, so that scrolling doesn't have to update the text each time
+        m_firstDisplayedLine = (m_topLine > m_visibleLines) ? (m_topLine - m_visibleLines) : 0;
+        m_endDisplayedLine = std::min(m_topLine + 2 * m_visibleLines, m_lines.size());
+        if (m_endDisplayedLine <= m_firstDisplayedLine)
+        {
+            m_firstDisplayedLine = std::min(m_firstDisplayedLine, m_lines.size() - 1);
+            m_endDisplayedLine = m_firstDisplayedLine + 1;
+        }
+
+        sf::Vector2<std::size_t> selectionStart;
+        sf::Vector2<std::size_t> selectionEnd;
+        getDisplayedSelection(selectionStart, selectionEnd);
+
         // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
+        if (selectionStart == selectionEnd)
         {
             sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
+            for (std::size_t i = m_firstDisplayedLine; i < m_endDisplayedLine; ++i)
             {
-                if (((m_lines[i] != "") && (m_lines[i][m_lines[i].getSize()-1] == '\n')) || (i == m_lines.size()-1))
-                    displayedText += m_lines[i];
+                if ((getLine(i).endsWithNewline()) || (i == m_endDisplayedLine-1))
+                    displayedText += getLine(i);
                 else
-                    displayedText += m_lines[i] + "\n";
+                    displayedText += sf::String(getLine(i)) + "\n";
             }
 
             m_textBeforeSelection.setString(displayedText);
@@ -1628,84 +1915,67 @@ namespace tgui
         }
         else // Some text is selected
         {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
             // Set the text before the selection
-            if (selectionStart.y > 0)
+            if (selectionStart.y > m_firstDisplayedLine)
             {
                 sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
+                for (std::size_t i = m_firstDisplayedLine; i < selectionStart.y; ++i)
                 {
-                    if ((m_lines[i] != "") && (m_lines[i][m_lines[i].getSize()-1] == '\n'))
-                        string += m_lines[i];
+                    if (getLine(i).endsWithNewline())
+                        string += getLine(i);
                     else
-                        string += m_lines[i] + "\n";
+                        string += sf::String(getLine(i)) + "\n";
                 }
 
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
+                string += getLine(selectionStart.y).substring(0, selectionStart.x);
                 m_textBeforeSelection.setString(string);
             }
             else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
+                m_textBeforeSelection.setString(getLine(selectionStart.y).substring(0, selectionStart.x));
 
             // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
+            if (selectionStart.y == selectionEnd.y)
             {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
+                m_textSelection1.setString(getLine(selectionStart.y).substring(selectionStart.x, selectionEnd.x - selectionStart.x));
                 m_textSelection2.setString("");
             }
             else
             {
-                if (!m_lines[selectionStart.y].isEmpty() && (m_lines[selectionStart.y][m_lines[selectionStart.y].getSize()-1] != '\n') && (selectionEnd.y > selectionStart.y))
-                    m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x) + '\n');
+                if (!getLine(selectionStart.y).isEmpty() && (getLine(selectionStart.y)[getLine(selectionStart.y).getSize()-1] != '\n') && (selectionEnd.y > selectionStart.y))
+                    m_textSelection1.setString(getLine(selectionStart.y).substring(selectionStart.x, getLine(selectionStart.y).getSize() - selectionStart.x) + '\n');
                 else
-                    m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
+                    m_textSelection1.setString(getLine(selectionStart.y).substring(selectionStart.x, getLine(selectionStart.y).getSize() - selectionStart.x));
 
                 sf::String string;
                 for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
                 {
-                    if ((m_lines[i] != "") && (m_lines[i][m_lines[i].getSize()-1] == '\n'))
-                        string += m_lines[i];
+                    if (getLine(i).endsWithNewline())
+                        string += getLine(i);
                     else
-                        string += m_lines[i] + "\n";
+                        string += sf::String(getLine(i)) + "\n";
                 }
 
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
+                string += getLine(selectionEnd.y).substring(0, selectionEnd.x);
 
                 m_textSelection2.setString(string);
             }
 
             // Set the text after the selection
             {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
+                m_textAfterSelection1.setString(getLine(selectionEnd.y).substring(selectionEnd.x, getLine(selectionEnd.y).getSize() - selectionEnd.x));
 
                 sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
+                for (std::size_t i = selectionEnd.y + 1; i < m_endDisplayedLine; ++i)
                 {
-                    if (((m_lines[i] != "") && (m_lines[i][m_lines[i].getSize()-1] == '\n')) || (i == m_lines.size()-1))
-                        string += m_lines[i];
+                    if ((getLine(i).endsWithNewline()) || (i == m_endDisplayedLine-1))
+                        string += getLine(i);
                     else
-                        string += m_lines[i] + "\n";
+                        string += sf::String(getLine(i)) + "\n";
                 }
 
                 m_textAfterSelection2.setString(string);
             }
         }
-
-        // Check if the caret is located above or below the view
-        if (m_scroll != nullptr)
-        {
-            if (m_selEnd.y <= m_topLine)
-                m_scroll->setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
-            else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
-                m_scroll->setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight) - m_scroll->getLowValue()));
-        }
-
-        updatePosition();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1714,6 +1984,21 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
+        // Add the next part of the text that is being loaded
+        if (m_textLoader)
+        {
+            sf::String text;
+            const bool moreText = m_textLoader->read(text);
+            if (!text.isEmpty())
+                appendText(text, true);
+
+            if (!moreText)
+            {
+                m_textLoader = nullptr;
+                sendSignal("TextLoaded");
+            }
+        }
+
         // Only show/hide the caret every half second
         if (m_animationTimeElapsed >= sf::milliseconds(500))
         {
@@ -1751,16 +2036,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void TextBox::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Draw the background and borders
-        getRenderer()->draw(target, states);
+        getRenderer()->emitRenderCommands(commands, transform);
 
         // Draw the contents of the text box
         {
-            // Set the clipping for all draw calls that happen until this clipping object goes out of scope
+            // Clip the commands that follow to the inside of the padding
             Padding padding = getRenderer()->getScaledPadding();
-            Clipping clipping{target, states, {getPosition().x + padding.left, getPosition().y + padding.top}, {getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom}};
+            commands.pushClip(transform, {getPosition().x + padding.left, getPosition().y + padding.top, getSize().x - padding.left - padding.right, getSize().y - padding.top - padding.bottom});
 
             // Draw the background of the selected text
             for (auto& selectionRect : m_selectionRects)
@@ -1768,17 +2053,17 @@ namespace tgui
                 sf::RectangleShape rect{{selectionRect.width, selectionRect.height}};
                 rect.setPosition({selectionRect.left, selectionRect.top});
                 rect.setFillColor(calcColorOpacity(getRenderer()->m_selectedTextBgrColor, getOpacity()));
-                target.draw(rect, states);
+                commands.addShape(transform, rect);
             }
 
             // Draw the text
-            target.draw(m_textBeforeSelection, states);
+            commands.addText(transform, m_textBeforeSelection, m_font);
             if (m_selStart != m_selEnd)
             {
-                target.draw(m_textSelection1, states);
-                target.draw(m_textSelection2, states);
-                target.draw(m_textAfterSelection1, states);
-                target.draw(m_textAfterSelection2, states);
+                commands.addText(transform, m_textSelection1, m_font);
+                commands.addText(transform, m_textSelection2, m_font);
+                commands.addText(transform, m_textAfterSelection1, m_font);
+                commands.addText(transform, m_textAfterSelection2, m_font);
             }
 
             // Only draw the caret if it has a width
@@ -1790,14 +2075,23 @@ namespace tgui
                     sf::RectangleShape caret({getRenderer()->m_caretWidth, static_cast<float>(m_lineHeight)});
                     caret.setPosition(m_caretPosition.x - (getRenderer()->m_caretWidth * 0.5f), static_cast<float>(m_caretPosition.y));
                     caret.setFillColor(calcColorOpacity(getRenderer()->m_caretColor, getOpacity()));
-                    target.draw(caret, states);
+                    commands.addShape(transform, caret);
                 }
             }
+
+            commands.popClip();
         }
 
         // Draw the scrollbar if there is one
         if (m_scroll != nullptr)
-            target.draw(*m_scroll, states);
+            m_scroll->emitRenderCommands(commands, transform);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2026,17 +2320,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBoxRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void TextBoxRenderer::emitRenderCommands(RenderCommandList& commands, const sf::Transform& transform) const
     {
         // Draw the background
         if (m_backgroundTexture.isLoaded())
-            target.draw(m_backgroundTexture, states);
+            commands.addTexture(transform, m_backgroundTexture);
         else
         {
             sf::RectangleShape background(m_textBox->getSize());
             background.setPosition(m_textBox->getPosition());
             background.setFillColor(calcColorOpacity(m_backgroundColor, m_textBox->getOpacity()));
-            target.draw(background, states);
+            commands.addShape(transform, background);
         }
 
         // Draw the borders
@@ -2049,22 +2343,22 @@ namespace tgui
             sf::RectangleShape border({m_borders.left, size.y + m_borders.top});
             border.setPosition(position.x - m_borders.left, position.y - m_borders.top);
             border.setFillColor(calcColorOpacity(m_borderColor, m_textBox->getOpacity()));
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw top border
             border.setSize({size.x + m_borders.right, m_borders.top});
             border.setPosition(position.x, position.y - m_borders.top);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw right border
             border.setSize({m_borders.right, size.y + m_borders.bottom});
             border.setPosition(position.x + size.x, position.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
 
             // Draw bottom border
             border.setSize({size.x + m_borders.left, m_borders.bottom});
             border.setPosition(position.x - m_borders.left, position.y + size.y);
-            target.draw(border, states);
+            commands.addShape(transform, border);
         }
     }
 
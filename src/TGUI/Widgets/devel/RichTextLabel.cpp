@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/devel/RichTextLabel.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -79,7 +80,7 @@ namespace tgui
 
     RichTextLabel::RichTextLabel()
     {
-        m_callback.widgetType = "RichTextLabel";
+        setWidgetType(WidgetType::RichTextLabel);
 
         m_background.setFillColor(sf::Color::Transparent);
 
@@ -390,13 +391,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RichTextLabel::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void RichTextLabel::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         if (m_background.getFillColor() != sf::Color::Transparent)
-            target.draw(m_background, states);
+            commands.addShape(transform, m_background);
 
         for(std::size_t i = 0; i < m_texts.size(); ++i)
-            target.draw(m_texts[i], states);
+            commands.addText(transform, m_texts[i], m_font);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RichTextLabel::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/devel/Table.hpp>
+#include <TGUI/RenderBackend.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -33,7 +34,7 @@ namespace tgui
 
     Table::Table()
     {
-        m_callback.widgetType = "Table";
+        setWidgetType(WidgetType::Table);
 
 /// TODO
 /*
@@ -273,30 +274,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Table::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void Table::emitRenderCommands(RenderCommandList& commands, sf::Transform transform) const
     {
         // Set the position
-        states.transform.translate(getPosition());
+        transform.translate(getPosition());
 
         // Draw the background
         if (m_backgroundColor != sf::Color::Transparent)
         {
             sf::RectangleShape background(getSize());
             background.setFillColor(m_backgroundColor);
-            target.draw(background, states);
+            commands.addShape(transform, background);
         }
 
         // Draw the widgets
-        target.draw(*m_header, states);
-        drawWidgetContainer(&target, states);
+        m_header->emitRenderCommands(commands, transform);
+        emitWidgetContainerCommands(commands, transform);
 
 /// TODO
 /*
-        target.draw(m_tableBorder, states);
-        //target.draw(m_headerSeparator, states);
+        commands.addShape(transform, m_tableBorder);
+        //commands.addShape(transform, m_headerSeparator);
 */
         for (std::size_t i = 0; i < m_columnsDelimitators.size(); ++i)
-            target.draw(m_columnsDelimitators[i], states);
+            commands.addShape(transform, m_columnsDelimitators[i]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Table::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawRenderCommands(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,7 +33,7 @@ namespace tgui
 
     TableItem::TableItem()
     {
-        m_callback.widgetType = "TableItem";
+        setWidgetType(WidgetType::TableItem);
         setBackgroundColor(sf::Color::Transparent);
     }
 
@@ -31,7 +31,7 @@ namespace tgui
 {
     TableRow::TableRow()
     {
-        m_callback.widgetType = "TableRow";
+        setWidgetType(WidgetType::TableRow);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
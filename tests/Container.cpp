@@ -225,6 +225,32 @@ TEST_CASE("[Container]") {
         REQUIRE(!editBox3->isFocused());
     }
 
+    SECTION("mouse capture") {
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->setPosition(50, 50);
+        panel->setSize(300, 100);
+
+        auto slider = std::make_shared<tgui::Slider>();
+        slider->setPosition(10, 10);
+        slider->setSize(200, 16);
+        slider->setMaximum(10);
+        slider->setValue(5);
+        panel->add(slider);
+
+        tgui::Widget::Ptr widget = panel;
+        widget->leftMousePressed(60, 68);
+        REQUIRE(slider->getValue() == 0);
+
+        // The slider keeps receiving the mouse move events while it is being dragged
+        widget->mouseMoved(500, 300);
+        REQUIRE(slider->getValue() == 10);
+
+        widget->leftMouseReleased(500, 300);
+        widget->mouseNoLongerDown();
+        widget->mouseMoved(60, 68);
+        REQUIRE(slider->getValue() == 10);
+    }
+
     SECTION("setOpacity") {
         REQUIRE(container->getOpacity() == 1);
 
@@ -0,0 +1,196 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Context.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/Loading/WidgetSaver.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+#include <algorithm>
+#include <thread>
+
+TEST_CASE("[Context]") {
+    tgui::Context& context = tgui::Context::getGlobal();
+    REQUIRE(&context == &tgui::Context::getGlobal());
+
+    SECTION("ResourcePath") {
+        REQUIRE(context.getResourcePath() == "");
+
+        context.setResourcePath("resources");
+        REQUIRE(context.getResourcePath() == "resources/");
+        REQUIRE(tgui::getResourcePath() == "resources/");
+
+        tgui::setResourcePath("");
+        REQUIRE(context.getResourcePath() == "");
+    }
+
+    SECTION("Textures") {
+        const std::size_t imageCount = context.getLoadedImageCount();
+        {
+            tgui::Texture texture1{"resources/image.png"};
+            tgui::Texture texture2{"resources/image.png"};
+            REQUIRE(context.getLoadedImageCount() == imageCount + 1);
+        }
+        REQUIRE(context.getLoadedImageCount() == imageCount);
+    }
+
+    SECTION("Theme resource path is only changed on the calling thread") {
+        auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+        tgui::Button::Ptr button = theme->load("Button");
+        REQUIRE(button->getRenderer()->getProperty("NormalImage").getTexture().getId() == "resources/Black.png");
+        REQUIRE(context.getResourcePath() == "");
+    }
+
+    SECTION("Multiple threads") {
+        const unsigned int threadCount = 4;
+        const unsigned int connectionsPerThread = 50;
+
+        std::vector<std::vector<unsigned int>> ids(threadCount);
+        std::vector<int> succeeded(threadCount, 0);
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([i,&ids,&succeeded]{
+                auto theme = std::make_shared<tgui::Theme>("resources/ThemeButton1.txt");
+                tgui::Button::Ptr button = theme->load("Button1");
+
+                unsigned int count = 0;
+                for (unsigned int j = 0; j < connectionsPerThread; ++j)
+                    ids[i].push_back(button->connect("Pressed", [&count]{ count++; }));
+
+                tgui::Texture texture{"resources/image.png"};
+
+                button->getRenderer()->setProperty("NormalImage", "\"resources/image.png\"");
+                succeeded[i] = (button->getRenderer()->getProperty("TextColor").getColor() == sf::Color{255, 255, 0})
+                            && (texture.getData() != nullptr);
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        std::vector<unsigned int> allIds;
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            REQUIRE(succeeded[i]);
+            REQUIRE(ids[i].size() == connectionsPerThread);
+            allIds.insert(allIds.end(), ids[i].begin(), ids[i].end());
+        }
+
+        std::sort(allIds.begin(), allIds.end());
+        REQUIRE(std::unique(allIds.begin(), allIds.end()) == allIds.end());
+    }
+
+    SECTION("Loading, updating and drawing guis on multiple threads") {
+        std::string widgetFile;
+        {
+            auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+            auto parent = std::make_shared<tgui::Panel>();
+            for (unsigned int i = 0; i < 3; ++i)
+            {
+                auto panel = std::make_shared<tgui::Panel>();
+                parent->add(panel, "Panel" + tgui::to_string(i));
+
+                tgui::Button::Ptr button = theme->load("Button");
+                button->setText("Button " + tgui::to_string(i));
+                panel->add(button);
+
+                panel->add(theme->load("EditBox"), "EditBox");
+                panel->add(theme->load("Slider"));
+                panel->add(std::make_shared<tgui::Picture>("resources/image.png"));
+            }
+
+            std::stringstream stream;
+            parent->saveWidgetsToStream(stream);
+            widgetFile = stream.str();
+        }
+
+        auto loadUpdateAndDraw = [&widgetFile]{
+            sf::RenderTexture target;
+            target.create(400, 300);
+
+            tgui::Gui gui{target};
+            gui.setFont("resources/DroidSansArmenian.ttf");
+
+            for (unsigned int i = 0; i < 5; ++i)
+            {
+                // Replace the shared functions while other threads are using them
+                tgui::WidgetLoader::setLoadFunction("Slider", tgui::WidgetLoader::getLoadFunction("Slider"));
+                tgui::WidgetSaver::setSaveFunction("Slider", tgui::WidgetSaver::getSaveFunction("Slider"));
+                tgui::Serializer::setFunction(tgui::ObjectConverter::Type::Color,
+                                              tgui::Serializer::getFunction(tgui::ObjectConverter::Type::Color));
+                tgui::Deserializer::setFunction(tgui::ObjectConverter::Type::Color,
+                                                tgui::Deserializer::getFunction(tgui::ObjectConverter::Type::Color));
+
+                gui.removeAllWidgets();
+                std::stringstream input{widgetFile};
+                gui.loadWidgetsFromStream(input);
+
+                gui.updateTime(sf::milliseconds(16));
+                gui.draw();
+            }
+
+            std::stringstream output;
+            gui.getContainer()->saveWidgetsToStream(output);
+            return output.str();
+        };
+
+        const std::string expected = loadUpdateAndDraw();
+
+        tgui::Deserializer::enableCache();
+
+        const unsigned int threadCount = 4;
+        std::vector<std::string> savedFiles(threadCount);
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < threadCount; ++i)
+            threads.emplace_back([i,&savedFiles,&loadUpdateAndDraw]{ savedFiles[i] = loadUpdateAndDraw(); });
+
+        for (auto& thread : threads)
+            thread.join();
+
+        tgui::Deserializer::disableCache();
+
+        for (unsigned int i = 0; i < threadCount; ++i)
+            REQUIRE(savedFiles[i] == expected);
+    }
+
+    SECTION("clearCaches") {
+        auto theme = std::make_shared<tgui::Theme>("resources/ThemeButton1.txt");
+        REQUIRE_NOTHROW(theme->load("Button1"));
+
+        context.clearCaches();
+        REQUIRE_NOTHROW(theme->load("Button1"));
+    }
+}
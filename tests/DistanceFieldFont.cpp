@@ -0,0 +1,168 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/Widgets/Label.hpp>
+
+TEST_CASE("[DistanceFieldFont]") {
+    auto font = std::make_shared<sf::Font>();
+    font->loadFromFile("resources/DroidSansArmenian.ttf");
+
+    auto distanceFieldFont = tgui::priv::DistanceFieldFont::get(font);
+    REQUIRE(distanceFieldFont != nullptr);
+    REQUIRE(tgui::priv::DistanceFieldFont::get(font) == distanceFieldFont);
+    REQUIRE(distanceFieldFont->getTexture().getSize() == sf::Vector2u(tgui::priv::DistanceFieldFont::AtlasSize, tgui::priv::DistanceFieldFont::AtlasSize));
+
+    SECTION("Glyphs are shared between text sizes") {
+        sf::Text text{"HelloWorld", *font, 10};
+        const std::vector<sf::Vertex>* vertices = distanceFieldFont->getGeometry(text);
+        REQUIRE(vertices != nullptr);
+        REQUIRE(vertices->size() == 10 * 6);
+        REQUIRE(distanceFieldFont->getGlyphCount() == 7);
+        REQUIRE(distanceFieldFont->getGlyph('H', false) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyph('H', true) == nullptr);
+
+        for (unsigned int size = 11; size < 200; ++size)
+        {
+            text.setCharacterSize(size);
+            REQUIRE(distanceFieldFont->getGeometry(text) != nullptr);
+        }
+        REQUIRE(distanceFieldFont->getGlyphCount() == 7);
+
+        text.setStyle(sf::Text::Bold);
+        REQUIRE(distanceFieldFont->getGeometry(text) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyphCount() == 14);
+    }
+
+    SECTION("Unsupported text") {
+        sf::Text underlinedText{"Text", *font, 20};
+        underlinedText.setStyle(sf::Text::Underlined);
+        REQUIRE(distanceFieldFont->getGeometry(underlinedText) == nullptr);
+
+        sf::Font otherFont;
+        sf::Text otherText{"Text", otherFont, 20};
+        REQUIRE(distanceFieldFont->getGeometry(otherText) == nullptr);
+    }
+
+    SECTION("Many different characters") {
+        sf::String string;
+        for (sf::Uint32 c = 0x400; c < 0x1400; ++c)
+            string += c;
+
+        sf::Text text{string, *font, 30};
+        REQUIRE(distanceFieldFont->getGeometry(text) == nullptr);
+
+        // The glyphs that weren't used for the longest time make room for the new ones
+        text.setString("Text");
+        REQUIRE(distanceFieldFont->getGeometry(text) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyph('T', false) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyph('x', false) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyphCount() < 0x1000);
+    }
+
+    SECTION("Shared atlas") {
+        auto otherFont = std::make_shared<sf::Font>();
+        REQUIRE(otherFont->loadFromFile("resources/DroidSansArmenian.ttf"));
+        auto otherDistanceFieldFont = tgui::priv::DistanceFieldFont::get(otherFont);
+        REQUIRE(otherDistanceFieldFont != distanceFieldFont);
+        REQUIRE(&otherDistanceFieldFont->getTexture() == &distanceFieldFont->getTexture());
+
+        REQUIRE(distanceFieldFont->getGeometry(sf::Text{"Text", *font, 30}) != nullptr);
+        REQUIRE(otherDistanceFieldFont->getGeometry(sf::Text{"Text", *otherFont, 30}) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyph('T', false)->textureRect != otherDistanceFieldFont->getGlyph('T', false)->textureRect);
+    }
+
+    SECTION("Geometry cache") {
+        sf::Text text{"Cached", *font, 20};
+        const std::vector<sf::Vertex>* vertices = distanceFieldFont->getGeometry(text);
+        REQUIRE(vertices != nullptr);
+        const std::vector<sf::Vertex> oldVertices = *vertices;
+
+        // The same text returns the cached vertices
+        REQUIRE(distanceFieldFont->getGeometry(sf::Text{"Cached", *font, 20}) == vertices);
+
+        // The geometry is created again when the text changes
+        text.setCharacterSize(40);
+        vertices = distanceFieldFont->getGeometry(text);
+        REQUIRE(vertices != nullptr);
+        REQUIRE(vertices->size() == oldVertices.size());
+        REQUIRE(vertices->back().position.x == Approx(oldVertices.back().position.x * 2));
+
+        text.setString("Changed");
+        REQUIRE(distanceFieldFont->getGeometry(text)->size() == 7 * 6);
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        text.setFillColor(sf::Color::Red);
+#else
+        text.setColor(sf::Color::Red);
+#endif
+        REQUIRE(distanceFieldFont->getGeometry(text)->front().color == sf::Color::Red);
+
+        // Many different texts don't make the cache grow without limit
+        for (unsigned int i = 0; i < 2 * tgui::priv::DistanceFieldFont::MaxCachedGeometries; ++i)
+            REQUIRE(distanceFieldFont->getGeometry(sf::Text{std::to_string(i), *font, 20}) != nullptr);
+        REQUIRE(distanceFieldFont->getGeometry(sf::Text{"Cached", *font, 20})->size() == oldVertices.size());
+    }
+
+    SECTION("Metrics") {
+        tgui::priv::TextMetrics referenceMetrics{font, tgui::priv::DistanceFieldFont::ReferenceSize};
+        const float referenceAdvance = referenceMetrics.getAdvance('W');
+        const float referenceLineSpacing = referenceMetrics.getLineSpacing();
+
+        tgui::enableDistanceFieldText();
+        {
+            // Text is measured by scaling the glyphs at the reference size
+            tgui::priv::TextMetrics metrics{font, tgui::priv::DistanceFieldFont::ReferenceSize / 2};
+            REQUIRE(metrics.getAdvance('W') == Approx(referenceAdvance / 2));
+            REQUIRE(metrics.getLineSpacing() == Approx(referenceLineSpacing / 2));
+
+            // The positions match the geometry of the drawn text
+            sf::Text text{"WWW", *font, tgui::priv::DistanceFieldFont::ReferenceSize / 2};
+            text.setPosition(10, 20);
+            REQUIRE(tgui::priv::findCharacterPos(text, font, 2) == sf::Vector2f(10 + 2 * metrics.getAdvance('W'), 20));
+            REQUIRE(tgui::priv::findCharacterPos(text, font, 100) == sf::Vector2f(10 + 3 * metrics.getAdvance('W'), 20));
+
+            const sf::FloatRect bounds = tgui::priv::getTextBounds(text, font);
+            REQUIRE(bounds.width > 2 * metrics.getAdvance('W'));
+            REQUIRE(bounds.width <= 3 * metrics.getAdvance('W') + metrics.getWidth('W'));
+        }
+        tgui::disableDistanceFieldText();
+    }
+
+    SECTION("Drawing") {
+        tgui::enableDistanceFieldText();
+
+        auto label = std::make_shared<tgui::Label>();
+        label->setFont(font);
+        label->setText("Text");
+
+        sf::RenderTexture target;
+        target.create(100, 100);
+        REQUIRE_NOTHROW(target.draw(*label));
+
+        tgui::disableDistanceFieldText();
+    }
+}
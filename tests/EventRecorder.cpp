@@ -0,0 +1,216 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/EventReplayer.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+
+namespace
+{
+    void createWidgets(tgui::Gui& gui)
+    {
+        auto button = tgui::Button::create();
+        button->setPosition(10, 10);
+        button->setSize(100, 30);
+        gui.add(button, "Button");
+
+        auto editBox = tgui::EditBox::create();
+        editBox->setPosition(10, 60);
+        editBox->setSize(150, 30);
+        gui.add(editBox, "EditBox");
+    }
+
+    sf::Event mouseEvent(sf::Event::EventType type, int x, int y)
+    {
+        sf::Event event;
+        event.type = type;
+        if (type == sf::Event::MouseMoved)
+        {
+            event.mouseMove.x = x;
+            event.mouseMove.y = y;
+        }
+        else
+        {
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = x;
+            event.mouseButton.y = y;
+        }
+        return event;
+    }
+}
+
+TEST_CASE("[EventRecorder]") {
+    sf::RenderTexture target;
+    target.create(400, 300);
+
+    tgui::Gui gui{target};
+    createWidgets(gui);
+
+    auto recorder = tgui::EventRecorder::create();
+    gui.setEventRecorder(recorder);
+    REQUIRE(gui.getEventRecorder() == recorder);
+
+    unsigned int pressed = 0;
+    gui.get("Button")->connect("Pressed", [&](){ pressed++; });
+
+    gui.handleEvent(mouseEvent(sf::Event::MouseMoved, 20, 20));
+    gui.handleEvent(mouseEvent(sf::Event::MouseButtonPressed, 20, 20));
+    gui.handleEvent(mouseEvent(sf::Event::MouseButtonReleased, 20, 20));
+    gui.updateTime(sf::milliseconds(16));
+
+    gui.handleEvent(mouseEvent(sf::Event::MouseButtonPressed, 20, 70));
+    gui.handleEvent(mouseEvent(sf::Event::MouseButtonReleased, 20, 70));
+    sf::Event event;
+    event.type = sf::Event::TextEntered;
+    event.text.unicode = 'A';
+    gui.handleEvent(event);
+    event.text.unicode = 'B';
+    gui.handleEvent(event);
+    event.type = sf::Event::KeyPressed;
+    event.key.code = sf::Keyboard::BackSpace;
+    event.key.alt = false;
+    event.key.control = true;
+    event.key.shift = false;
+    event.key.system = false;
+    gui.handleEvent(event);
+    gui.updateTime(sf::milliseconds(17));
+
+    recorder->setPaused(true);
+    gui.updateTime(sf::milliseconds(5));
+    recorder->setPaused(false);
+    REQUIRE(!recorder->isPaused());
+
+    gui.handleEvent(mouseEvent(sf::Event::MouseMoved, -5, 300));
+
+    REQUIRE(pressed == 1);
+    REQUIRE(recorder->getEntries().size() == 11);
+    REQUIRE(!recorder->getEntries()[3].isEvent);
+    REQUIRE(recorder->getEntries()[3].elapsedTime == sf::milliseconds(16));
+
+    SECTION("Save and load") {
+        std::stringstream stream;
+        recorder->saveToStream(stream);
+
+        auto loaded = tgui::EventRecorder::create();
+        loaded->loadFromStream(stream);
+        REQUIRE(loaded->getEntries().size() == recorder->getEntries().size());
+
+        auto& entries = loaded->getEntries();
+        REQUIRE(entries[1].isEvent);
+        REQUIRE(entries[1].event.type == sf::Event::MouseButtonPressed);
+        REQUIRE(entries[1].event.mouseButton.button == sf::Mouse::Left);
+        REQUIRE(entries[1].event.mouseButton.x == 20);
+        REQUIRE(entries[4].event.mouseButton.y == 70);
+        REQUIRE(entries[6].event.text.unicode == 'A');
+        REQUIRE(entries[7].event.text.unicode == 'B');
+        REQUIRE(entries[8].event.key.code == sf::Keyboard::BackSpace);
+        REQUIRE(entries[8].event.key.control);
+        REQUIRE(!entries[8].event.key.shift);
+        REQUIRE(!entries[9].isEvent);
+        REQUIRE(entries[9].elapsedTime == sf::milliseconds(17));
+        REQUIRE(entries[10].event.mouseMove.x == -5);
+        REQUIRE(entries[10].event.mouseMove.y == 300);
+
+        // Every event only takes a few bytes
+        REQUIRE(stream.str().size() < 64);
+
+        recorder->saveToFile("EventRecording.rec");
+        loaded->clear();
+        REQUIRE(loaded->getEntries().empty());
+        loaded->loadFromFile("EventRecording.rec");
+        REQUIRE(loaded->getEntries().size() == recorder->getEntries().size());
+
+        REQUIRE_THROWS_AS(loaded->loadFromFile("NonExistentFile.rec"), tgui::Exception);
+
+        std::stringstream invalidHeader{"TGUIXYZ"};
+        REQUIRE_THROWS_AS(loaded->loadFromStream(invalidHeader), tgui::Exception);
+
+        std::string truncated = stream.str();
+        truncated.pop_back();
+        std::stringstream truncatedStream{truncated};
+        REQUIRE_THROWS_AS(loaded->loadFromStream(truncatedStream), tgui::Exception);
+    }
+
+    SECTION("Replay") {
+        sf::RenderTexture replayTarget;
+        replayTarget.create(400, 300);
+
+        tgui::Gui replayGui{replayTarget};
+        createWidgets(replayGui);
+
+        unsigned int replayPressed = 0;
+        replayGui.get("Button")->connect("Pressed", [&](){ replayPressed++; });
+
+        auto frames = tgui::EventReplayer::replay(*recorder, replayGui);
+        REQUIRE(replayPressed == 1);
+        REQUIRE(replayGui.get<tgui::EditBox>("EditBox")->isFocused());
+        REQUIRE(replayGui.get<tgui::EditBox>("EditBox")->getText() == "A");
+
+        REQUIRE(frames.size() == 3);
+        REQUIRE(frames[0].events == 3);
+        REQUIRE(frames[0].elapsedTime == sf::milliseconds(16));
+        REQUIRE(frames[1].events == 5);
+        REQUIRE(frames[1].elapsedTime == sf::milliseconds(17));
+        REQUIRE(frames[2].events == 1);
+        REQUIRE(frames[2].elapsedTime == sf::Time::Zero);
+
+        REQUIRE(frames[0].checksum != frames[1].checksum);
+        REQUIRE(frames[2].checksum == tgui::EventReplayer::getChecksum(gui));
+
+        // Replaying again on fresh widgets gives exactly the same widget trees
+        tgui::Gui secondGui{replayTarget};
+        createWidgets(secondGui);
+        auto secondFrames = tgui::EventReplayer::replay(*recorder, secondGui, false);
+        REQUIRE(secondFrames.size() == frames.size());
+        for (std::size_t i = 0; i < frames.size(); ++i)
+        {
+            REQUIRE(secondFrames[i].checksum == frames[i].checksum);
+            REQUIRE(secondFrames[i].drawDuration == sf::Time::Zero);
+        }
+    }
+
+    SECTION("Checksum") {
+        const auto checksum = tgui::EventReplayer::getChecksum(gui);
+        REQUIRE(checksum == tgui::EventReplayer::getChecksum(*gui.getContainer()));
+
+        gui.get("Button")->setPosition(11, 10);
+        REQUIRE(checksum != tgui::EventReplayer::getChecksum(gui));
+
+        gui.get("Button")->setPosition(10, 10);
+        REQUIRE(checksum == tgui::EventReplayer::getChecksum(gui));
+
+        // The checksum also depends on the contents of the widgets
+        gui.get<tgui::EditBox>("EditBox")->setText("B");
+        REQUIRE(checksum != tgui::EventReplayer::getChecksum(gui));
+
+        gui.get<tgui::EditBox>("EditBox")->setText("A");
+        REQUIRE(checksum == tgui::EventReplayer::getChecksum(gui));
+
+        gui.get("Button")->hide();
+        REQUIRE(checksum != tgui::EventReplayer::getChecksum(gui));
+    }
+}
@@ -0,0 +1,233 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/FlexLayout.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+
+#include <chrono>
+
+TEST_CASE("[FlexLayout]") {
+    auto layout = tgui::FlexLayout::create();
+    layout->setSize(400, 100);
+
+    auto widget1 = tgui::ClickableWidget::create({100, 40});
+    auto widget2 = tgui::ClickableWidget::create({50, 20});
+    layout->add(widget1);
+    layout->add(widget2);
+
+    SECTION("WidgetType") {
+        REQUIRE(layout->getWidgetType() == "FlexLayout");
+        REQUIRE(layout->getWidgetTypeId() == tgui::WidgetType::FlexLayout);
+    }
+
+    SECTION("Properties") {
+        REQUIRE(layout->getDirection() == tgui::FlexLayout::Direction::Row);
+        REQUIRE(!layout->getWrap());
+        REQUIRE(layout->getGap() == 0);
+        REQUIRE(layout->getJustify() == tgui::FlexLayout::Justify::Start);
+        REQUIRE(layout->getAlignment() == tgui::FlexLayout::Alignment::Stretch);
+
+        REQUIRE(layout->getGrow(widget1) == 0);
+        REQUIRE(layout->getShrink(widget1) == 1);
+        REQUIRE(layout->getBasis(widget1) == 100);
+
+        REQUIRE(layout->setGrow(widget1, 2));
+        REQUIRE(layout->setShrink(widget1, 3));
+        REQUIRE(layout->setBasis(widget1, 60));
+        REQUIRE(layout->getGrow(widget1) == 2);
+        REQUIRE(layout->getShrink(widget1) == 3);
+        REQUIRE(layout->getBasis(widget1) == 60);
+
+        REQUIRE(!layout->setGrow(nullptr, 1));
+        REQUIRE(layout->getGrow(nullptr) == 0);
+    }
+
+    SECTION("Row") {
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget1->getSize() == sf::Vector2f(100, 100));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(100, 0));
+        REQUIRE(widget2->getSize() == sf::Vector2f(50, 100));
+
+        layout->setGap(10);
+        REQUIRE(widget2->getPosition() == sf::Vector2f(110, 0));
+    }
+
+    SECTION("Column") {
+        layout->setDirection(tgui::FlexLayout::Direction::Column);
+        layout->setSize(100, 400);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget1->getSize() == sf::Vector2f(100, 40));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(0, 40));
+        REQUIRE(widget2->getSize() == sf::Vector2f(100, 20));
+    }
+
+    SECTION("Grow") {
+        layout->setGrow(widget1, 1);
+        layout->setGrow(widget2, 3);
+        REQUIRE(widget1->getSize() == sf::Vector2f(162.5f, 100));
+        REQUIRE(widget2->getSize() == sf::Vector2f(237.5f, 100));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(162.5f, 0));
+    }
+
+    SECTION("Shrink") {
+        layout->setSize(120, 100);
+        REQUIRE(widget1->getSize() == sf::Vector2f(80, 100));
+        REQUIRE(widget2->getSize() == sf::Vector2f(40, 100));
+
+        layout->setShrink(widget2, 0);
+        REQUIRE(widget1->getSize() == sf::Vector2f(70, 100));
+        REQUIRE(widget2->getSize() == sf::Vector2f(50, 100));
+    }
+
+    SECTION("Justify") {
+        layout->setJustify(tgui::FlexLayout::Justify::Center);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(125, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(225, 0));
+
+        layout->setJustify(tgui::FlexLayout::Justify::End);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(250, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(350, 0));
+
+        layout->setJustify(tgui::FlexLayout::Justify::SpaceBetween);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(350, 0));
+
+        layout->setJustify(tgui::FlexLayout::Justify::SpaceAround);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(62.5f, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(287.5f, 0));
+    }
+
+    SECTION("Alignment") {
+        layout->setAlignment(tgui::FlexLayout::Alignment::Start);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget1->getSize() == sf::Vector2f(100, 40));
+
+        layout->setAlignment(tgui::FlexLayout::Alignment::Center);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 30));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(100, 40));
+
+        layout->setAlignment(tgui::FlexLayout::Alignment::End);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 60));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(100, 80));
+    }
+
+    SECTION("Wrap") {
+        layout->setWrap(true);
+        layout->setGap(5);
+        layout->setSize(120, 100);
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget1->getSize() == sf::Vector2f(100, 40));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(0, 45));
+        REQUIRE(widget2->getSize() == sf::Vector2f(50, 20));
+
+        layout->setSize(155, 100);
+        REQUIRE(widget2->getPosition() == sf::Vector2f(105, 0));
+        REQUIRE(widget2->getSize() == sf::Vector2f(50, 40));
+    }
+
+    SECTION("Insert and remove") {
+        auto widget3 = tgui::ClickableWidget::create({30, 30});
+        REQUIRE(layout->insert(1, widget3));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(100, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(130, 0));
+
+        REQUIRE(layout->remove(widget1));
+        REQUIRE(!layout->remove(widget1));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(30, 0));
+
+        layout->removeAllWidgets();
+        REQUIRE(layout->getWidgets().empty());
+        REQUIRE(!layout->insert(5, widget1));
+    }
+
+    SECTION("Insert keeps names") {
+        layout->removeAllWidgets();
+        layout->add(widget1, "W1");
+        layout->add(widget2, "W2");
+
+        auto widget3 = tgui::ClickableWidget::create({30, 30});
+        REQUIRE(layout->insert(0, widget3, "W3"));
+        REQUIRE(layout->getWidgetNames().size() == 3);
+        REQUIRE(layout->getWidgetNames()[0] == "W3");
+        REQUIRE(layout->getWidgetNames()[1] == "W1");
+        REQUIRE(layout->getWidgetNames()[2] == "W2");
+        REQUIRE(layout->get("W3") == widget3);
+        REQUIRE(layout->getWidgetName(widget1) == "W1");
+        REQUIRE(layout->getWidgetName(widget3) == "W3");
+    }
+
+    SECTION("Only changed widgets are updated") {
+        unsigned int sizeCount1 = 0;
+        unsigned int sizeCount2 = 0;
+        widget1->connect("SizeChanged", [&](){ sizeCount1++; });
+        widget2->connect("SizeChanged", [&](){ sizeCount2++; });
+
+        layout->setGrow(widget2, 1);
+        REQUIRE(sizeCount1 == 0);
+        REQUIRE(sizeCount2 == 1);
+
+        layout->setSize(500, 100);
+        REQUIRE(sizeCount1 == 0);
+        REQUIRE(sizeCount2 == 2);
+    }
+
+    SECTION("Borders") {
+        auto button = tgui::Button::create();
+        button->getRenderer()->setBorders(2);
+        button->setSize(50, 20);
+        layout->add(button);
+        REQUIRE(button->getFullSize() == sf::Vector2f(54, 100));
+        REQUIRE(button->getPosition() == sf::Vector2f(152, 2));
+    }
+}
+
+TEST_CASE("[FlexLayout] resize benchmark", "[.benchmark]") {
+    auto measure = [](std::size_t count) {
+        auto layout = tgui::FlexLayout::create();
+        layout->setWrap(true);
+        layout->setGap(2);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({20.f + (i % 7) * 5, 20.f + (i % 3) * 5});
+            layout->add(widget);
+            layout->setGrow(widget, 1);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < 20; ++i)
+            layout->setSize(400.f + i * 37, 300.f);
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    const double smallTime = measure(1000);
+    const double largeTime = measure(8000);
+    WARN("Resizing 1000 children: " << smallTime * 1000 / 20 << "ms, 8000 children: " << largeTime * 1000 / 20 << "ms");
+
+    // Eight times as many children should take about eight times as long, far below the quadratic cost of chained layouts
+    REQUIRE(largeTime < smallTime * 20);
+}
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Font.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
 
 TEST_CASE("[Font]") {
     sf::Font font1;
@@ -35,3 +36,57 @@ TEST_CASE("[Font]") {
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DroidSansArmenian.ttf").getFont() != nullptr);
 }
+
+TEST_CASE("[Font] Preloading glyphs") {
+    tgui::Font font{"resources/DroidSansArmenian.ttf"};
+
+    SECTION("Immediately") {
+        REQUIRE_NOTHROW(font.preload(0x20, 0x7E, {12, 18, 24}));
+        REQUIRE_NOTHROW(font.preload("Text", {12}, true));
+        REQUIRE_NOTHROW(tgui::Font().preload(0x20, 0x7E, {12}));
+    }
+
+    SECTION("Distance field glyphs") {
+        auto distanceFieldFont = tgui::priv::DistanceFieldFont::get(font.getFont());
+        REQUIRE(distanceFieldFont->getGlyph('a', false) == nullptr);
+
+        tgui::enableDistanceFieldText();
+        font.preload('a', 'z', {12, 18, 24});
+        for (sf::Uint32 c = 'a'; c <= 'z'; ++c)
+            REQUIRE(distanceFieldFont->getGlyph(c, false) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyph('A', false) == nullptr);
+        REQUIRE(distanceFieldFont->getGlyph('a', true) == nullptr);
+
+        font.preloadIncrementally("ABC", {12, 18}, true);
+        tgui::Font::continueIncrementalPreload(sf::Time::Zero);
+        REQUIRE(distanceFieldFont->getGlyph('C', true) == nullptr);
+
+        tgui::Font::continueIncrementalPreload(sf::seconds(10));
+        REQUIRE(!tgui::Font::isPreloadingIncrementally());
+        REQUIRE(distanceFieldFont->getGlyph('A', true) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyph('B', true) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyph('C', true) != nullptr);
+        REQUIRE(distanceFieldFont->getGlyph('A', false) == nullptr);
+        tgui::disableDistanceFieldText();
+    }
+
+    SECTION("Incrementally") {
+        REQUIRE(!tgui::Font::isPreloadingIncrementally());
+        font.preloadIncrementally(0x20, 0x7E, {12, 18});
+        REQUIRE(tgui::Font::isPreloadingIncrementally());
+
+        tgui::Font::continueIncrementalPreload(sf::Time::Zero);
+        REQUIRE(tgui::Font::isPreloadingIncrementally());
+
+        tgui::Font::continueIncrementalPreload(sf::seconds(10));
+        REQUIRE(!tgui::Font::isPreloadingIncrementally());
+
+        // Glyphs of fonts that no longer exist are no longer loaded
+        tgui::Font tempFont{std::make_shared<sf::Font>()};
+        tempFont.preloadIncrementally("Text", {12});
+        tempFont = nullptr;
+        REQUIRE(tgui::Font::isPreloadingIncrementally());
+        tgui::Font::continueIncrementalPreload(sf::seconds(10));
+        REQUIRE(!tgui::Font::isPreloadingIncrementally());
+    }
+}
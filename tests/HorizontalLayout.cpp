@@ -65,5 +65,11 @@ TEST_CASE("[HorizontalLayout]") {
     REQUIRE(layout->getRatio(3) == 1);
     REQUIRE(layout->getRatio(4) == 0);
 
+    auto button4 = std::make_shared<tgui::Button>();
+    layout->insert(0, button4, "Button4");
+    REQUIRE(layout->getWidgetNames()[0] == "Button4");
+    REQUIRE(layout->getWidgetName(button4) == "Button4");
+    REQUIRE(layout->getWidgetName(button1) == "");
+
     // TODO: Add fixed size tests
 }
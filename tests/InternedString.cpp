@@ -0,0 +1,144 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/InternedString.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <atomic>
+#include <thread>
+
+TEST_CASE("[InternedString]") {
+    SECTION("Empty") {
+        tgui::InternedString str;
+        REQUIRE(str.isEmpty());
+        REQUIRE(str.getString() == "");
+        REQUIRE(str.toSfString() == "");
+        REQUIRE(str == tgui::InternedString(""));
+        REQUIRE(str == tgui::InternedString(sf::String{}));
+    }
+
+    SECTION("Shared copy") {
+        tgui::InternedString str1{"Name"};
+        tgui::InternedString str2{std::string{"Name"}};
+        tgui::InternedString str3{sf::String{"Name"}};
+        tgui::InternedString other{"Other"};
+        REQUIRE(!str1.isEmpty());
+        REQUIRE(str1.getString() == "Name");
+        REQUIRE(str1.toSfString() == "Name");
+
+        REQUIRE(str1 == str2);
+        REQUIRE(str1 == str3);
+        REQUIRE(str1 != other);
+        REQUIRE(&str1.getString() == &str2.getString());
+        REQUIRE(&str1.getString() == &str3.getString());
+    }
+
+    SECTION("Copy and move") {
+        tgui::InternedString str1{"Name"};
+        tgui::InternedString str2{str1};
+        REQUIRE(str2 == str1);
+
+        tgui::InternedString str3{std::move(str2)};
+        REQUIRE(str3 == str1);
+        REQUIRE(str2.isEmpty());
+
+        str2 = str3;
+        REQUIRE(str2 == str1);
+
+        str3 = tgui::InternedString{"Other"};
+        REQUIRE(str3 != str1);
+        REQUIRE(str3.getString() == "Other");
+
+        str1 = str1;
+        REQUIRE(str1.getString() == "Name");
+    }
+
+    SECTION("Released when unused") {
+        {
+            tgui::InternedString str{"Released"};
+            REQUIRE(str.getString() == "Released");
+        }
+
+        tgui::InternedString str{"Released"};
+        REQUIRE(str.getString() == "Released");
+    }
+
+    SECTION("Find") {
+        REQUIRE(tgui::InternedString::find("NeverInterned").isEmpty());
+        REQUIRE(tgui::InternedString::find("").isEmpty());
+
+        tgui::InternedString str{"Found"};
+        REQUIRE(tgui::InternedString::find("Found") == str);
+        REQUIRE(tgui::InternedString::find(sf::String{"Found"}) == str);
+
+        // Searching a widget or item that doesn't exist doesn't intern the name
+        auto container = std::make_shared<tgui::Panel>();
+        container->add(std::make_shared<tgui::Panel>(), "Found");
+        REQUIRE(container->get("Found") != nullptr);
+        REQUIRE(container->get("MissingWidget") == nullptr);
+        REQUIRE(tgui::InternedString::find("MissingWidget").isEmpty());
+
+        auto listBox = std::make_shared<tgui::ListBox>();
+        listBox->addItem("Item", "Found");
+        REQUIRE(listBox->getItemById("Found") == "Item");
+        REQUIRE(!listBox->setSelectedItemById("MissingItem"));
+        REQUIRE(!listBox->removeItemById("MissingItem"));
+        REQUIRE(!listBox->changeItemById("MissingItem", "Other"));
+        REQUIRE(listBox->getItemById("MissingItem") == "");
+        REQUIRE(tgui::InternedString::find("MissingItem").isEmpty());
+
+        // An empty name still finds the widgets and items without name
+        container->add(std::make_shared<tgui::Panel>());
+        REQUIRE(container->get("") == container->getWidgets()[1]);
+        listBox->addItem("Unnamed");
+        REQUIRE(listBox->getItemById("") == "Unnamed");
+    }
+
+    SECTION("Copies on several threads") {
+        const tgui::InternedString str{"Threads"};
+        std::atomic<bool> allEqual{true};
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&str,&allEqual]{
+                for (unsigned int j = 0; j < 10000; ++j)
+                {
+                    tgui::InternedString copy{str};
+                    tgui::InternedString interned{"Threads"};
+                    if (copy != interned)
+                        allEqual = false;
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(allEqual);
+        REQUIRE(str.getString() == "Threads");
+        REQUIRE(tgui::InternedString::find("Threads") == str);
+    }
+}
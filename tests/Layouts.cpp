@@ -64,13 +64,48 @@ TEST_CASE("[Layouts]") {
         REQUIRE(l4.getValue() == 0);
         REQUIRE(l5.getValue() == 2);
 
-        REQUIRE(l1.getImpl() != l4.getImpl());
-        REQUIRE(l2.getImpl() == l3.getImpl());
-        REQUIRE(l2.getImpl() == l5.getImpl());
+        // Constants don't share an implementation
+        REQUIRE(l1.isConstant());
+        REQUIRE(l2.isConstant());
+        REQUIRE(l3.isConstant());
+        REQUIRE(l4.isConstant());
+        REQUIRE(l5.isConstant());
 
         Layout2d l6(l3, 2);
-        REQUIRE(l2.getImpl() == l6.x.getImpl());
-        REQUIRE(l2.getImpl() != l6.y.getImpl());
+        REQUIRE(l6.x.isConstant());
+        REQUIRE(l6.y.isConstant());
+        REQUIRE(l6.getValue() == sf::Vector2f(2, 2));
+
+        Layout l7{"5"};
+        Layout l8 = l7;
+        Layout l9;
+        l9 = l7;
+        REQUIRE(!l7.isConstant());
+        REQUIRE(l7.isStringExpression());
+        REQUIRE(l7.getImpl() == l8.getImpl());
+        REQUIRE(l7.getImpl() == l9.getImpl());
+        REQUIRE(l9.getValue() == 5);
+
+        l9 = l2;
+        REQUIRE(l9.isConstant());
+        REQUIRE(l9.getValue() == 2);
+    }
+
+    SECTION("constant folding") {
+        Layout l1{2};
+        Layout l2{3};
+        REQUIRE((l1 + l2).isConstant());
+        REQUIRE((l1 * l2 - 1).getValue() == 5);
+        REQUIRE((-l1).isConstant());
+        REQUIRE(bindMax(l1, l2).isConstant());
+        REQUIRE(bindRange(0, 10, l2 * 5).getValue() == 10);
+        REQUIRE(bindIf(l1 < l2, 4, 5).isConstant());
+        REQUIRE(bindIf(l1 < l2, 4, 5).getValue() == 4);
+
+        Layout l3{"2"};
+        REQUIRE(!(l1 + l3).isConstant());
+        REQUIRE((l1 + l3).getValue() == 4);
+        REQUIRE(!bindIf(l1 < l2, l3, 5).isConstant());
     }
 
     SECTION("without strings") {
@@ -538,6 +573,42 @@ TEST_CASE("[Layouts]") {
         }
     }
 
+    SECTION("handlers are disconnected") {
+        auto panel = std::make_shared<tgui::Panel>();
+        auto button = std::make_shared<tgui::Button>();
+        auto other = std::make_shared<tgui::Button>();
+        panel->add(button, "btn");
+        panel->add(other);
+
+        const std::size_t positionHandlers = button->getSignalHandlerCount("PositionChanged");
+        const std::size_t sizeHandlers = button->getSignalHandlerCount("SizeChanged");
+
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            other->setPosition({"btn.right + 10", "btn.top"});
+            other->setSize(bindWidth(button), bindHeight(button) * 2);
+        }
+
+        REQUIRE(button->getSignalHandlerCount("PositionChanged") == positionHandlers + 2);
+        REQUIRE(button->getSignalHandlerCount("SizeChanged") == sizeHandlers + 3);
+
+        button->setPosition(20, 30);
+        button->setSize(40, 50);
+        REQUIRE(other->getPosition() == sf::Vector2f(70, 30));
+        REQUIRE(other->getSize() == sf::Vector2f(40, 100));
+
+        other->setPosition(0, 0);
+        other->setSize(10, 10);
+        REQUIRE(button->getSignalHandlerCount("PositionChanged") == positionHandlers);
+        REQUIRE(button->getSignalHandlerCount("SizeChanged") == sizeHandlers);
+
+        // The layout no longer changes when the widget it depended on changes
+        button->setPosition(100, 100);
+        REQUIRE(other->getPosition() == sf::Vector2f(0, 0));
+
+        REQUIRE_THROWS_AS(button->getSignalHandlerCount("SomeNonExistentSignal"), tgui::Exception);
+    }
+
     SECTION("Bug Fixes") {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)") {
             tgui::Panel::Ptr panel = std::make_shared<tgui::Panel>();
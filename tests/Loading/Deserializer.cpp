@@ -152,4 +152,60 @@ TEST_CASE("[Deserializer]") {
         tgui::Deserializer::setFunction(tgui::ObjectConverter::Type::Color, oldFunc);
         REQUIRE(tgui::Deserializer::deserialize(Type::Color, "rgb(10, 20, 30)").getColor() == sf::Color(10, 20, 30));
     }
+
+    SECTION("cache") {
+        REQUIRE(!tgui::Deserializer::isCacheEnabled());
+        tgui::Deserializer::enableCache();
+        tgui::Deserializer::resetCacheStatistics();
+        REQUIRE(tgui::Deserializer::isCacheEnabled());
+
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "#3C3C3C").getColor() == sf::Color(60, 60, 60));
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "#3C3C3C").getColor() == sf::Color(60, 60, 60));
+        REQUIRE(tgui::Deserializer::deserialize(Type::Borders, "(2, 2, 2, 2)").getBorders() == tgui::Borders(2, 2, 2, 2));
+        REQUIRE(tgui::Deserializer::deserialize(Type::Borders, "(2, 2, 2, 2)").getBorders() == tgui::Borders(2, 2, 2, 2));
+        REQUIRE(tgui::Deserializer::deserialize(Type::Number, "#3C3C3C").getNumber() == 0);
+        REQUIRE(tgui::Deserializer::getCacheStatistics().hits == 2);
+        REQUIRE(tgui::Deserializer::getCacheStatistics().misses == 3);
+        REQUIRE(tgui::Deserializer::getCacheStatistics().entries == 3);
+
+        // Failures are not cached
+        REQUIRE_THROWS_AS(tgui::Deserializer::deserialize(Type::Color, ""), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::Deserializer::deserialize(Type::Color, ""), tgui::Exception);
+        REQUIRE(tgui::Deserializer::getCacheStatistics().entries == 3);
+
+        // Cached textures share their data
+        tgui::Texture texture1 = tgui::Deserializer::deserialize(Type::Texture, "\"resources/image.png\" Part(0, 0, 25, 25)").getTexture();
+        tgui::Texture texture2 = tgui::Deserializer::deserialize(Type::Texture, "\"resources/image.png\" Part(0, 0, 25, 25)").getTexture();
+        REQUIRE(texture1.getData() == texture2.getData());
+        REQUIRE(tgui::Deserializer::getCacheStatistics().hits == 3);
+
+        // Changing the resource path invalidates the cached textures but not other values
+        auto oldResourcePath = tgui::getResourcePath();
+        tgui::setResourcePath("resources/..");
+        auto misses = tgui::Deserializer::getCacheStatistics().misses;
+        tgui::Texture texture3 = tgui::Deserializer::deserialize(Type::Texture, "\"resources/image.png\" Part(0, 0, 25, 25)").getTexture();
+        REQUIRE(texture3.getId() == "resources/../resources/image.png");
+        REQUIRE(tgui::Deserializer::getCacheStatistics().misses > misses);
+
+        auto hits = tgui::Deserializer::getCacheStatistics().hits;
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "#3C3C3C").getColor() == sf::Color(60, 60, 60));
+        REQUIRE(tgui::Deserializer::getCacheStatistics().hits == hits + 1);
+        tgui::setResourcePath(oldResourcePath);
+
+        // Setting a function clears the cache for that type
+        auto oldFunc = tgui::Deserializer::getFunction(Type::Color);
+        tgui::Deserializer::setFunction(Type::Color, [](const std::string&){ return tgui::ObjectConverter{sf::Color::Green}; });
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "#3C3C3C").getColor() == sf::Color::Green);
+        tgui::Deserializer::setFunction(Type::Color, oldFunc);
+        REQUIRE(tgui::Deserializer::deserialize(Type::Color, "#3C3C3C").getColor() == sf::Color(60, 60, 60));
+
+        tgui::Deserializer::clearCache();
+        REQUIRE(tgui::Deserializer::getCacheStatistics().entries == 0);
+
+        tgui::Deserializer::disableCache();
+        REQUIRE(!tgui::Deserializer::isCacheEnabled());
+        tgui::Deserializer::resetCacheStatistics();
+        tgui::Deserializer::deserialize(Type::Color, "#3C3C3C");
+        REQUIRE(tgui::Deserializer::getCacheStatistics().misses == 0);
+    }
 }
@@ -0,0 +1,59 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Tests.hpp"
+#include <TGUI/Loading/ObjectConverter.hpp>
+
+TEST_CASE("[ObjectConverter]") {
+    SECTION("copy and move") {
+        tgui::ObjectConverter color{sf::Color{10, 20, 30}};
+        tgui::ObjectConverter string{sf::String{"Text"}};
+        tgui::ObjectConverter texture{tgui::Texture{"resources/image.png"}};
+
+        tgui::ObjectConverter copy{color};
+        REQUIRE(copy.getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(copy.getColor() == sf::Color(10, 20, 30));
+
+        copy = string;
+        REQUIRE(copy.getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(copy.getString() == "Text");
+        REQUIRE(string.getString() == "Text");
+
+        copy = texture;
+        REQUIRE(copy.getType() == tgui::ObjectConverter::Type::Texture);
+        REQUIRE(copy.getTexture().getId() == "resources/image.png");
+
+        tgui::ObjectConverter moved{std::move(copy)};
+        REQUIRE(moved.getType() == tgui::ObjectConverter::Type::Texture);
+        REQUIRE(moved.getTexture().getId() == "resources/image.png");
+
+        moved = tgui::ObjectConverter{2.5f};
+        REQUIRE(moved.getType() == tgui::ObjectConverter::Type::Number);
+        REQUIRE(moved.getNumber() == 2.5f);
+
+        moved = tgui::ObjectConverter{};
+        REQUIRE(moved.getType() == tgui::ObjectConverter::Type::None);
+    }
+}
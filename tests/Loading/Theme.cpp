@@ -25,6 +25,7 @@
 #include "../catch.hpp"
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
 
 namespace tgui
@@ -37,6 +38,7 @@ namespace tgui
         static auto& getWidgets(tgui::Theme::Ptr theme) { return theme->m_widgets; }
         static auto& getWidgetTypes(tgui::Theme::Ptr theme) { return theme->m_widgetTypes; }
         static auto& getWidgetProperties(tgui::Theme::Ptr theme) { return theme->m_widgetProperties; }
+        static auto& getPrototypes(tgui::Theme::Ptr theme) { return theme->m_prototypes; }
     };
 }
 
@@ -129,6 +131,42 @@ TEST_CASE("[Theme]") {
             REQUIRE(tgui::ThemeTest::getWidgetProperties(theme).begin()->second.size() == 0);
         }
 
+        SECTION("prototypes") {
+            tgui::Theme::Ptr theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+            theme->setProperty("Button", "TextColorNormal", sf::Color(255, 0, 0));
+
+            tgui::Button::Ptr button1 = theme->load("Button");
+            REQUIRE(tgui::ThemeTest::getPrototypes(theme).size() == 1);
+            REQUIRE(tgui::ThemeTest::getPrototypes(theme)["button"] != nullptr);
+            REQUIRE(tgui::ThemeTest::getPrototypes(theme)["button"]->getTheme() == nullptr);
+
+            tgui::Button::Ptr button2 = theme->load("Button");
+            REQUIRE(button2 != button1);
+            REQUIRE(button2->getTheme() == theme);
+            REQUIRE(button2->getPrimaryLoadingParameter() == button1->getPrimaryLoadingParameter());
+            REQUIRE(button2->getSecondaryLoadingParameter() == "button");
+            REQUIRE(button2->getSize() == button1->getSize());
+            REQUIRE(button2->getRenderer()->getPropertyValuePairs().size() == button1->getRenderer()->getPropertyValuePairs().size());
+            REQUIRE(button2->getRenderer()->getProperty("TextColorNormal").getColor() == sf::Color(255, 0, 0));
+            REQUIRE(tgui::ThemeTest::getWidgets(theme).size() == 2);
+
+            theme->setProperty("Button", "TextColorNormal", sf::Color(0, 255, 0));
+            REQUIRE(tgui::ThemeTest::getPrototypes(theme).empty());
+            REQUIRE(button2->getRenderer()->getProperty("TextColorNormal").getColor() == sf::Color(0, 255, 0));
+            tgui::Button::Ptr button3 = theme->load("Button");
+            REQUIRE(button3->getRenderer()->getProperty("TextColorNormal").getColor() == sf::Color(0, 255, 0));
+
+            theme->reload("resources/Black.txt");
+            REQUIRE(tgui::ThemeTest::getPrototypes(theme).empty());
+
+            // Widgets that load other widgets from the theme are not cloned
+            tgui::EditBox::Ptr editBox = theme->load("EditBox");
+            REQUIRE(tgui::ThemeTest::getPrototypes(theme)["editbox"] != nullptr);
+            theme->load("ChildWindow");
+            REQUIRE(tgui::ThemeTest::getPrototypes(theme)["childwindow"] == nullptr);
+            REQUIRE(tgui::ThemeTest::getPrototypes(theme)["childwindowclosebutton"] != nullptr);
+        }
+
         SECTION("wrong widget type") {
             auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
             REQUIRE_THROWS_AS(tgui::EditBox::Ptr widget = theme->load("Button"), tgui::Exception);
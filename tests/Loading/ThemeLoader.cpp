@@ -24,13 +24,14 @@
 
 #include "../catch.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Context.hpp>
 
 namespace tgui
 {
     struct DefaultThemeLoaderTest
     {
-        static auto& getPropertiesCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_propertiesCache; }
-        static auto& getWidgetTypeCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_widgetTypeCache; }
+        static auto& getPropertiesCache(std::shared_ptr<DefaultThemeLoader>) { return Context::getGlobal().m_themePropertiesCache; }
+        static auto& getWidgetTypeCache(std::shared_ptr<DefaultThemeLoader>) { return Context::getGlobal().m_themeWidgetTypeCache; }
     };
 }
 
@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../Tests.hpp"
+#include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/Loading/WidgetSaver.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+#include <atomic>
+#include <fstream>
+
+TEST_CASE("[WidgetLoader]") {
+    REQUIRE(tgui::WidgetLoader::getThreadCount() == 1);
+
+    std::stringstream widgetFile;
+    {
+        auto theme = std::make_shared<tgui::Theme>("resources/Black.txt");
+        auto parent = std::make_shared<tgui::Panel>();
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            auto panel = std::make_shared<tgui::Panel>();
+            panel->setPosition(i * 50.f, 0);
+            parent->add(panel, "Panel" + tgui::to_string(i));
+
+            tgui::Button::Ptr button = theme->load("Button");
+            button->setText("Button " + tgui::to_string(i));
+            panel->add(button);
+
+            panel->add(theme->load("CheckBox"));
+            panel->add(theme->load("Slider"));
+            panel->add(std::make_shared<tgui::Picture>("resources/image.png"));
+        }
+
+        parent->saveWidgetsToStream(widgetFile);
+    }
+
+    // Every image should only be decoded once, even though multiple parts of the same image are used
+    std::atomic<unsigned int> imagesLoaded{0};
+    auto oldImageLoader = tgui::Texture::getImageLoader();
+    tgui::Texture::setImageLoader([&](const sf::String& filename){ imagesLoaded++; return oldImageLoader(filename); });
+
+    tgui::WidgetLoader::setThreadCount(4);
+    REQUIRE(tgui::WidgetLoader::getThreadCount() == 4);
+
+    auto parallelParent = std::make_shared<tgui::Panel>();
+    std::stringstream parallelInput{widgetFile.str()};
+    REQUIRE_NOTHROW(parallelParent->loadWidgetsFromStream(parallelInput));
+    REQUIRE(imagesLoaded == 2);
+
+    tgui::WidgetLoader::setThreadCount(1);
+    tgui::Texture::setImageLoader(oldImageLoader);
+
+    auto serialParent = std::make_shared<tgui::Panel>();
+    std::stringstream serialInput{widgetFile.str()};
+    REQUIRE_NOTHROW(serialParent->loadWidgetsFromStream(serialInput));
+
+    std::stringstream serialOutput;
+    std::stringstream parallelOutput;
+    serialParent->saveWidgetsToStream(serialOutput);
+    parallelParent->saveWidgetsToStream(parallelOutput);
+    REQUIRE(parallelOutput.str() == widgetFile.str());
+    REQUIRE(parallelOutput.str() == serialOutput.str());
+
+    SECTION("Emitting nested sections") {
+        auto root = std::make_shared<tgui::DataIO::Node>();
+        root->propertyValuePairs["Version"] = std::make_shared<tgui::DataIO::ValueNode>(root.get(), "1");
+
+        auto outer = std::make_shared<tgui::DataIO::Node>();
+        outer->name = "Panel.Outer";
+        outer->propertyValuePairs["Visible"] = std::make_shared<tgui::DataIO::ValueNode>(outer.get(), "false");
+        root->children.push_back(outer);
+
+        unsigned int deferredCount = 0;
+        for (unsigned int i = 0; i < 2; ++i)
+        {
+            outer->children.push_back(std::make_shared<tgui::DataIO::Node>());
+            outer->children.back()->deferred = [&deferredCount,i](){
+                    deferredCount++;
+                    auto inner = std::make_shared<tgui::DataIO::Node>();
+                    inner->name = "Button" + tgui::to_string(i);
+                    inner->propertyValuePairs["Text"] = std::make_shared<tgui::DataIO::ValueNode>(inner.get(), "\"Ok\"");
+                    inner->children.push_back(std::make_shared<tgui::DataIO::Node>());
+                    return inner;
+                };
+        }
+
+        root->children.push_back(std::make_shared<tgui::DataIO::Node>());
+        root->children.back()->name = "Label";
+
+        std::stringstream output;
+        tgui::DataIO::emit(root, output);
+        REQUIRE(deferredCount == 2);
+        REQUIRE(output.str() == "Version: 1;\n"
+                                "\n"
+                                "Panel.Outer {\n"
+                                "    Visible: false;\n"
+                                "\n"
+                                "    Button0 {\n"
+                                "        Text: \"Ok\";\n"
+                                "    \n"
+                                "        {\n"
+                                "        }\n"
+                                "    }\n"
+                                "\n"
+                                "    Button1 {\n"
+                                "        Text: \"Ok\";\n"
+                                "    \n"
+                                "        {\n"
+                                "        }\n"
+                                "    }\n"
+                                "}\n"
+                                "\n"
+                                "Label {\n"
+                                "}\n");
+    }
+
+    SECTION("Resolving deferred nodes") {
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->add(std::make_shared<tgui::Button>(), "Btn");
+        panel->add(std::make_shared<tgui::Picture>("resources/image.png"), "Pic");
+
+        auto node = tgui::WidgetSaver::getSaveFunction("panel")(tgui::WidgetConverter{panel});
+        // The first child contains the renderer properties of the panel itself
+        REQUIRE(node->children.size() == 3);
+        REQUIRE(node->children[1]->deferred);
+
+        node = tgui::DataIO::resolveDeferredNodes(node);
+        REQUIRE(node->children.size() == 3);
+        REQUIRE(!node->children[1]->deferred);
+        REQUIRE(node->children[1]->name == "Button.\"Btn\"");
+        REQUIRE(node->children[1]->parent == node.get());
+        REQUIRE(node->children[2]->name == "Picture.\"Pic\"");
+        REQUIRE(node->children[2]->parent == node.get());
+    }
+
+    SECTION("Failed save keeps the existing file") {
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->add(std::make_shared<tgui::Button>(), "Btn");
+        REQUIRE_NOTHROW(panel->saveWidgetsToFile("WidgetFileWidgetLoader.txt"));
+        REQUIRE(!std::ifstream{"WidgetFileWidgetLoader.txt.tmp"}.is_open());
+
+        std::stringstream original;
+        original << std::ifstream{"WidgetFileWidgetLoader.txt"}.rdbuf();
+        REQUIRE(!original.str().empty());
+
+        auto oldSaveFunction = tgui::WidgetSaver::getSaveFunction("button");
+        tgui::WidgetSaver::setSaveFunction("button", [](tgui::WidgetConverter) -> std::shared_ptr<tgui::DataIO::Node> {
+                throw tgui::Exception{"Saving failed"};
+            });
+        panel->add(std::make_shared<tgui::Button>(), "OtherBtn");
+        REQUIRE_THROWS_AS(panel->saveWidgetsToFile("WidgetFileWidgetLoader.txt"), tgui::Exception);
+        tgui::WidgetSaver::setSaveFunction("button", oldSaveFunction);
+
+        REQUIRE(!std::ifstream{"WidgetFileWidgetLoader.txt.tmp"}.is_open());
+        std::stringstream afterFailure;
+        afterFailure << std::ifstream{"WidgetFileWidgetLoader.txt"}.rdbuf();
+        REQUIRE(afterFailure.str() == original.str());
+
+        REQUIRE_NOTHROW(panel->saveWidgetsToFile("WidgetFileWidgetLoader.txt"));
+        std::stringstream overwritten;
+        overwritten << std::ifstream{"WidgetFileWidgetLoader.txt"}.rdbuf();
+        REQUIRE(overwritten.str() != original.str());
+    }
+
+    SECTION("Missing image") {
+        tgui::WidgetLoader::setThreadCount(0);
+
+        std::stringstream input{"Picture { Filename : \"resources/NonExistent.png\"; }"};
+        std::streambuf *oldbuf = sf::err().rdbuf(0);
+        REQUIRE_THROWS_AS(std::make_shared<tgui::Panel>()->loadWidgetsFromStream(input), tgui::Exception);
+        sf::err().rdbuf(oldbuf);
+
+        tgui::WidgetLoader::setThreadCount(1);
+    }
+}
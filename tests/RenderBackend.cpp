@@ -0,0 +1,369 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "catch.hpp"
+#include <TGUI/SoftwareRenderBackend.hpp>
+#include <TGUI/DistanceFieldFont.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/TGUI.hpp>
+
+namespace
+{
+    // Custom widget that only implements the draw function
+    class DrawOnlyWidget : public tgui::Widget
+    {
+    public:
+        tgui::Widget::Ptr clone() const override
+        {
+            return std::make_shared<DrawOnlyWidget>(*this);
+        }
+
+        bool mouseOnWidget(float, float) const override
+        {
+            return false;
+        }
+
+        mutable unsigned int drawCount = 0;
+
+    protected:
+        void draw(sf::RenderTarget&, sf::RenderStates) const override
+        {
+            ++drawCount;
+        }
+    };
+}
+
+TEST_CASE("[RenderBackend]") {
+    tgui::RenderCommandList commands;
+    tgui::SoftwareRenderBackend backend{20, 20};
+    backend.clear(sf::Color::Black);
+
+    SECTION("Command list") {
+        SECTION("Consecutive quads are merged") {
+            commands.addQuad({}, {0, 0, 5, 5}, sf::Color::Red);
+            commands.addQuad({}, {5, 0, 5, 5}, sf::Color::Green);
+            REQUIRE(commands.getCommands().size() == 1);
+            REQUIRE(commands.getCommands()[0].type == tgui::RenderCommandList::Command::Type::Quad);
+            REQUIRE(commands.getCommands()[0].vertexCount == 12);
+            REQUIRE(commands.getVertices().size() == 12);
+
+            commands.pushClip({}, {0, 0, 5, 5});
+            commands.addQuad({}, {0, 0, 5, 5}, sf::Color::Blue);
+            commands.popClip();
+            REQUIRE(commands.getCommands().size() == 4);
+
+            commands.clear();
+            REQUIRE(commands.getCommands().empty());
+            REQUIRE(commands.getVertices().empty());
+        }
+
+        SECTION("Transform") {
+            sf::Transform transform;
+            transform.translate(10, 20);
+            commands.addQuad(transform, {1, 2, 3, 4}, sf::Color::Red);
+            REQUIRE(commands.getVertices()[0].position == sf::Vector2f(11, 22));
+
+            // The transformation of a clipping rectangle is kept, so that the SFML backend can apply it after mapping the view
+            commands.pushClip(transform, {1, 2, 3, 4});
+            REQUIRE(commands.getCommands().back().clipRect == sf::FloatRect(1, 2, 3, 4));
+            REQUIRE(commands.getCommands().back().clipTransform.transformPoint({1, 2}) == sf::Vector2f(11, 22));
+        }
+    }
+
+    SECTION("Software rasterizer") {
+        SECTION("Quad") {
+            commands.addQuad({}, {2, 3, 4, 5}, sf::Color::Red);
+            backend.render(commands);
+
+            for (unsigned int y = 0; y < 20; ++y)
+            {
+                for (unsigned int x = 0; x < 20; ++x)
+                {
+                    if ((x >= 2) && (x < 6) && (y >= 3) && (y < 8))
+                        REQUIRE(backend.getPixel(x, y) == sf::Color::Red);
+                    else
+                        REQUIRE(backend.getPixel(x, y) == sf::Color::Black);
+                }
+            }
+        }
+
+        SECTION("Shared edges are only drawn once") {
+            backend.clear();
+            commands.addQuad({}, {0, 0, 10, 10}, {255, 0, 0, 128});
+            commands.addQuad({}, {10, 0, 10, 10}, {255, 0, 0, 128});
+            backend.render(commands);
+
+            for (unsigned int y = 0; y < 10; ++y)
+            {
+                for (unsigned int x = 0; x < 20; ++x)
+                    REQUIRE(backend.getPixel(x, y) == sf::Color(128, 0, 0, 128));
+            }
+            REQUIRE(backend.getPixel(0, 10) == sf::Color::Transparent);
+        }
+
+        SECTION("Blending") {
+            commands.addQuad({}, {0, 0, 1, 1}, {255, 255, 255, 51});
+            backend.render(commands);
+            REQUIRE(backend.getPixel(0, 0) == sf::Color(51, 51, 51, 255));
+        }
+
+        SECTION("Clipping") {
+            sf::Transform transform;
+            transform.translate(4, 3);
+            commands.pushClip(transform, {1, 2, 10, 10});
+            commands.pushClip({}, {0, 0, 8, 8});
+            commands.addQuad({}, {0, 0, 20, 20}, sf::Color::Green);
+            commands.popClip();
+            commands.addQuad({}, {14, 14, 6, 6}, sf::Color::Blue);
+            commands.popClip();
+            backend.render(commands);
+
+            REQUIRE(backend.getPixel(4, 4) == sf::Color::Black);
+            REQUIRE(backend.getPixel(5, 5) == sf::Color::Green);
+            REQUIRE(backend.getPixel(7, 7) == sf::Color::Green);
+            REQUIRE(backend.getPixel(8, 8) == sf::Color::Black);
+            REQUIRE(backend.getPixel(14, 14) == sf::Color::Blue);
+            REQUIRE(backend.getPixel(15, 15) == sf::Color::Black);
+        }
+
+        SECTION("Shape") {
+            sf::RectangleShape shape{{4, 4}};
+            shape.setPosition(2, 2);
+            shape.setFillColor(sf::Color::Red);
+            shape.setOutlineColor(sf::Color::Green);
+            shape.setOutlineThickness(1);
+            commands.addShape({}, shape);
+            backend.render(commands);
+
+            REQUIRE(backend.getPixel(2, 2) == sf::Color::Red);
+            REQUIRE(backend.getPixel(5, 5) == sf::Color::Red);
+            REQUIRE(backend.getPixel(1, 1) == sf::Color::Green);
+            REQUIRE(backend.getPixel(6, 3) == sf::Color::Green);
+            REQUIRE(backend.getPixel(3, 6) == sf::Color::Green);
+            REQUIRE(backend.getPixel(7, 7) == sf::Color::Black);
+            REQUIRE(backend.getPixel(0, 3) == sf::Color::Black);
+        }
+
+        SECTION("Image") {
+            commands.addQuad({}, {0, 0, 1, 1}, sf::Color::Red);
+            backend.render(commands);
+
+            sf::Image image = backend.copyToImage();
+            REQUIRE(image.getSize() == sf::Vector2u(20, 20));
+            REQUIRE(image.getPixel(0, 0) == sf::Color::Red);
+            REQUIRE(image.getPixel(1, 0) == sf::Color::Black);
+            REQUIRE(backend.getPixels().size() == 20 * 20 * 4);
+        }
+    }
+
+    SECTION("Widgets") {
+        SECTION("Panel") {
+            auto parent = std::make_shared<tgui::Panel>(sf::Vector2f{10, 10});
+            parent->setPosition(4, 4);
+            parent->setBackgroundColor(sf::Color::Blue);
+            parent->getRenderer()->setBorders({1, 2, 3, 4});
+            parent->getRenderer()->setBorderColor(sf::Color::Green);
+
+            auto child = std::make_shared<tgui::Panel>(sf::Vector2f{10, 10});
+            child->setPosition(5, 0);
+            child->setBackgroundColor(sf::Color::Red);
+            parent->add(child);
+
+            parent->emitRenderCommands(commands, {});
+            backend.render(commands);
+
+            REQUIRE(backend.getPixel(4, 4) == sf::Color::Blue);
+            REQUIRE(backend.getPixel(8, 13) == sf::Color::Blue);
+            REQUIRE(backend.getPixel(9, 4) == sf::Color::Red);
+            REQUIRE(backend.getPixel(13, 13) == sf::Color::Red);
+
+            // Borders lie outside the panel and the child is clipped to the inside of the panel
+            REQUIRE(backend.getPixel(3, 8) == sf::Color::Green);
+            REQUIRE(backend.getPixel(8, 2) == sf::Color::Green);
+            REQUIRE(backend.getPixel(16, 8) == sf::Color::Green);
+            REQUIRE(backend.getPixel(17, 8) == sf::Color::Black);
+            REQUIRE(backend.getPixel(8, 17) == sf::Color::Green);
+            REQUIRE(backend.getPixel(8, 18) == sf::Color::Black);
+            REQUIRE(backend.getPixel(2, 8) == sf::Color::Black);
+
+            child->hide();
+            commands.clear();
+            parent->emitRenderCommands(commands, {});
+            backend.render(commands);
+            REQUIRE(backend.getPixel(13, 13) == sf::Color::Blue);
+        }
+
+        SECTION("Text of different widgets is batched") {
+            auto font = std::make_shared<sf::Font>();
+            REQUIRE(font->loadFromFile("resources/DroidSansArmenian.ttf"));
+
+            tgui::Gui gui;
+            auto panel = std::make_shared<tgui::Panel>(sf::Vector2f{100, 100});
+            panel->setBackgroundColor(sf::Color::Transparent);
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                auto label = std::make_shared<tgui::Label>();
+                label->setFont(font);
+                label->setText("Label " + std::to_string(i));
+                label->setTextSize(10 + 4 * i);
+                label->setPosition(2, 25.f * i);
+
+                // The last label lies inside a panel, which clips its contents
+                if (i < 3)
+                    gui.add(label);
+                else
+                    panel->add(label);
+            }
+            gui.add(panel);
+
+            tgui::enableDistanceFieldText();
+            gui.getContainer()->emitRenderCommands(commands, {});
+            tgui::disableDistanceFieldText();
+
+            using Type = tgui::RenderCommandList::Command::Type;
+            const auto& commandList = commands.getCommands();
+            REQUIRE(commandList.size() == 4);
+            REQUIRE(commandList[0].type == Type::GlyphAtlasTriangles);
+            REQUIRE(commandList[0].glyphRunCount == 3);
+            REQUIRE(commandList[1].type == Type::PushClip);
+            REQUIRE(commandList[2].type == Type::GlyphAtlasTriangles);
+            REQUIRE(commandList[2].glyphRunCount == 1);
+            REQUIRE(commandList[3].type == Type::PopClip);
+            REQUIRE(commands.getGlyphRuns().size() == 4);
+
+            // When the shader is available, each command is drawn with a single draw call
+            sf::RenderTexture target;
+            target.create(100, 100);
+            tgui::SfmlRenderBackend sfmlBackend{target};
+            sfmlBackend.render(commands);
+            if (tgui::priv::getDistanceFieldShader())
+                REQUIRE(sfmlBackend.getDrawCallCount() == 2);
+            else
+                REQUIRE(sfmlBackend.getDrawCallCount() == 4);
+
+            // Rasterizing the batched triangles gives the same result as drawing each text separately
+            tgui::SoftwareRenderBackend batchedBackend{100, 100};
+            batchedBackend.render(commands);
+
+            tgui::RenderCommandList separateCommands;
+            gui.getContainer()->emitRenderCommands(separateCommands, {});
+            REQUIRE(separateCommands.getCommands()[0].type == Type::GlyphRun);
+            tgui::SoftwareRenderBackend separateBackend{100, 100};
+            separateBackend.render(separateCommands);
+
+            REQUIRE(batchedBackend.getPixels() == separateBackend.getPixels());
+        }
+
+#ifdef TGUI_USE_FREETYPE
+        SECTION("Text without OpenGL") {
+            // The glyphs are rasterized with FreeType instead of being copied from the texture of the font
+            tgui::Gui gui;
+            auto label = std::make_shared<tgui::Label>();
+            label->setText("H");
+            label->setTextSize(16);
+            label->setTextColor(sf::Color::White);
+            gui.add(label);
+
+            tgui::enableDistanceFieldText();
+            gui.getContainer()->emitRenderCommands(commands, {});
+            tgui::disableDistanceFieldText();
+            backend.render(commands);
+
+            // The vertical bars of the letter are drawn while the space between them stays empty
+            unsigned int litPixels = 0;
+            for (unsigned int y = 0; y < 20; ++y)
+            {
+                for (unsigned int x = 0; x < 20; ++x)
+                {
+                    if (backend.getPixel(x, y).r > 128)
+                        ++litPixels;
+                }
+            }
+            REQUIRE(litPixels > 10);
+            REQUIRE(litPixels < 200);
+        }
+#endif
+
+        SECTION("Built-in widgets") {
+            tgui::Gui gui;
+            std::vector<tgui::Widget::Ptr> widgets = {
+                tgui::Button::create(), tgui::ChatBox::create(), tgui::CheckBox::create(), tgui::ChildWindow::create(),
+                tgui::ComboBox::create(), tgui::EditBox::create(), tgui::Grid::create(), tgui::Knob::create(),
+                tgui::ListBox::create(), tgui::MenuBar::create(), tgui::MessageBox::create(), tgui::ProgressBar::create(),
+                tgui::RadioButton::create(), tgui::Scrollbar::create(), tgui::Slider::create(), tgui::SpinButton::create(),
+                tgui::Tab::create(), tgui::TextBox::create(), tgui::HorizontalLayout::create(), tgui::FlexLayout::create()
+            };
+            for (auto& widget : widgets)
+                gui.add(widget);
+
+            auto button = std::static_pointer_cast<tgui::Button>(widgets[0]);
+            button->setSize(10, 10);
+            button->getRenderer()->setBackgroundColor(sf::Color::Red);
+            button->moveToFront();
+
+            gui.getContainer()->emitRenderCommands(commands, {});
+            for (const auto& command : commands.getCommands())
+                REQUIRE(command.type != tgui::RenderCommandList::Command::Type::Widget);
+
+            backend.render(commands);
+            REQUIRE(backend.getPixel(5, 5) == sf::Color::Red);
+        }
+
+        SECTION("Widget without render commands") {
+            auto widget = std::make_shared<DrawOnlyWidget>();
+            widget->emitRenderCommands(commands, {});
+            REQUIRE(commands.getCommands().size() == 1);
+            REQUIRE(commands.getCommands()[0].type == tgui::RenderCommandList::Command::Type::Widget);
+
+            // Only the SFML backend can call the draw function
+            sf::RenderTexture target;
+            target.create(20, 20);
+            tgui::SfmlRenderBackend{target}.render(commands);
+            REQUIRE(widget->drawCount == 1);
+
+            REQUIRE_THROWS_AS(backend.render(commands), tgui::Exception);
+        }
+
+        SECTION("Picture") {
+            sf::Image image;
+            REQUIRE(image.loadFromFile("resources/image.png"));
+
+            tgui::Picture::Ptr picture = tgui::Picture::create("resources/image.png");
+            tgui::SoftwareRenderBackend pictureBackend{image.getSize().x, image.getSize().y};
+            picture->emitRenderCommands(commands, {});
+            pictureBackend.render(commands);
+
+            for (unsigned int y = 0; y < image.getSize().y; ++y)
+            {
+                for (unsigned int x = 0; x < image.getSize().x; ++x)
+                {
+                    const sf::Color color = image.getPixel(x, y);
+                    if (color.a == 255)
+                        REQUIRE(pictureBackend.getPixel(x, y) == color);
+                }
+            }
+        }
+    }
+}
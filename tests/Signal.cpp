@@ -23,7 +23,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Tests.hpp"
+#include <TGUI/Gui.hpp>
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Widgets/Slider.hpp>
 
 TEST_CASE("[Signal]") {
     tgui::Widget::Ptr widget = std::make_shared<tgui::Button>();
@@ -71,6 +77,158 @@ TEST_CASE("[Signal]") {
         REQUIRE(widget->connectEx("All", [](const tgui::Callback&){}) > id+12);
     }
 
+    SECTION("Callback") {
+        auto button = std::static_pointer_cast<tgui::Button>(widget);
+        button->setPosition(10, 20);
+        button->setSize(100, 50);
+        button->setText("Hello");
+
+        tgui::Callback callback;
+        button->connectEx("PositionChanged Pressed", [&](const tgui::Callback& c){ callback = c; });
+
+        button->setPosition(30, 40);
+        REQUIRE(callback.trigger == "PositionChanged");
+        REQUIRE(callback.widget == button.get());
+        REQUIRE(callback.widgetType == "Button");
+        REQUIRE(callback.position == sf::Vector2f(30, 40));
+        REQUIRE(callback.size == sf::Vector2f(100, 50));
+        REQUIRE(callback.text == "Hello");
+
+        auto copy = tgui::Button::copy(button);
+        copy->setPosition(50, 60);
+        REQUIRE(callback.widget == copy.get());
+        REQUIRE(callback.position == sf::Vector2f(50, 60));
+        REQUIRE(copy->getWidgetType() == "Button");
+    }
+
+    SECTION("Callback is filled when created") {
+        tgui::Callback callback;
+        auto storeCallback = [&](const tgui::Callback& c){ callback = c; };
+
+        auto slider = std::make_shared<tgui::Slider>();
+        slider->setValue(7);
+        slider->connectEx("PositionChanged", storeCallback);
+        slider->setPosition(1, 1);
+        REQUIRE(callback.value == 7);
+
+        auto scrollbar = std::make_shared<tgui::Scrollbar>();
+        scrollbar->setMaximum(20);
+        scrollbar->setValue(4);
+        scrollbar->connectEx("PositionChanged", storeCallback);
+        scrollbar->setPosition(1, 1);
+        REQUIRE(callback.value == 4);
+
+        auto progressBar = std::make_shared<tgui::ProgressBar>();
+        progressBar->setValue(30);
+        progressBar->connectEx("PositionChanged", storeCallback);
+        progressBar->setPosition(1, 1);
+        REQUIRE(callback.value == 30);
+
+        auto knob = std::make_shared<tgui::Knob>();
+        knob->setValue(9);
+        knob->connectEx("PositionChanged", storeCallback);
+        knob->setPosition(1, 1);
+        REQUIRE(callback.value == 9);
+
+        auto label = std::make_shared<tgui::Label>();
+        label->setText("Text");
+        label->connectEx("PositionChanged", storeCallback);
+        label->setPosition(1, 1);
+        REQUIRE(callback.text == "Text");
+    }
+
+    SECTION("SignalDelivery") {
+        std::vector<sf::Vector2f> positions;
+        unsigned int id = widget->connect("PositionChanged", [&](sf::Vector2f pos){ positions.push_back(pos); });
+
+        REQUIRE_THROWS_AS(widget->setSignalDelivery(id+1, tgui::SignalDelivery::Coalesce), tgui::Exception);
+
+        SECTION("Coalesce") {
+            widget->setSignalDelivery(id, tgui::SignalDelivery::Coalesce);
+            widget->setPosition(10, 10);
+            widget->setPosition(20, 20);
+            REQUIRE(positions.empty());
+
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(10));
+            REQUIRE(positions.size() == 1);
+            REQUIRE(positions[0] == sf::Vector2f(20, 20));
+
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(10));
+            REQUIRE(positions.size() == 1);
+        }
+
+        SECTION("Debounce") {
+            widget->setSignalDelivery(id, tgui::SignalDelivery::Debounce, sf::milliseconds(100));
+            widget->setPosition(10, 10);
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(60));
+            widget->setPosition(20, 20);
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(60));
+            REQUIRE(positions.empty());
+
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(60));
+            REQUIRE(positions.size() == 1);
+            REQUIRE(positions[0] == sf::Vector2f(20, 20));
+        }
+
+        SECTION("Throttle") {
+            widget->setSignalDelivery(id, tgui::SignalDelivery::Throttle, sf::milliseconds(100));
+            widget->setPosition(10, 10);
+            widget->setPosition(20, 20);
+            widget->setPosition(30, 30);
+            REQUIRE(positions.size() == 1);
+            REQUIRE(positions[0] == sf::Vector2f(10, 10));
+
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(60));
+            REQUIRE(positions.size() == 1);
+
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(60));
+            REQUIRE(positions.size() == 2);
+            REQUIRE(positions[1] == sf::Vector2f(30, 30));
+
+            // Once the duration passes without new values, the next value is delivered immediately again
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(120));
+            widget->setPosition(40, 40);
+            REQUIRE(positions.size() == 3);
+        }
+
+        SECTION("Pending calls are dropped with the widget") {
+            widget->setSignalDelivery(id, tgui::SignalDelivery::Coalesce);
+            widget->setPosition(10, 10);
+            widget = nullptr;
+
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(10));
+            REQUIRE(positions.empty());
+        }
+
+        SECTION("Every gui delivers the signals of its own widgets") {
+            tgui::Gui gui1;
+            tgui::Gui gui2;
+            gui1.add(widget);
+            widget->setSignalDelivery(id, tgui::SignalDelivery::Coalesce);
+            widget->setPosition(10, 10);
+
+            tgui::Signal::deliverDelayedSignals(sf::milliseconds(10));
+            gui2.updateTime(sf::milliseconds(10));
+            REQUIRE(positions.empty());
+
+            gui1.updateTime(sf::milliseconds(10));
+            REQUIRE(positions.size() == 1);
+            REQUIRE(positions[0] == sf::Vector2f(10, 10));
+
+            // The pending call moves along when the widget is moved to another gui
+            widget->setPosition(20, 20);
+            gui1.remove(widget);
+            gui2.add(widget);
+            widget->setPosition(30, 30);
+            gui1.updateTime(sf::milliseconds(10));
+            REQUIRE(positions.size() == 1);
+
+            gui2.updateTime(sf::milliseconds(10));
+            REQUIRE(positions.size() == 2);
+            REQUIRE(positions[1] == sf::Vector2f(30, 30));
+        }
+    }
+
     SECTION("disconnect") {
         unsigned int i = 0;
         unsigned int id = widget->connect("PositionChanged", [&](){ i++; });
@@ -24,6 +24,9 @@
 
 #include "catch.hpp"
 #include <TGUI/Texture.hpp>
+#include <TGUI/RenderBackend.hpp>
+
+#include <cmath>
 
 TEST_CASE("[Texture]") {
     SECTION("Loading") {
@@ -44,7 +47,7 @@ TEST_CASE("[Texture]") {
             REQUIRE(texture.getId() == "");
             REQUIRE(texture.getData() != nullptr);
             REQUIRE(texture.getData()->image == nullptr);
-            REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(0, 0));
+            REQUIRE(texture.getData()->size == sf::Vector2u(0, 0));
             REQUIRE(texture.getData()->rect == sf::IntRect());
             REQUIRE(texture.getSize() == sf::Vector2f(0, 0));
             REQUIRE(texture.getImageSize() == sf::Vector2f(0, 0));
@@ -63,7 +66,7 @@ TEST_CASE("[Texture]") {
                 REQUIRE(texture.getId() == "resources/image.png");
                 REQUIRE(texture.getData() != nullptr);
                 REQUIRE(texture.getData()->image != nullptr);
-                REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(50, 50));
+                REQUIRE(texture.getData()->size == sf::Vector2u(50, 50));
                 REQUIRE(texture.getData()->rect == sf::IntRect());
                 REQUIRE(texture.getSize() == sf::Vector2f(50, 50));
                 REQUIRE(texture.getImageSize() == sf::Vector2f(50, 50));
@@ -81,7 +84,7 @@ TEST_CASE("[Texture]") {
                 REQUIRE(texture.getId() == "resources/image.png");
                 REQUIRE(texture.getData() != nullptr);
                 REQUIRE(texture.getData()->image != nullptr);
-                REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(40, 30));
+                REQUIRE(texture.getData()->size == sf::Vector2u(40, 30));
                 REQUIRE(texture.getData()->rect == sf::IntRect(10, 5, 40, 30));
                 REQUIRE(texture.getSize() == sf::Vector2f(40, 30));
                 REQUIRE(texture.getImageSize() == sf::Vector2f(40, 30));
@@ -104,7 +107,7 @@ TEST_CASE("[Texture]") {
                 REQUIRE(texture2.getId() == "");
                 REQUIRE(texture2.getData() != nullptr);
                 REQUIRE(texture2.getData()->image != nullptr);
-                REQUIRE(texture2.getData()->texture.getSize() == sf::Vector2u(40, 30));
+                REQUIRE(texture2.getData()->size == sf::Vector2u(40, 30));
                 REQUIRE(texture2.getData()->rect == sf::IntRect(10, 5, 40, 30));
                 REQUIRE(texture2.getSize() == sf::Vector2f(40, 30));
                 REQUIRE(texture2.getImageSize() == sf::Vector2f(40, 30));
@@ -143,7 +146,7 @@ TEST_CASE("[Texture]") {
             REQUIRE(texture.getId() == "resources/image.png");
             REQUIRE(texture.getData() != nullptr);
             REQUIRE(texture.getData()->image != nullptr);
-            REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(50, 50));
+            REQUIRE(texture.getData()->size == sf::Vector2u(50, 50));
             REQUIRE(texture.getData()->rect == sf::IntRect());
             REQUIRE(texture.getSize() == sf::Vector2f(200, 100));
             REQUIRE(texture.getImageSize() == sf::Vector2f(50, 50));
@@ -161,7 +164,7 @@ TEST_CASE("[Texture]") {
                 REQUIRE(textureCopy.getId() == "resources/image.png");
                 REQUIRE(textureCopy.getData() != nullptr);
                 REQUIRE(textureCopy.getData()->image != nullptr);
-                REQUIRE(textureCopy.getData()->texture.getSize() == sf::Vector2u(50, 50));
+                REQUIRE(textureCopy.getData()->size == sf::Vector2u(50, 50));
                 REQUIRE(textureCopy.getData()->rect == sf::IntRect());
                 REQUIRE(textureCopy.getSize() == sf::Vector2f(200, 100));
                 REQUIRE(textureCopy.getImageSize() == sf::Vector2f(50, 50));
@@ -185,7 +188,7 @@ TEST_CASE("[Texture]") {
                 REQUIRE(textureCopy.getId() == "resources/image.png");
                 REQUIRE(textureCopy.getData() != nullptr);
                 REQUIRE(textureCopy.getData()->image != nullptr);
-                REQUIRE(textureCopy.getData()->texture.getSize() == sf::Vector2u(50, 50));
+                REQUIRE(textureCopy.getData()->size == sf::Vector2u(50, 50));
                 REQUIRE(textureCopy.getData()->rect == sf::IntRect());
                 REQUIRE(textureCopy.getSize() == sf::Vector2f(200, 100));
                 REQUIRE(textureCopy.getImageSize() == sf::Vector2f(50, 50));
@@ -275,6 +278,66 @@ TEST_CASE("[Texture]") {
         tgui::Texture::setTextureLoader(oldTextureLoader);
     }
 
+    SECTION("Geometry") {
+        tgui::Texture texture{"resources/TransparentParts.png", {0, 0, 50, 50}, {10, 10, 30, 30}};
+
+        // Every vertex lies on one of the four columns and rows in which the image is split
+        auto checkGeometry = [&](tgui::Texture::ScalingType scalingType, std::vector<std::pair<float, float>> columns, std::vector<std::pair<float, float>> rows) {
+            REQUIRE(texture.getScalingType() == scalingType);
+
+            tgui::RenderCommandList commands;
+            commands.addTexture({}, texture);
+            const auto& vertices = commands.getVertices();
+            REQUIRE((vertices.size() % 3) == 0);
+
+            float area = 0;
+            for (std::size_t i = 0; i < vertices.size(); i += 3)
+            {
+                const sf::Vector2f side1 = vertices[i+1].position - vertices[i].position;
+                const sf::Vector2f side2 = vertices[i+2].position - vertices[i].position;
+                area += std::abs(side1.x * side2.y - side1.y * side2.x) / 2;
+            }
+
+            for (const auto& vertex : vertices)
+            {
+                auto onLine = [](float position, float texCoord, const std::vector<std::pair<float, float>>& lines) {
+                    for (const auto& line : lines)
+                    {
+                        if ((position == Approx(line.first)) && (texCoord == Approx(line.second)))
+                            return true;
+                    }
+                    return false;
+                };
+
+                REQUIRE(onLine(vertex.position.x, vertex.texCoords.x, columns));
+                REQUIRE(onLine(vertex.position.y, vertex.texCoords.y, rows));
+            }
+
+            // The triangles cover the whole texture without overlapping
+            REQUIRE(area == Approx(texture.getSize().x * texture.getSize().y));
+        };
+
+        SECTION("Normal") {
+            texture.setSize({10, 2});
+            checkGeometry(tgui::Texture::ScalingType::Normal, {{0, 0}, {10, 50}}, {{0, 0}, {2, 50}});
+        }
+
+        SECTION("Horizontal") {
+            texture.setSize({60, 10});
+            checkGeometry(tgui::Texture::ScalingType::Horizontal, {{0, 0}, {2, 10}, {58, 40}, {60, 50}}, {{0, 0}, {10, 50}});
+        }
+
+        SECTION("Vertical") {
+            texture.setSize({10, 60});
+            checkGeometry(tgui::Texture::ScalingType::Vertical, {{0, 0}, {10, 50}}, {{0, 0}, {2, 10}, {58, 40}, {60, 50}});
+        }
+
+        SECTION("NineSlice") {
+            texture.setSize({100, 80});
+            checkGeometry(tgui::Texture::ScalingType::NineSlice, {{0, 0}, {10, 10}, {90, 40}, {100, 50}}, {{0, 0}, {10, 10}, {70, 40}, {80, 50}});
+        }
+    }
+
     SECTION("isTransparentPixel") {
         tgui::Texture texture;
         texture.setPosition({10, 20});
@@ -309,6 +372,35 @@ TEST_CASE("[Texture]") {
             REQUIRE(!texture.isTransparentPixel(69, 20));
         }
 
+        SECTION("Mask is created when loading") {
+            // Textures that share the data on different threads only read the mask
+            texture.load("resources/TransparentParts.png", {10, 10, 30, 30});
+            REQUIRE(texture.getData()->transparentPixels.size() == 30 * 30);
+
+            tgui::Texture copiedTexture = texture;
+            REQUIRE(copiedTexture.getData() == texture.getData());
+
+            tgui::Texture textureFromSfml;
+            textureFromSfml.load(texture.getData()->getTexture());
+            REQUIRE(textureFromSfml.getData()->transparentPixels.size() == 30 * 30);
+        }
+
+        SECTION("Resizing") {
+            texture.load("resources/TransparentParts.png", {10, 10, 30, 30});
+            texture.setSize({60, 15});
+            REQUIRE(!texture.isTransparentPixel(21, 22.5f));
+            REQUIRE(texture.isTransparentPixel(22, 23));
+
+            // The same pixels are found on other positions when the texture becomes larger
+            texture.setSize({120, 30});
+            REQUIRE(!texture.isTransparentPixel(30, 25));
+            REQUIRE(texture.isTransparentPixel(34, 26));
+
+            tgui::Texture copiedTexture = texture;
+            REQUIRE(!copiedTexture.isTransparentPixel(30, 25));
+            REQUIRE(copiedTexture.isTransparentPixel(34, 26));
+        }
+
         SECTION("Horizontal Scaling") {
             texture.load("resources/TransparentParts.png", {0, 10, 50, 30}, {10, 0, 30, 30});
             texture.setSize({70, 15});
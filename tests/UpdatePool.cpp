@@ -0,0 +1,166 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2015 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/UpdatePool.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/Animation.hpp>
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    // Button that sends its Pressed signal every time it is updated
+    class UpdatingButton : public tgui::Button
+    {
+    protected:
+        void update(sf::Time elapsedTime) override
+        {
+            tgui::Button::update(elapsedTime);
+            sendSignal("Pressed", getText());
+        }
+    };
+
+    void createWidgets(tgui::Gui& gui)
+    {
+        gui.setFont("resources/DroidSansArmenian.ttf");
+
+        for (unsigned int i = 0; i < 8; ++i)
+        {
+            auto panel = tgui::Panel::create({200, 200});
+            panel->setPosition(i * 10.f, i * 20.f);
+            gui.add(panel);
+
+            auto editBox = tgui::EditBox::create();
+            editBox->setText("EditBox");
+            panel->add(editBox);
+
+            auto textBox = tgui::TextBox::create();
+            textBox->setText("Line 1\nLine 2");
+            textBox->setPosition(0, 40);
+            panel->add(textBox);
+
+            auto label = tgui::Label::create();
+            label->setText("Label");
+            panel->add(label);
+
+            auto button = std::make_shared<UpdatingButton>();
+            button->setText(std::to_string(i));
+            panel->add(button);
+
+            // Loading text lays it out with the shared font while updating, so these panels are updated on the main thread
+            if (i % 2 == 0)
+            {
+                std::string text;
+                for (unsigned int line = 0; line < 5000; ++line)
+                    text += "Line " + std::to_string(line) + " of the text that is loaded in parts\n";
+
+                auto loadedTextBox = tgui::TextBox::create();
+                loadedTextBox->loadTextFromStream(std::unique_ptr<std::istream>(new std::istringstream{text}));
+                panel->add(loadedTextBox);
+            }
+
+            if (i == 3)
+                label->showWithEffect(tgui::ShowAnimationType::SlideFromLeft, sf::milliseconds(300));
+        }
+    }
+
+    std::string saveWidgets(tgui::Gui& gui)
+    {
+        std::stringstream stream;
+        gui.getContainer()->saveWidgetsToStream(stream);
+        return stream.str();
+    }
+}
+
+TEST_CASE("[UpdatePool]") {
+    SECTION("run") {
+        tgui::priv::UpdatePool pool{4};
+        REQUIRE(pool.getThreadCount() == 4);
+
+        std::vector<int> counts(100, 0);
+        pool.run(counts.size(), [&](std::size_t i){ counts[i]++; });
+        pool.run(counts.size(), [&](std::size_t i){ counts[i]++; });
+        REQUIRE(std::count(counts.begin(), counts.end(), 2) == 100);
+
+        REQUIRE_THROWS_AS(pool.run(10, [](std::size_t i){ if (i == 5) throw tgui::Exception{"error"}; }), tgui::Exception);
+        REQUIRE_NOTHROW(pool.run(10, [](std::size_t){}));
+
+        REQUIRE(tgui::priv::UpdatePool{1}.getThreadCount() == 1);
+        REQUIRE(tgui::priv::UpdatePool{}.getThreadCount() >= 1);
+    }
+
+    SECTION("Gui") {
+        tgui::Gui serialGui;
+        tgui::Gui parallelGui;
+        createWidgets(serialGui);
+        createWidgets(parallelGui);
+
+        REQUIRE(!parallelGui.isParallelUpdateEnabled());
+        parallelGui.setParallelUpdate(true, 4);
+        REQUIRE(parallelGui.isParallelUpdateEnabled());
+
+        std::vector<std::string> serialSignals;
+        for (auto& panel : serialGui.getWidgets())
+            std::static_pointer_cast<tgui::Panel>(panel)->getWidgets()[3]->connect("Pressed", [&](const sf::String& text){ serialSignals.push_back(text); });
+
+        std::vector<std::string> parallelSignals;
+        bool signalsOnMainThread = true;
+        const auto mainThreadId = std::this_thread::get_id();
+        for (auto& panel : parallelGui.getWidgets())
+        {
+            std::static_pointer_cast<tgui::Panel>(panel)->getWidgets()[3]->connect("Pressed", [&](const sf::String& text){
+                    parallelSignals.push_back(text);
+                    if (std::this_thread::get_id() != mainThreadId)
+                        signalsOnMainThread = false;
+                });
+        }
+
+        for (unsigned int frame = 0; frame < 20; ++frame)
+        {
+            serialGui.updateTime(sf::milliseconds(30));
+            parallelGui.updateTime(sf::milliseconds(30));
+            REQUIRE(saveWidgets(parallelGui) == saveWidgets(serialGui));
+        }
+
+        auto loadedTextBox = std::static_pointer_cast<tgui::TextBox>(std::static_pointer_cast<tgui::Panel>(parallelGui.getWidgets()[0])->getWidgets()[4]);
+        REQUIRE(!loadedTextBox->isLoadingText());
+        REQUIRE(loadedTextBox->getText().getSize() > 200000);
+
+        REQUIRE(signalsOnMainThread);
+        REQUIRE(parallelSignals.size() == 8 * 20);
+        REQUIRE(parallelSignals == serialSignals);
+
+        parallelGui.setParallelUpdate(false);
+        REQUIRE(!parallelGui.isParallelUpdateEnabled());
+    }
+}
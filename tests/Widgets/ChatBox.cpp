@@ -173,6 +173,71 @@ TEST_CASE("[ChatBox]") {
         REQUIRE(!chatBox->getLinesStartFromTop());
     }
 
+    SECTION("Scrollback") {
+        chatBox->addLine("First", sf::Color::Red, 20);
+        REQUIRE(!chatBox->isScrollbackEnabled());
+
+        bool spillToDisk = false;
+        SECTION("in memory") { spillToDisk = false; }
+        SECTION("in file") { spillToDisk = true; }
+
+        chatBox->setScrollbackEnabled(true, spillToDisk);
+        REQUIRE(chatBox->isScrollbackEnabled());
+        REQUIRE(chatBox->getLineAmount() == 1);
+        REQUIRE(chatBox->getLine(0) == "First");
+        REQUIRE(chatBox->getLineColor(0) == sf::Color::Red);
+        REQUIRE(chatBox->getLineTextSize(0) == 20);
+
+        for (unsigned int i = 1; i < 3000; ++i)
+            chatBox->addLine("Line " + tgui::to_string(i));
+
+        REQUIRE(chatBox->getLineAmount() == 3000);
+        REQUIRE(chatBox->getLine(1234) == "Line 1234");
+        REQUIRE(chatBox->getLineTextSize(1234) == chatBox->getTextSize());
+        REQUIRE(chatBox->getLine(3000) == "");
+
+        chatBox->getScrollbar()->setValue(0);
+        chatBox->removeLine(1);
+        REQUIRE(chatBox->getLine(1) == "Line 2");
+
+        chatBox->setLineLimit(1000);
+        REQUIRE(chatBox->getLineAmount() == 1000);
+        REQUIRE(chatBox->getLine(0) == "Line 2000");
+        REQUIRE(chatBox->getLine(999) == "Line 2999");
+
+        // Adding lines to a full chat box removes the oldest lines without changing the total height
+        const unsigned int maximum = chatBox->getScrollbar()->getMaximum();
+        for (unsigned int i = 3000; i < 5500; ++i)
+            chatBox->addLine("Line " + tgui::to_string(i));
+
+        REQUIRE(chatBox->getLineAmount() == 1000);
+        REQUIRE(chatBox->getLine(0) == "Line 4500");
+        REQUIRE(chatBox->getLine(999) == "Line 5499");
+        REQUIRE(chatBox->getScrollbar()->getMaximum() == maximum);
+
+        chatBox->removeLine(500);
+        REQUIRE(chatBox->getLine(500) == "Line 5001");
+        REQUIRE(chatBox->getLine(998) == "Line 5499");
+        chatBox->addLine("Line 5500");
+        chatBox->addLine("Line 5501");
+        REQUIRE(chatBox->getLine(0) == "Line 4501");
+        REQUIRE(chatBox->getLine(999) == "Line 5501");
+        REQUIRE(chatBox->getScrollbar()->getMaximum() == maximum);
+
+        chatBox->setLineLimit(2000);
+        chatBox->removeLine(0);
+        chatBox->setLineLimit(3);
+        REQUIRE(chatBox->getLine(0) == "Line 5499");
+        REQUIRE(chatBox->getLine(2) == "Line 5501");
+        chatBox->setLineLimit(1000);
+
+        chatBox->setScrollbackEnabled(false);
+        REQUIRE(!chatBox->isScrollbackEnabled());
+        REQUIRE(chatBox->getLineAmount() == 3);
+        REQUIRE(chatBox->getLine(0) == "Line 5499");
+        REQUIRE(chatBox->getLine(2) == "Line 5501");
+    }
+
     SECTION("Scrollbar") {
         tgui::Scrollbar::Ptr scrollbar = std::make_shared<tgui::Theme>()->load("scrollbar");
         REQUIRE(chatBox->getScrollbar() != nullptr);
@@ -256,6 +256,38 @@ TEST_CASE("[EditBox]") {
                 editBox->textEntered('.');
                 REQUIRE(editBox->getText() == "-.");
             }
+
+            SECTION("Removing decimal point") {
+                sf::Event::KeyEvent event;
+                event.control = false;
+                event.alt     = false;
+                event.shift   = false;
+                event.system  = false;
+                event.code    = sf::Keyboard::BackSpace;
+
+                editBox->keyPressed(event);
+                editBox->keyPressed(event);
+                REQUIRE(editBox->getText() == "-2");
+
+                editBox->textEntered('.');
+                editBox->textEntered('7');
+                REQUIRE(editBox->getText() == "-2.7");
+            }
+        }
+
+        SECTION("Custom") {
+            editBox->setInputValidator("[a-z]*");
+            REQUIRE(editBox->getInputValidator() == "[a-z]*");
+            REQUIRE(editBox->getText() == "");
+
+            auto editBox2 = std::make_shared<tgui::EditBox>();
+            editBox2->setInputValidator("[a-z]*");
+
+            editBox->textEntered('a');
+            editBox->textEntered('B');
+            editBox2->textEntered('c');
+            REQUIRE(editBox->getText() == "a");
+            REQUIRE(editBox2->getText() == "c");
         }
     }
 
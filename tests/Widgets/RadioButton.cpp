@@ -24,6 +24,7 @@
 
 #include "../Tests.hpp"
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
 
 TEST_CASE("[RadioButton]") {
     tgui::RadioButton::Ptr radioButton = std::make_shared<tgui::RadioButton>();
@@ -39,6 +40,7 @@ TEST_CASE("[RadioButton]") {
 
     SECTION("WidgetType") {
         REQUIRE(radioButton->getWidgetType() == "RadioButton");
+        REQUIRE(radioButton->getWidgetTypeId() == tgui::WidgetType::RadioButton);
     }
 
     SECTION("Checked") {
@@ -79,6 +81,84 @@ TEST_CASE("[RadioButton]") {
         REQUIRE(!radioButton2->isChecked());
         REQUIRE(radioButton3->isChecked());
     }
+
+    SECTION("Group") {
+        auto parent = std::make_shared<tgui::GuiContainer>();
+        auto radioButton1 = std::make_shared<tgui::RadioButton>();
+        auto radioButton2 = std::make_shared<tgui::RadioButton>();
+        auto radioButton3 = std::make_shared<tgui::RadioButton>();
+        auto radioButton4 = std::make_shared<tgui::RadioButton>();
+        parent->add(radioButton1);
+        parent->add(radioButton2);
+        parent->add(radioButton3);
+        parent->add(radioButton4);
+
+        auto group = tgui::RadioButtonGroup::create();
+        REQUIRE(radioButton3->getGroup() == nullptr);
+        radioButton3->setGroup(group);
+        radioButton4->setGroup(group);
+        REQUIRE(radioButton3->getGroup() == group);
+        REQUIRE(group->getCheckedRadioButton() == nullptr);
+
+        // Radio buttons in other groups are not affected when checking a radio button
+        radioButton1->check();
+        radioButton3->check();
+        REQUIRE(radioButton1->isChecked());
+        REQUIRE(radioButton3->isChecked());
+        REQUIRE(parent->getRadioButtonGroup()->getCheckedRadioButton() == radioButton1);
+        REQUIRE(group->getCheckedRadioButton() == radioButton3);
+
+        radioButton4->check();
+        REQUIRE(radioButton1->isChecked());
+        REQUIRE(!radioButton3->isChecked());
+        REQUIRE(radioButton4->isChecked());
+        REQUIRE(group->getCheckedRadioButton() == radioButton4);
+
+        radioButton2->check();
+        REQUIRE(!radioButton1->isChecked());
+        REQUIRE(radioButton2->isChecked());
+        REQUIRE(radioButton4->isChecked());
+
+        // Moving a checked radio button out of the group
+        radioButton4->setGroup(nullptr);
+        REQUIRE(!radioButton2->isChecked());
+        REQUIRE(radioButton4->isChecked());
+        REQUIRE(group->getCheckedRadioButton() == nullptr);
+        REQUIRE(parent->getRadioButtonGroup()->getCheckedRadioButton() == radioButton4);
+
+        // Removing a checked radio button from its parent
+        parent->remove(radioButton4);
+        REQUIRE(radioButton4->isChecked());
+        REQUIRE(parent->getRadioButtonGroup()->getCheckedRadioButton() == nullptr);
+        radioButton1->check();
+        REQUIRE(radioButton4->isChecked());
+
+        parent->getRadioButtonGroup()->uncheckRadioButtons();
+        REQUIRE(!radioButton1->isChecked());
+
+        // A copy stays in the group of the original and takes over the checked state when it is added to a container
+        radioButton3->check();
+        auto radioButton5 = tgui::RadioButton::copy(radioButton3);
+        REQUIRE(radioButton5->getGroup() == group);
+        REQUIRE(radioButton5->isChecked());
+        REQUIRE(group->getCheckedRadioButton() == radioButton3);
+        parent->add(radioButton5);
+        REQUIRE(!radioButton3->isChecked());
+        REQUIRE(group->getCheckedRadioButton() == radioButton5);
+
+        // The group no longer returns a radio button once it has been destroyed
+        parent->remove(radioButton5);
+        radioButton5 = nullptr;
+        REQUIRE(group->getCheckedRadioButton() == nullptr);
+
+        // Check boxes are never part of a group
+        auto checkBox = std::make_shared<tgui::CheckBox>();
+        parent->add(checkBox);
+        checkBox->check();
+        radioButton2->check();
+        REQUIRE(checkBox->isChecked());
+        REQUIRE(checkBox->getWidgetTypeId() == tgui::WidgetType::CheckBox);
+    }
     
     SECTION("Text") {
         REQUIRE(radioButton->getText() == "");
@@ -26,6 +26,8 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
 
+#include <sstream>
+
 TEST_CASE("[TextBox]") {
     tgui::TextBox::Ptr textBox = std::make_shared<tgui::TextBox>();
     textBox->setFont("resources/DroidSansArmenian.ttf");
@@ -33,6 +35,7 @@ TEST_CASE("[TextBox]") {
     SECTION("Signals") {
         REQUIRE_NOTHROW(textBox->connect("TextChanged", [](){}));
         REQUIRE_NOTHROW(textBox->connect("TextChanged", [](sf::String){}));
+        REQUIRE_NOTHROW(textBox->connect("TextLoaded", [](){}));
     }
 
     SECTION("WidgetType") {
@@ -53,6 +56,88 @@ TEST_CASE("[TextBox]") {
         REQUIRE(textBox->getScrollbar() == scrollbar);
     }
 
+    SECTION("Adding text") {
+        textBox->setSize(200, 100);
+        textBox->setText("The last word of this line is split over multiple calls to addText\nnext line");
+        const unsigned int scrollbarMaximum = textBox->getScrollbar()->getMaximum();
+
+        textBox->setText("The last word of this line is split over multiple calls to add");
+        textBox->addText("Te");
+        textBox->addText("xt\nnext line");
+        REQUIRE(textBox->getText() == "The last word of this line is split over multiple calls to addText\nnext line");
+        REQUIRE(textBox->getScrollbar()->getMaximum() == scrollbarMaximum);
+    }
+
+    SECTION("Loading text") {
+        textBox->setSize(200, 100);
+
+        std::string content;
+        for (unsigned int i = 0; i < 5000; ++i)
+            content += "Line " + std::to_string(i) + " of the text that is being loaded\n";
+
+        unsigned int loadedCount = 0;
+        textBox->connect("TextLoaded", [&](){ loadedCount++; });
+
+        tgui::Widget::Ptr widget = textBox;
+        SECTION("In chunks") {
+            textBox->loadTextFromStream(std::unique_ptr<std::istream>(new std::istringstream(content)));
+            REQUIRE(textBox->isLoadingText());
+            REQUIRE(textBox->getText() == "");
+
+            // The scrollbar grows while the text is being loaded
+            widget->update(sf::milliseconds(10));
+            const unsigned int scrollbarMaximum = textBox->getScrollbar()->getMaximum();
+            REQUIRE(textBox->getText().getSize() > 0);
+            REQUIRE(textBox->getText().getSize() < content.size());
+
+            widget->update(sf::milliseconds(10));
+            REQUIRE(textBox->getScrollbar()->getMaximum() > scrollbarMaximum);
+        }
+
+        SECTION("On a worker thread") {
+            textBox->loadTextFromStream(std::unique_ptr<std::istream>(new std::istringstream(content)), true);
+            REQUIRE(textBox->isLoadingText());
+        }
+
+        while (textBox->isLoadingText())
+            widget->update(sf::milliseconds(10));
+
+        REQUIRE(loadedCount == 1);
+        REQUIRE(textBox->getText() == content);
+
+        // The lines are wrapped in the same way as when setting the whole text at once
+        const unsigned int scrollbarMaximum = textBox->getScrollbar()->getMaximum();
+        textBox->setText(content);
+        REQUIRE(textBox->getScrollbar()->getMaximum() == scrollbarMaximum);
+
+        REQUIRE_THROWS_AS(textBox->loadTextFromFile("NonExistentFile.txt"), tgui::Exception);
+    }
+
+    SECTION("Selecting text in a long text") {
+        textBox->setSize(800, 100);
+
+        std::string content;
+        for (unsigned int i = 0; i < 5000; ++i)
+            content += "Line " + std::to_string(i) + "\n";
+
+        textBox->setText(content);
+        REQUIRE(textBox->getSelectedText() == "");
+
+        // The selection also contains the lines that aren't displayed
+        sf::Event::KeyEvent event;
+        event.control = true;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+        event.code    = sf::Keyboard::A;
+        textBox->keyPressed(event);
+        REQUIRE(textBox->getSelectedText() == content);
+
+        textBox->getScrollbar()->setValue(0);
+        textBox->setSize(800, 120);
+        REQUIRE(textBox->getSelectedText() == content);
+    }
+
     SECTION("Renderer") {
         auto renderer = textBox->getRenderer();
 